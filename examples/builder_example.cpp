@@ -11,6 +11,7 @@
 #include <vector>
 
 #include <sparrow/builder/builder.hpp>
+#include <sparrow/builder/dictionary_builder.hpp>
 
 void primitve_array()
 {
@@ -163,6 +164,18 @@ void dict_encoded_variable_sized_binary()
     //! [builder_dict_encoded_variable_sized_binary]
 }
 
+void dictionary_builder_batches()
+{
+    //! [builder_dictionary_builder]
+    sparrow::dictionary_builder<std::string> builder;
+    builder.append(std::vector<std::string>{"hello", "world"});
+    builder.append(std::vector<std::string>{"world", "hello", "hello"});
+    builder.push_back("world");
+    auto arr = builder.finish();
+    //! [builder_dictionary_builder]
+    assert(arr.size() == 6);
+}
+
 void run_end_encoded_variable_sized_binary()
 {
     //! [builder_run_end_encoded_variable_sized_binary]
@@ -214,6 +227,7 @@ int main()
     fixed_sized_list_strings();
     fixed_sized_list_of_union();
     dict_encoded_variable_sized_binary();
+    dictionary_builder_batches();
     run_end_encoded_variable_sized_binary();
     struct_array();
     sparse_union_array();
@@ -44,6 +44,12 @@ namespace sparrow
         return sparrow::visit(std::forward<F>(func), *p_array);
     }
 
+    template <class F>
+    void array::visit_elements(F&& func, size_type first, size_type last) const
+    {
+        sparrow::visit_elements(std::forward<F>(func), *p_array, first, last);
+    }
+
     template <layout_or_array A>
     bool owns_arrow_array(const A& a)
     {
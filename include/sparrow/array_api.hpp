@@ -208,6 +208,20 @@ namespace sparrow
         template <class F>
         visit_result_t<F> visit(F&& func) const;
 
+        /**
+         * Calls \c func on each element of the array in the range [\c first, \c last).
+         * The type of the internal layout is dispatched once for the whole
+         * range, and \c func receives the elements with their actual reference
+         * type instead of \ref const_reference. \c func must accept the
+         * elements of any layout.
+         *
+         * @param func The functor to apply.
+         * @param first The index of the first element to visit.
+         * @param last The index past the last element to visit.
+         */
+        template <class F>
+        void visit_elements(F&& func, size_type first, size_type last) const;
+
         /**
          * Slices the array to keep only the elements between the given \p start and \p end.
          * A copy of the  \ref array is modified. The data is not modified, only the ArrowArray.offset and
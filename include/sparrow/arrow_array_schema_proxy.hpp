@@ -247,6 +247,15 @@ namespace sparrow
          */
         SPARROW_API void pop_back_bitmap();
 
+        /**
+         * Allocate the bitmap buffer of an `ArrowArray` created without one,
+         * all its elements being valid. Does nothing if the bitmap buffer is
+         * already allocated.
+         * @exception `arrow_proxy_exception` If the `ArrowArray` was not created with sparrow.
+         * @exception `arrow_proxy_exception` If the array format does not support a validity bitmap.
+         */
+        SPARROW_API void allocate_bitmap();
+
         /**
          * Add children without taking their ownership.
          * @exception `arrow_proxy_exception` If the `ArrowArray` or the `ArrowSchema` wrapped
@@ -368,8 +377,9 @@ namespace sparrow
         /**
          * Slices the array to keep only the elements between the given \p start and \p end.
          * A copy of the \ref array is modified. The data is not modified, only the ArrowArray.offset and
-         * ArrowArray.length are updated. If \p end is greater than the size of the buffers, the following
-         * elements will be invalid.
+         * ArrowArray.length are updated. The buffers of an array created by sparrow are shared with the
+         * slice and copied only when one of them is modified (see detach_buffers). If \p end is greater
+         * than the size of the buffers, the following elements will be invalid.
          *
          * @param start The index of the first element to keep. Must be less than \p end.
          * @param end The index of the first element to discard. Must be less than the size of the buffers.
@@ -392,6 +402,17 @@ namespace sparrow
          */
         SPARROW_API void update_buffers();
 
+        /**
+         * Copies the buffers of the array whose memory is shared with copies of the array, so that they
+         * can be modified in place without affecting the copies. This method must be called before
+         * modifying the buffers through pointers or buffer views. It does nothing if the array was not
+         * created with sparrow.
+         *
+         * @return true if a buffer has been copied, in which case the pointers to its elements are
+         * invalidated.
+         */
+        SPARROW_API bool detach_buffers();
+
     private:
 
         std::variant<ArrowArray*, ArrowArray> m_array;
@@ -493,8 +514,9 @@ namespace sparrow
         }
         SPARROW_ASSERT_TRUE(has_bitmap(data_type()))
         auto bitmap = get_non_owning_dynamic_bitset();
-        const auto it = bitmap.insert(sparrow::next(bitmap.cbegin(), index), range.begin(), range.end());
-        return static_cast<size_t>(std::distance(bitmap.begin(), it));
+        bitmap.insert(sparrow::next(bitmap.cbegin(), index), range.begin(), range.end());
+        update_buffers();
+        return index;
     }
 }
 
@@ -24,6 +24,7 @@
 #endif
 
 #include "sparrow/arrow_interface/arrow_array/private_data.hpp"
+#include "sparrow/buffer/aligned_allocator.hpp"
 #include "sparrow/c_interface.hpp"
 #include "sparrow/config/config.hpp"
 #include "sparrow/utils/repeat_container.hpp"
@@ -169,6 +170,16 @@ namespace sparrow
     [[nodiscard]] SPARROW_API std::vector<sparrow::buffer_view<uint8_t>>
     get_arrow_array_buffers(const ArrowArray& array, const ArrowSchema& schema);
 
+    /**
+     * Checks that every non-null buffer of the array, of its children and of its
+     * dictionary is aligned on \c alignment bytes. Consumers can use it to select
+     * kernels relying on aligned loads, since the C data interface does not carry
+     * this information.
+     * @param array The ArrowArray to check.
+     * @param alignment The expected alignment, a power of 2.
+     */
+    [[nodiscard]] SPARROW_API bool is_arrow_aligned(const ArrowArray& array, std::size_t alignment = arrow_alignment);
+
     /**
      * Swaps the contents of the two ArrowArray objects.
      */
@@ -176,6 +187,8 @@ namespace sparrow
 
     /**
      * Fill the target ArrowArray with a deep copy of the data from the source ArrowArray.
+     * The buffers of arrays created by sparrow are not copied but shared, their memory is
+     * copied only when an array referencing it is modified through sparrow.
      * @param source_array The source ArrowArray to copy from.
      * @param source_schema The schema of the source ArrowArray.
      * @param target The target ArrowArray to copy to.
@@ -184,7 +197,8 @@ namespace sparrow
     copy_array(const ArrowArray& source_array, const ArrowSchema& source_schema, ArrowArray& target);
 
     /**
-     * Create a deep copy of the source ArrowArray. The buffers, children and dictionary are deep copied.
+     * Create a deep copy of the source ArrowArray. The buffers, children and dictionary are deep copied,
+     * except the buffers of arrays created by sparrow, which are copied on write.
      */
     [[nodiscard]] inline ArrowArray copy_array(const ArrowArray& source_array, const ArrowSchema& source_schema)
     {
@@ -14,22 +14,74 @@
 
 #pragma once
 
+#include <memory>
+#include <new>
 #include <vector>
 
 #include "sparrow/arrow_interface/arrow_array_schema_utils.hpp"
 #include "sparrow/arrow_interface/private_data_ownership.hpp"
+#include "sparrow/buffer/arena.hpp"
 #include "sparrow/buffer/buffer.hpp"
 #include "sparrow/buffer/buffer_view.hpp"
+#include "sparrow/buffer/memory_region.hpp"
 #include "sparrow/utils/contracts.hpp"
 
 namespace sparrow
 {
+    namespace detail
+    {
+        /*
+         * Region owning the memory of a buffer shared by several arrays.
+         */
+        class buffer_region final : public memory_region
+        {
+        public:
+
+            explicit buffer_region(buffer<std::uint8_t>&& buf) noexcept
+                : m_buffer(std::move(buf))
+            {
+                reset(reinterpret_cast<std::byte*>(m_buffer.data()), m_buffer.size());
+            }
+
+            /**
+             * Gives back the ownership of the first \c size bytes of the memory
+             * to the caller. The region must not be referenced by any other
+             * buffer than the one being replaced with the returned buffer.
+             */
+            [[nodiscard]] buffer<std::uint8_t> release(std::size_t size)
+            {
+                SPARROW_ASSERT_TRUE(size <= m_buffer.size());
+                m_buffer.resize(size);
+                return std::move(m_buffer);
+            }
+
+            /**
+             * Allocator of the buffer that owns the memory of the region.
+             */
+            [[nodiscard]] const buffer<std::uint8_t>::allocator_type& get_allocator() const noexcept
+            {
+                return m_buffer.get_allocator();
+            }
+
+        private:
+
+            buffer<std::uint8_t> m_buffer;
+        };
+    }
 
     /**
      * Private data for ArrowArray.
      *
      * Holds and own buffers, children, and dictionary.
      * It is used in the Sparrow library.
+     *
+     * Buffers are moved to shared memory regions when the object is created,
+     * so that copies of the array can reference their memory (see
+     * share_buffers), which is copied only when one of the arrays needs to
+     * modify it (see detach_buffers).
+     *
+     * When created while an arena_scope is active, the object is allocated
+     * in the arena of the scope and keeps it alive until it is deleted.
      */
 
     class arrow_array_private_data : public children_ownership,
@@ -41,7 +93,7 @@ namespace sparrow
 
         template <std::ranges::input_range CHILDREN_OWNERSHIP>
             requires std::is_same_v<std::ranges::range_value_t<CHILDREN_OWNERSHIP>, bool>
-        explicit constexpr arrow_array_private_data(
+        explicit arrow_array_private_data(
             BufferType buffers,
             const CHILDREN_OWNERSHIP& children_ownership,
             bool dictionary_ownership
@@ -56,18 +108,60 @@ namespace sparrow
         constexpr void resize_buffer(std::size_t index, std::size_t size, std::uint8_t value);
         constexpr void update_buffers_ptrs();
 
+        /**
+         * Gives \c target buffers referencing the memory of the buffers of
+         * this object instead of a copy of it. The memory is released when
+         * the last buffer referencing it is destroyed.
+         *
+         * This object is not modified, so this method can be called
+         * concurrently with other reads of it, for instance to copy an array
+         * from several threads. Buffers that are not in a shared region
+         * anymore because they have been modified are copied.
+         */
+        void share_buffers(arrow_array_private_data& target) const;
+
+        /**
+         * Copies the buffers whose memory is still referenced by other
+         * arrays, so that they can be modified without affecting them. The
+         * buffers that are not shared anymore take back the ownership of
+         * their memory.
+         *
+         * @return true if a buffer has been copied, which invalidates the
+         * pointers to its elements.
+         */
+        bool detach_buffers();
+
         template <class T>
         [[nodiscard]] constexpr const T** buffers_ptrs() noexcept;
 
+        [[nodiscard]] static void* operator new(std::size_t size);
+        static void operator delete(void* p) noexcept;
+        static void operator delete(arrow_array_private_data* p, std::destroying_delete_t) noexcept;
+
     private:
 
+        // Moves a buffer to a shared region, its memory does not move.
+        void make_shareable(std::size_t index);
+
+        // Replaces a buffer with one that may have a different allocator,
+        // which the move assignment of buffer would not propagate.
+        void replace_buffer(std::size_t index, buffer<std::uint8_t>&& buf) noexcept;
+
+        std::shared_ptr<arena> m_arena = current_arena();
+
         BufferType m_buffers;
         std::vector<std::uint8_t*> m_buffers_pointers;
+
+        // Region referenced by each buffer if its memory can be shared with
+        // other arrays, empty otherwise. The buffers hold the only strong
+        // references to the regions, so a region is shared while its use
+        // count is greater than 1.
+        std::vector<std::weak_ptr<detail::buffer_region>> m_shared_regions;
     };
 
     template <std::ranges::input_range CHILDREN_OWNERSHIP>
         requires std::is_same_v<std::ranges::range_value_t<CHILDREN_OWNERSHIP>, bool>
-    constexpr arrow_array_private_data::arrow_array_private_data(
+    arrow_array_private_data::arrow_array_private_data(
         BufferType buffers,
         const CHILDREN_OWNERSHIP& children_ownership_range,
         bool dictionary_ownership_value
@@ -76,7 +170,12 @@ namespace sparrow
         , dictionary_ownership(dictionary_ownership_value)
         , m_buffers(std::move(buffers))
         , m_buffers_pointers(to_raw_ptr_vec<std::uint8_t>(m_buffers))
+        , m_shared_regions(m_buffers.size())
     {
+        for (std::size_t i = 0; i < m_buffers.size(); ++i)
+        {
+            make_shareable(i);
+        }
     }
 
     [[nodiscard]] constexpr std::vector<buffer<std::uint8_t>>& arrow_array_private_data::buffers() noexcept
@@ -93,20 +192,25 @@ namespace sparrow
     constexpr void arrow_array_private_data::resize_buffers(std::size_t size)
     {
         m_buffers.resize(size);
+        m_shared_regions.resize(size);
         update_buffers_ptrs();
     }
 
     inline void arrow_array_private_data::set_buffer(std::size_t index, buffer<std::uint8_t>&& buffer)
     {
         SPARROW_ASSERT_TRUE(index < m_buffers.size());
-        m_buffers[index] = std::move(buffer);
+        m_shared_regions[index].reset();
+        replace_buffer(index, std::move(buffer));
+        make_shareable(index);
         m_buffers_pointers[index] = m_buffers[index].data();
     }
 
     inline void arrow_array_private_data::set_buffer(std::size_t index, const buffer_view<std::uint8_t>& buffer)
     {
         SPARROW_ASSERT_TRUE(index < m_buffers.size());
-        m_buffers[index] = buffer;
+        m_shared_regions[index].reset();
+        replace_buffer(index, sparrow::buffer<std::uint8_t>(buffer.begin(), buffer.end()));
+        make_shareable(index);
         m_buffers_pointers[index] = m_buffers[index].data();
     }
 
@@ -118,6 +222,119 @@ namespace sparrow
         m_buffers_pointers[index] = m_buffers[index].data();
     }
 
+    inline void arrow_array_private_data::share_buffers(arrow_array_private_data& target) const
+    {
+        BufferType buffers;
+        buffers.reserve(m_buffers.size());
+        std::vector<std::weak_ptr<detail::buffer_region>> regions(m_buffers.size());
+        for (std::size_t i = 0; i < m_buffers.size(); ++i)
+        {
+            const buffer<std::uint8_t>& buf = m_buffers[i];
+            const std::shared_ptr<detail::buffer_region> region = m_shared_regions[i].lock();
+            if (region != nullptr && region->contains(buf.data()))
+            {
+                buffers.emplace_back(
+                    const_cast<std::uint8_t*>(buf.data()),
+                    buf.size(),
+                    region_allocator<std::uint8_t>(region)
+                );
+                regions[i] = region;
+            }
+            else
+            {
+                buffers.emplace_back(buf.cbegin(), buf.cend());
+            }
+        }
+        target.m_buffers = std::move(buffers);
+        target.m_shared_regions = std::move(regions);
+        for (std::size_t i = 0; i < target.m_buffers.size(); ++i)
+        {
+            if (target.m_shared_regions[i].expired())
+            {
+                target.make_shareable(i);
+            }
+        }
+        target.update_buffers_ptrs();
+    }
+
+    inline bool arrow_array_private_data::detach_buffers()
+    {
+        bool copied = false;
+        for (std::size_t i = 0; i < m_buffers.size(); ++i)
+        {
+            const std::shared_ptr<detail::buffer_region> region = m_shared_regions[i].lock();
+            m_shared_regions[i].reset();
+            if (region == nullptr)
+            {
+                continue;
+            }
+            buffer<std::uint8_t>& buf = m_buffers[i];
+            // The buffer and the local reference hold the region
+            if (region.use_count() > 2 || reinterpret_cast<std::byte*>(buf.data()) != region->data())
+            {
+                // Shared with other arrays, or the buffer has been reallocated
+                // outside of the region, which can be released. The copy uses
+                // the allocator the buffer was created with, to keep its
+                // alignment.
+                using alloc_traits = std::allocator_traits<buffer<std::uint8_t>::allocator_type>;
+                replace_buffer(
+                    i,
+                    buffer<std::uint8_t>(
+                        buf.cbegin(),
+                        buf.cend(),
+                        alloc_traits::select_on_container_copy_construction(region->get_allocator())
+                    )
+                );
+                m_buffers_pointers[i] = m_buffers[i].data();
+                copied = true;
+            }
+            else
+            {
+                replace_buffer(i, region->release(buf.size()));
+            }
+        }
+        return copied;
+    }
+
+    inline void arrow_array_private_data::make_shareable(std::size_t index)
+    {
+        if (m_buffers[index].empty())
+        {
+            return;
+        }
+        auto region = std::make_shared<detail::buffer_region>(std::move(m_buffers[index]));
+        replace_buffer(
+            index,
+            buffer<std::uint8_t>(
+                reinterpret_cast<std::uint8_t*>(region->data()),
+                region->size(),
+                region_allocator<std::uint8_t>(region)
+            )
+        );
+        m_shared_regions[index] = region;
+    }
+
+    inline void arrow_array_private_data::replace_buffer(std::size_t index, buffer<std::uint8_t>&& buf) noexcept
+    {
+        std::destroy_at(std::addressof(m_buffers[index]));
+        std::construct_at(std::addressof(m_buffers[index]), std::move(buf));
+    }
+
+    inline void* arrow_array_private_data::operator new(std::size_t size)
+    {
+        return detail::allocate_in_current_arena(size, alignof(arrow_array_private_data));
+    }
+
+    inline void arrow_array_private_data::operator delete(void* p) noexcept
+    {
+        detail::deallocate_in_current_arena(p);
+    }
+
+    inline void arrow_array_private_data::operator delete(arrow_array_private_data* p, std::destroying_delete_t) noexcept
+    {
+        detail::destroy_arena_allocated(p, p->m_arena);
+    }
+
     template <class T>
     [[nodiscard]] constexpr const T** arrow_array_private_data::buffers_ptrs() noexcept
     {
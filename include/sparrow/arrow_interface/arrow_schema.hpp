@@ -196,6 +196,15 @@ namespace sparrow
      */
     SPARROW_API void copy_schema(const ArrowSchema& source, ArrowSchema& target);
 
+    /**
+     * Compares the data types described by two `ArrowSchema`: their formats,
+     * and recursively the ones of their children and dictionaries. The names,
+     * metadata and flags are not compared.
+     *
+     * @return Whether `lhs` and `rhs` describe the same data type.
+     */
+    [[nodiscard]] SPARROW_API bool same_data_type(const ArrowSchema& lhs, const ArrowSchema& rhs);
+
     /**
      * Deep copy an `ArrowSchema`.
      *
@@ -14,11 +14,14 @@
 
 #pragma once
 
+#include <memory>
+#include <new>
 #include <optional>
 #include <string>
 #include <type_traits>
 
 #include "sparrow/arrow_interface/private_data_ownership.hpp"
+#include "sparrow/buffer/arena.hpp"
 #include "sparrow/utils/contracts.hpp"
 #include "sparrow/utils/mp_utils.hpp"
 
@@ -30,6 +33,9 @@ namespace sparrow
      * This struct holds the private data for ArrowSchema, including format,
      * name and metadata strings, children, and dictionary. It is used in the
      * Sparrow library.
+     *
+     * When created while an arena_scope is active, the object is allocated
+     * in the arena of the scope and keeps it alive until it is deleted.
      */
     class arrow_schema_private_data : public children_ownership,
                                       public dictionary_ownership
@@ -68,8 +74,14 @@ namespace sparrow
         [[nodiscard]] const char* metadata_ptr() const noexcept;
         [[nodiscard]] MetadataType& metadata() noexcept;
 
+        [[nodiscard]] static void* operator new(std::size_t size);
+        static void operator delete(void* p) noexcept;
+        static void operator delete(arrow_schema_private_data* p, std::destroying_delete_t) noexcept;
+
     private:
 
+        std::shared_ptr<arena> m_arena = current_arena();
+
         FormatType m_format;
         NameType m_name;
         MetadataType m_metadata;
@@ -140,6 +152,21 @@ namespace sparrow
         SPARROW_ASSERT_TRUE(!m_format.empty())
     }
 
+    inline void* arrow_schema_private_data::operator new(std::size_t size)
+    {
+        return detail::allocate_in_current_arena(size, alignof(arrow_schema_private_data));
+    }
+
+    inline void arrow_schema_private_data::operator delete(void* p) noexcept
+    {
+        detail::deallocate_in_current_arena(p);
+    }
+
+    inline void arrow_schema_private_data::operator delete(arrow_schema_private_data* p, std::destroying_delete_t) noexcept
+    {
+        detail::destroy_arena_allocated(p, p->m_arena);
+    }
+
     [[nodiscard]] inline const char* arrow_schema_private_data::format_ptr() const noexcept
     {
         return m_format.data();
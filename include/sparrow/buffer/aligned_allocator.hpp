@@ -0,0 +1,110 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace sparrow
+{
+    /**
+     * Alignment and padding recommended by the Arrow specification for buffers:
+     * https://arrow.apache.org/docs/format/Columnar.html#buffer-alignment-and-padding
+     */
+    inline constexpr std::size_t arrow_alignment = 64;
+
+    /**
+     * @return \c size rounded up to the next multiple of \c alignment, which must be a power of 2.
+     */
+    [[nodiscard]] constexpr std::size_t padded_size(std::size_t size, std::size_t alignment = arrow_alignment) noexcept
+    {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    /**
+     * @return true if \c p is aligned on \c alignment, which must be a power of 2.
+     */
+    [[nodiscard]] inline bool is_aligned(const void* p, std::size_t alignment = arrow_alignment) noexcept
+    {
+        return (reinterpret_cast<std::uintptr_t>(p) & (alignment - 1)) == 0;
+    }
+
+    /**
+     * Allocator returning memory aligned on \c Alignment bytes, whose size is
+     * padded up to a multiple of \c Alignment bytes. The padding is zero-filled,
+     * so that SIMD kernels can use aligned loads and process whole vectors up to
+     * the padded end of a buffer without handling the tail separately.
+     *
+     * Passing it to buffer<T> or u8_buffer<T> (directly or through any_allocator,
+     * which stores it without additional allocation) gives buffers following the
+     * Arrow recommendation.
+     *
+     * @tparam T value_type of the allocator
+     * @tparam Alignment alignment in bytes, a power of 2 not smaller than alignof(T)
+     */
+    template <class T, std::size_t Alignment = arrow_alignment>
+    class aligned_allocator
+    {
+    public:
+
+        static_assert(std::has_single_bit(Alignment), "Alignment must be a power of 2");
+        static_assert(Alignment >= alignof(T), "Alignment must not be smaller than alignof(T)");
+
+        using value_type = T;
+        static constexpr std::size_t alignment = Alignment;
+
+        template <class U>
+        struct rebind
+        {
+            using other = aligned_allocator<U, Alignment>;
+        };
+
+        constexpr aligned_allocator() noexcept = default;
+
+        template <class U>
+        constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T) - Alignment)
+            {
+                throw std::bad_array_new_length();
+            }
+            const std::size_t size = n * sizeof(T);
+            const std::size_t capacity = padded_size(size, Alignment);
+            auto* p = static_cast<std::byte*>(::operator new(capacity, std::align_val_t{Alignment}));
+            std::memset(p + size, 0, capacity - size);
+            return reinterpret_cast<T*>(p);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            ::operator delete(p, padded_size(n * sizeof(T), Alignment), std::align_val_t{Alignment});
+        }
+    };
+
+    template <class T, class U, std::size_t Alignment>
+    constexpr bool
+    operator==(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept
+    {
+        return true;
+    }
+}
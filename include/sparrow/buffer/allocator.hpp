@@ -20,6 +20,9 @@
 #include <typeindex>
 #include <variant>
 
+#include "sparrow/buffer/aligned_allocator.hpp"
+#include "sparrow/buffer/arena.hpp"
+#include "sparrow/buffer/memory_region.hpp"
 #include "sparrow/utils/variant_visitor.hpp"
 
 namespace sparrow
@@ -51,12 +54,19 @@ namespace sparrow
      */
     template <class A, class T>
     concept can_any_allocator_sbo = allocator<A>
-                                    && (std::same_as<A, std::allocator<T>>
-                                        || std::same_as<A, std::pmr::polymorphic_allocator<T>>);
+                                    && (std::same_as<std::remove_cvref_t<A>, std::allocator<T>>
+                                        || std::same_as<std::remove_cvref_t<A>, std::pmr::polymorphic_allocator<T>>
+                                        || std::same_as<std::remove_cvref_t<A>, arena_allocator<T>>
+                                        || std::same_as<std::remove_cvref_t<A>, aligned_allocator<T>>
+                                        || std::same_as<std::remove_cvref_t<A>, region_allocator<T>>);
 
     /*
      * Type erasure class for allocators. This allows to use any kind of allocator
-     * (standard, polymorphic) without having to expose it as a template parameter.
+     * (standard, polymorphic, arena, aligned, region) without having to expose it as a template parameter.
+     * A default-constructed any_allocator allocates in the arena installed on the
+     * current thread by an arena_scope if any, and uses std::allocator otherwise.
+     * Copying a container does not propagate an arena allocator, the copy uses
+     * the default allocator instead.
      *
      * @tparam T value_type of the allocator
      */
@@ -134,8 +144,15 @@ namespace sparrow
             }
         };
 
-        using storage_type = std::
-            variant<std::allocator<T>, std::pmr::polymorphic_allocator<T>, std::unique_ptr<interface>>;
+        using storage_type = std::variant<
+            std::allocator<T>,
+            std::pmr::polymorphic_allocator<T>,
+            arena_allocator<T>,
+            aligned_allocator<T>,
+            region_allocator<T>,
+            std::unique_ptr<interface>>;
+
+        [[nodiscard]] static storage_type make_default_storage();
 
         template <class A>
         [[nodiscard]] std::unique_ptr<interface> make_storage(A&& alloc) const
@@ -196,7 +213,7 @@ namespace sparrow
 
     template <class T>
     any_allocator<T>::any_allocator()
-        : m_storage(make_storage(std::allocator<T>()))
+        : m_storage(make_default_storage())
     {
     }
 
@@ -206,6 +223,17 @@ namespace sparrow
     {
     }
 
+    template <class T>
+    auto any_allocator<T>::make_default_storage() -> storage_type
+    {
+        const std::shared_ptr<arena>& a = current_arena();
+        if (a != nullptr)
+        {
+            return arena_allocator<T>(a);
+        }
+        return std::allocator<T>();
+    }
+
     template <class T>
     [[nodiscard]] T* any_allocator<T>::allocate(std::size_t n)
     {
@@ -249,6 +277,13 @@ namespace sparrow
     template <class T>
     any_allocator<T> any_allocator<T>::select_on_container_copy_construction() const
     {
+        // Copies of containers allocated in an arena do not stay in it: they
+        // may outlive the scope that filled the arena, or be made on another
+        // thread. They use the default allocator of the current thread.
+        if (std::holds_alternative<arena_allocator<T>>(m_storage))
+        {
+            return any_allocator();
+        }
         return any_allocator(*this);
     }
 
@@ -0,0 +1,299 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "sparrow/config/config.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    /**
+     * Monotonic memory region.
+     *
+     * Memory is carved out of large chunks by bumping a pointer, and is only
+     * given back to the system when the arena is destroyed: deallocating
+     * a single block only reclaims it if it is the last one allocated, which
+     * is the case of a buffer growing while nothing else is allocated. This
+     * makes it suitable for building objects that share the same lifetime,
+     * such as the buffers and the private data of a record batch.
+     *
+     * An arena is meant to be shared through a std::shared_ptr: each
+     * arena_allocator holds a reference on it, so that the whole region is
+     * released at once when the last buffer allocated in it is destroyed.
+     *
+     * Allocation and deallocation are thread-safe, so that arrays built in an
+     * arena can be copied or modified from other threads.
+     */
+    class arena
+    {
+    public:
+
+        static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+        explicit arena(std::size_t initial_chunk_size = default_chunk_size);
+        ~arena();
+
+        arena(const arena&) = delete;
+        arena(arena&&) = delete;
+        arena& operator=(const arena&) = delete;
+        arena& operator=(arena&&) = delete;
+
+        /**
+         * Allocates \c size bytes aligned on \c alignment, which must be a power of 2.
+         */
+        [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * Reclaims the block if it is the last one allocated, does nothing
+         * otherwise: the memory is released when the arena is destroyed.
+         */
+        void deallocate(void* p, std::size_t size) noexcept;
+
+        /**
+         * @return The number of bytes handed out by \c allocate, padding included.
+         */
+        [[nodiscard]] std::size_t allocated_bytes() const noexcept;
+
+        /**
+         * @return The number of bytes reserved from the system.
+         */
+        [[nodiscard]] std::size_t reserved_bytes() const noexcept;
+
+    private:
+
+        void add_chunk(std::size_t min_size);
+
+        mutable std::mutex m_mutex;
+        std::vector<std::pair<std::byte*, std::size_t>> m_chunks;
+        std::byte* p_current = nullptr;
+        std::byte* p_end = nullptr;
+        std::size_t m_next_chunk_size;
+        std::size_t m_allocated_bytes = 0;
+        std::size_t m_reserved_bytes = 0;
+    };
+
+    /**
+     * Allocator handing out memory from a shared arena. It can be passed to
+     * buffer<T>, u8_buffer<T> or any container, directly or through any_allocator
+     * which stores it without additional allocation.
+     *
+     * @tparam T value_type of the allocator
+     */
+    template <class T>
+    class arena_allocator
+    {
+    public:
+
+        using value_type = T;
+
+        explicit arena_allocator(std::shared_ptr<arena> a)
+            : m_arena(std::move(a))
+        {
+            SPARROW_ASSERT_TRUE(m_arena != nullptr);
+        }
+
+        // No move constructor on purpose: a moved-from allocator must still be
+        // able to deallocate, so moving copies the reference on the arena.
+        arena_allocator(const arena_allocator&) noexcept = default;
+        arena_allocator& operator=(const arena_allocator&) noexcept = default;
+
+        template <class U>
+        arena_allocator(const arena_allocator<U>& rhs) noexcept
+            : m_arena(rhs.get_arena())
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            m_arena->deallocate(p, n * sizeof(T));
+        }
+
+        [[nodiscard]] const std::shared_ptr<arena>& get_arena() const noexcept
+        {
+            return m_arena;
+        }
+
+    private:
+
+        std::shared_ptr<arena> m_arena;
+    };
+
+    template <class T, class U>
+    bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) noexcept
+    {
+        return lhs.get_arena() == rhs.get_arena();
+    }
+
+    /**
+     * @return The arena installed on the current thread by an arena_scope,
+     * or a null pointer if there is none.
+     */
+    [[nodiscard]] SPARROW_API const std::shared_ptr<arena>& current_arena() noexcept;
+
+    /**
+     * RAII object installing an arena on the current thread for its lifetime.
+     *
+     * While a scope is active, default-constructed any_allocator objects (and
+     * therefore buffers created without an explicit allocator), as well as the
+     * private data of the ArrowArray and ArrowSchema structures created by
+     * sparrow, are allocated in the arena. This allows building a whole
+     * record batch in a single memory region without threading an allocator
+     * through every constructor. Scopes can be nested, the previous arena is
+     * restored when the scope ends.
+     */
+    class arena_scope
+    {
+    public:
+
+        SPARROW_API explicit arena_scope(std::shared_ptr<arena> a);
+        SPARROW_API ~arena_scope();
+
+        arena_scope(const arena_scope&) = delete;
+        arena_scope(arena_scope&&) = delete;
+        arena_scope& operator=(const arena_scope&) = delete;
+        arena_scope& operator=(arena_scope&&) = delete;
+
+    private:
+
+        std::shared_ptr<arena> m_previous;
+    };
+
+    namespace detail
+    {
+        /*
+         * Helpers for the class-specific allocation functions of objects that can
+         * live either in the current arena or on the heap. Such objects hold a
+         * reference on the arena they were allocated in (a null pointer if they
+         * were allocated on the heap), which is released by their destroying delete.
+         */
+        [[nodiscard]] inline void* allocate_in_current_arena(std::size_t size, std::size_t alignment)
+        {
+            const std::shared_ptr<arena>& a = current_arena();
+            if (a != nullptr)
+            {
+                return a->allocate(size, alignment);
+            }
+            return ::operator new(size);
+        }
+
+        // Only called when the constructor of the object throws, the current
+        // arena is then the one the memory was allocated from.
+        inline void deallocate_in_current_arena(void* p) noexcept
+        {
+            if (current_arena() == nullptr)
+            {
+                ::operator delete(p);
+            }
+        }
+
+        template <class T>
+        void destroy_arena_allocated(T* p, std::shared_ptr<arena>& owner) noexcept
+        {
+            const std::shared_ptr<arena> keep_alive = std::move(owner);
+            p->~T();
+            if (keep_alive == nullptr)
+            {
+                ::operator delete(p);
+            }
+        }
+    }
+
+    /*******************************
+     * arena implementation        *
+     *******************************/
+
+    inline arena::arena(std::size_t initial_chunk_size)
+        : m_next_chunk_size(std::max(initial_chunk_size, std::size_t(64)))
+    {
+    }
+
+    inline arena::~arena()
+    {
+        for (const auto& [chunk, size] : m_chunks)
+        {
+            ::operator delete(chunk, size);
+        }
+    }
+
+    inline void* arena::allocate(std::size_t size, std::size_t alignment)
+    {
+        SPARROW_ASSERT_TRUE(std::has_single_bit(alignment));
+        const auto padding_of = [alignment](const std::byte* p)
+        {
+            const auto current = reinterpret_cast<std::uintptr_t>(p);
+            return static_cast<std::size_t>((alignment - (current % alignment)) % alignment);
+        };
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::size_t padding = padding_of(p_current);
+        if (p_current == nullptr || padding + size > static_cast<std::size_t>(p_end - p_current))
+        {
+            add_chunk(size + alignment);
+            padding = padding_of(p_current);
+        }
+        std::byte* res = p_current + padding;
+        p_current = res + size;
+        m_allocated_bytes += padding + size;
+        return res;
+    }
+
+    inline void arena::deallocate(void* p, std::size_t size) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto* block = static_cast<std::byte*>(p);
+        if (block != nullptr && block + size == p_current)
+        {
+            p_current = block;
+            m_allocated_bytes -= size;
+        }
+    }
+
+    inline std::size_t arena::allocated_bytes() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_allocated_bytes;
+    }
+
+    inline std::size_t arena::reserved_bytes() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_reserved_bytes;
+    }
+
+    inline void arena::add_chunk(std::size_t min_size)
+    {
+        const std::size_t chunk_size = std::max(m_next_chunk_size, min_size);
+        auto* chunk = static_cast<std::byte*>(::operator new(chunk_size));
+        m_chunks.emplace_back(chunk, chunk_size);
+        p_current = chunk;
+        p_end = chunk + chunk_size;
+        m_reserved_bytes += chunk_size;
+        m_next_chunk_size = chunk_size * 2;
+    }
+}
@@ -252,9 +252,10 @@ namespace sparrow
         constexpr void resize(size_type new_size, const value_type& value);
         constexpr void swap(buffer& rhs) noexcept;
 
+        using base_type::get_allocator;
+
     private:
 
-        using base_type::get_allocator;
         using base_type::get_data;
 
         template <class F>
@@ -347,7 +348,11 @@ namespace sparrow
     template <class T>
     buffer_base<T>::~buffer_base()
     {
-        deallocate(m_data.p_begin, static_cast<size_type>(m_data.p_storage_end - m_data.p_begin));
+        // A moved-from buffer has no storage, and its allocator may have been moved too
+        if (m_data.p_begin != nullptr)
+        {
+            deallocate(m_data.p_begin, static_cast<size_type>(m_data.p_storage_end - m_data.p_begin));
+        }
     }
 
     template <class T>
@@ -397,7 +402,8 @@ namespace sparrow
     template <class T>
     constexpr void buffer_base<T>::create_storage(size_type n)
     {
-        m_data.p_begin = allocate(n);
+        // Empty buffers have no storage, like default constructed ones
+        m_data.p_begin = n != 0 ? allocate(n) : nullptr;
         m_data.p_end = m_data.p_begin + n;
         m_data.p_storage_end = m_data.p_begin + n;
     }
@@ -476,7 +482,7 @@ namespace sparrow
 
     template <class T>
     buffer<T>::buffer(const buffer& rhs)
-        : base_type(rhs.size(), rhs.get_allocator())
+        : base_type(rhs.size(), alloc_traits::select_on_container_copy_construction(rhs.get_allocator()))
     {
         get_data().p_end = copy_initialize(rhs.begin(), rhs.end(), get_data().p_begin, get_allocator());
     }
@@ -62,6 +62,14 @@ namespace sparrow
         constexpr dynamic_bitset(block_type* p, size_type n);
         constexpr dynamic_bitset(block_type* p, size_type n, size_type null_count);
 
+        /**
+         * Constructs a bitset of \c n bits stored in \c buffer, which must
+         * hold at least \c compute_block_count(n) blocks, or be empty. In the
+         * latter case, all the bits are set and the blocks are allocated on
+         * the first write that resets a bit.
+         */
+        constexpr dynamic_bitset(storage_type buffer, size_type n);
+
         constexpr ~dynamic_bitset() = default;
         constexpr dynamic_bitset(const dynamic_bitset&) = default;
         constexpr dynamic_bitset(dynamic_bitset&&) noexcept = default;
@@ -112,17 +120,32 @@ namespace sparrow
     {
     }
 
+    template <std::integral T>
+    constexpr dynamic_bitset<T>::dynamic_bitset(storage_type buffer, size_type n)
+        : base_type(std::move(buffer), n)
+    {
+        SPARROW_ASSERT_TRUE(this->buffer().empty() || this->buffer().size() >= this->compute_block_count(n));
+    }
+
     using validity_bitmap = dynamic_bitset<std::uint8_t>;
 
     namespace detail
     {
         using validity_bitmap = sparrow::validity_bitmap;
 
+        // Bitmap of \c size valid elements, without storage: arrays without
+        // null elements do not allocate a validity buffer until a null
+        // element is written.
+        inline validity_bitmap make_all_valid_bitmap(std::size_t size)
+        {
+            return validity_bitmap(validity_bitmap::storage_type(), size);
+        }
+
         inline validity_bitmap ensure_validity_bitmap_impl(std::size_t size, const validity_bitmap& bitmap)
         {
             if (bitmap.size() == 0)
             {
-                return validity_bitmap(size, true);
+                return make_all_valid_bitmap(size);
             }
             return bitmap;  // copy
         }
@@ -131,7 +154,7 @@ namespace sparrow
         {
             if (bitmap.size() == 0)
             {
-                bitmap.resize(size, true);
+                return make_all_valid_bitmap(size);
             }
             return std::move(bitmap);
         }
@@ -142,7 +165,7 @@ namespace sparrow
         validity_bitmap ensure_validity_bitmap_impl(std::size_t size, R&& range)
         {
             SPARROW_ASSERT_TRUE(size == range_size(range) || range_size(range) == 0);
-            validity_bitmap bitmap(size, true);
+            validity_bitmap bitmap = make_all_valid_bitmap(size);
             std::size_t i = 0;
             for (auto value : range)
             {
@@ -160,7 +183,7 @@ namespace sparrow
             requires(std::unsigned_integral<std::ranges::range_value_t<R>> && !std::same_as<std::ranges::range_value_t<R>, bool> && !std::same_as<std::decay_t<R>, validity_bitmap>)
         validity_bitmap ensure_validity_bitmap_impl(std::size_t size, R&& range_of_indices)
         {
-            validity_bitmap bitmap(size, true);
+            validity_bitmap bitmap = make_all_valid_bitmap(size);
             for (auto index : range_of_indices)
             {
                 bitmap.set(index, false);
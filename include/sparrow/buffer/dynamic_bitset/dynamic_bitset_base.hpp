@@ -15,14 +15,20 @@
 #pragma once
 
 
+#include <algorithm>
 #include <bit>
+#include <concepts>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 
+#include "sparrow/buffer/buffer_view.hpp"
 #include "sparrow/buffer/dynamic_bitset/bitset_iterator.hpp"
 #include "sparrow/buffer/dynamic_bitset/bitset_reference.hpp"
+#include "sparrow/utils/bit.hpp"
 #include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/mp_utils.hpp"
 
 namespace sparrow
 {
@@ -35,6 +41,10 @@ namespace sparrow
      * is that the former holds and manages its memory while
      * the second does not.
      *
+     * A bitset may have no storage, in which case all its bits are set.
+     * Bitsets whose storage can be resized allocate it when a bit is reset
+     * or when a mutable reference to a bit is requested.
+     *
      * @tparam B the underlying storage
      */
     template <typename B>
@@ -111,8 +121,36 @@ namespace sparrow
             }
         }
 
+        /**
+         * Calls \c func for each maximal run of consecutive bits sharing the same
+         * value, in increasing order. \c func is called with the index of the first
+         * bit of the run, the length of the run and the value of its bits.
+         * Bits are inspected 64 at a time, so that words that do not end the
+         * current run are skipped in one step.
+         */
+        template <std::invocable<size_type, size_type, bool> F>
+        constexpr void visit_runs(F&& func) const;
+
+        /**
+         * Calls \c func with the index of each set bit, in increasing order.
+         * Words that are entirely unset are skipped, and words that are entirely
+         * set are visited with a dense loop that does not test individual bits.
+         */
+        template <std::invocable<size_type> F>
+        constexpr void visit_set_indices(F&& func) const;
+
         [[nodiscard]] static constexpr size_type compute_block_count(size_type bits_count) noexcept;
 
+        // Views cannot allocate a storage and must have one to be written
+        static constexpr bool can_allocate_storage = !mpl::is_type_instance_of_v<storage_type, buffer_view>;
+
+        /**
+         * Allocates the blocks of a bitset without storage, all its bits
+         * being set. Does nothing if the bitset already has storage.
+         */
+        constexpr void allocate_storage()
+            requires can_allocate_storage;
+
         // storage_type is a value_type
         [[nodiscard]] storage_type extract_storage() noexcept
             requires std::same_as<storage_type, storage_type_without_cvrefpointer>
@@ -150,15 +188,34 @@ namespace sparrow
     private:
 
         static constexpr std::size_t s_bits_per_block = sizeof(block_type) * CHAR_BIT;
+
+        using word_type = std::uint64_t;
+        static constexpr size_type s_bits_per_word = sizeof(word_type) * CHAR_BIT;
+        static_assert(s_bits_per_word % s_bits_per_block == 0, "block_type must not be wider than 64 bits");
+
+        [[nodiscard]] constexpr size_type word_count() const noexcept;
+        [[nodiscard]] constexpr size_type word_bit_count(size_type word_index) const noexcept;
+        [[nodiscard]] constexpr word_type load_word(size_type word_index) const noexcept;
         [[nodiscard]] static constexpr size_type block_index(size_type pos) noexcept;
         [[nodiscard]] static constexpr size_type bit_index(size_type pos) noexcept;
         [[nodiscard]] static constexpr block_type bit_mask(size_type pos) noexcept;
 
         [[nodiscard]] size_type count_non_null() const noexcept;
+        [[nodiscard]] size_type count_non_null(size_type first, size_type last) const noexcept;
+        [[nodiscard]] static size_type count_blocks_non_null(const block_type* blocks, size_type count) noexcept;
         [[nodiscard]] constexpr size_type count_extra_bits() const noexcept;
         constexpr void zero_unused_bits();
         constexpr void update_null_count(bool old_value, bool new_value);
 
+        // Allocates the storage before a write if possible
+        constexpr void ensure_storage();
+
+        // A view may cover a prefix of a bitmap whose last block is shared
+        // with elements outside of it (e.g. a slice of a shared buffer),
+        // so only bitsets that own their storage clear the padding bits.
+        static constexpr bool owns_trailing_bits = !std::is_const_v<block_type>
+                                                   && !mpl::is_type_instance_of_v<storage_type, buffer_view>;
+
         storage_type m_buffer;
         size_type m_size;
         size_type m_null_count;
@@ -194,7 +251,7 @@ namespace sparrow
     constexpr auto dynamic_bitset_base<B>::operator[](size_type pos) -> reference
     {
         SPARROW_ASSERT_TRUE(pos < size());
-        SPARROW_ASSERT_TRUE(data() != nullptr);
+        ensure_storage();
         return reference(*this, buffer().data()[block_index(pos)], bit_mask(pos));
     }
 
@@ -222,7 +279,14 @@ namespace sparrow
     constexpr void dynamic_bitset_base<B>::set(size_type pos, value_type value)
     {
         SPARROW_ASSERT_TRUE(pos < size());
-        SPARROW_ASSERT_TRUE(data() != nullptr);
+        if (data() == nullptr)
+        {
+            if (value)
+            {
+                return;
+            }
+            ensure_storage();
+        }
         block_type& block = buffer().data()[block_index(pos)];
         const bool old_value = block & bit_mask(pos);
         if (value)
@@ -271,15 +335,14 @@ namespace sparrow
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
     constexpr auto dynamic_bitset_base<B>::begin() -> iterator
     {
-        return iterator(this, data(), 0u);
+        return iterator(this, 0u);
     }
 
     template <typename B>
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
     constexpr auto dynamic_bitset_base<B>::end() -> iterator
     {
-        block_type* block = buffer().size() ? data() + buffer().size() - 1 : data();
-        return iterator(this, block, size() % s_bits_per_block);
+        return iterator(this, size());
     }
 
     template <typename B>
@@ -300,15 +363,14 @@ namespace sparrow
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
     constexpr auto dynamic_bitset_base<B>::cbegin() const -> const_iterator
     {
-        return const_iterator(this, data(), 0u);
+        return const_iterator(this, 0u);
     }
 
     template <typename B>
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
     constexpr auto dynamic_bitset_base<B>::cend() const -> const_iterator
     {
-        const block_type* block = buffer().size() ? data() + buffer().size() - 1 : data();
-        return const_iterator(this, block, size() % s_bits_per_block);
+        return const_iterator(this, size());
     }
 
     template <typename B>
@@ -386,7 +448,7 @@ namespace sparrow
         , m_size(size)
         , m_null_count(m_size - count_non_null())
     {
-        if constexpr (!std::is_const_v<block_type>)
+        if constexpr (owns_trailing_bits)
         {
             zero_unused_bits();
         }
@@ -399,13 +461,112 @@ namespace sparrow
         , m_size(size)
         , m_null_count(null_count)
     {
-        if constexpr (!std::is_const_v<block_type>)
+        if constexpr (owns_trailing_bits)
         {
             zero_unused_bits();
+        }
+        if constexpr (!std::is_const_v<block_type>)
+        {
             SPARROW_ASSERT_TRUE(m_null_count == m_size - count_non_null());
         }
     }
 
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    template <std::invocable<typename dynamic_bitset_base<B>::size_type, typename dynamic_bitset_base<B>::size_type, bool> F>
+    constexpr void dynamic_bitset_base<B>::visit_runs(F&& func) const
+    {
+        if (m_size == 0)
+        {
+            return;
+        }
+        if (data() == nullptr || m_null_count == 0)
+        {
+            func(size_type(0), m_size, true);
+            return;
+        }
+        if (m_null_count == m_size)
+        {
+            func(size_type(0), m_size, false);
+            return;
+        }
+
+        size_type run_start = 0;
+        bool run_value = test(0);
+        const size_type words = word_count();
+        for (size_type w = 0; w < words; ++w)
+        {
+            const size_type bit_count = word_bit_count(w);
+            const word_type mask = bit_count == s_bits_per_word ? ~word_type(0)
+                                                                : (word_type(1) << bit_count) - 1;
+            const word_type word = load_word(w);
+            if (word == (run_value ? mask : word_type(0)))
+            {
+                continue;
+            }
+
+            const size_type word_start = w * s_bits_per_word;
+            size_type pos = 0;
+            while (pos < bit_count)
+            {
+                const word_type changes = ((run_value ? ~word : word) & mask) >> pos;
+                if (changes == 0)
+                {
+                    break;
+                }
+                pos += static_cast<size_type>(std::countr_zero(changes));
+                func(run_start, word_start + pos - run_start, run_value);
+                run_start = word_start + pos;
+                run_value = !run_value;
+            }
+        }
+        func(run_start, m_size - run_start, run_value);
+    }
+
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    template <std::invocable<typename dynamic_bitset_base<B>::size_type> F>
+    constexpr void dynamic_bitset_base<B>::visit_set_indices(F&& func) const
+    {
+        if (data() == nullptr || m_null_count == 0)
+        {
+            for (size_type i = 0; i < m_size; ++i)
+            {
+                func(i);
+            }
+            return;
+        }
+        if (m_null_count == m_size)
+        {
+            return;
+        }
+
+        const size_type words = word_count();
+        for (size_type w = 0; w < words; ++w)
+        {
+            word_type word = load_word(w);
+            if (word == 0)
+            {
+                continue;
+            }
+            const size_type word_start = w * s_bits_per_word;
+            const size_type bit_count = word_bit_count(w);
+            if (bit_count == s_bits_per_word ? word == ~word_type(0) : word == (word_type(1) << bit_count) - 1)
+            {
+                for (size_type i = word_start; i < word_start + bit_count; ++i)
+                {
+                    func(i);
+                }
+                continue;
+            }
+            while (word != 0)
+            {
+                func(word_start + static_cast<size_type>(std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
     template <typename B>
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
     constexpr auto dynamic_bitset_base<B>::compute_block_count(size_type bits_count) noexcept -> size_type
@@ -435,6 +596,41 @@ namespace sparrow
         return static_cast<block_type>(block_type(1) << bit);
     }
 
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    constexpr auto dynamic_bitset_base<B>::word_count() const noexcept -> size_type
+    {
+        return m_size / s_bits_per_word + static_cast<size_type>(m_size % s_bits_per_word != 0);
+    }
+
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    constexpr auto dynamic_bitset_base<B>::word_bit_count(size_type word_index) const noexcept -> size_type
+    {
+        return std::min(s_bits_per_word, m_size - word_index * s_bits_per_word);
+    }
+
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    constexpr auto dynamic_bitset_base<B>::load_word(size_type word_index) const noexcept -> word_type
+    {
+        constexpr size_type blocks_per_word = s_bits_per_word / s_bits_per_block;
+        const size_type first_block = word_index * blocks_per_word;
+        const size_type last_block = std::min(first_block + blocks_per_word, block_count());
+        const block_type* blocks = data();
+        word_type word = 0;
+        for (size_type i = first_block; i < last_block; ++i)
+        {
+            word |= static_cast<word_type>(blocks[i]) << ((i - first_block) * s_bits_per_block);
+        }
+        const size_type bit_count = word_bit_count(word_index);
+        if (bit_count < s_bits_per_word)
+        {
+            word &= (word_type(1) << bit_count) - 1;
+        }
+        return word;
+    }
+
     template <typename B>
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
     auto dynamic_bitset_base<B>::count_non_null() const noexcept -> size_type
@@ -448,21 +644,69 @@ namespace sparrow
             return 0u;
         }
 
-        int res = 0;
-        size_t full_blocks = m_size / s_bits_per_block;
-        for (size_t i = 0; i < full_blocks; ++i)
-        {
-            res += std::popcount(buffer().data()[i]);
-        }
+        const size_t full_blocks = m_size / s_bits_per_block;
+        size_type res = count_blocks_non_null(buffer().data(), full_blocks);
         if (full_blocks != buffer().size())
         {
             const size_t bits_count = m_size % s_bits_per_block;
             const block_type mask = ~block_type(~block_type(0) << bits_count);
             const block_type block = buffer().data()[full_blocks] & mask;
-            res += std::popcount(block);
+            res += static_cast<size_type>(std::popcount(block));
+        }
+
+        return res;
+    }
+
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    auto dynamic_bitset_base<B>::count_non_null(size_type first, size_type last) const noexcept -> size_type
+    {
+        SPARROW_ASSERT_TRUE(first <= last);
+        SPARROW_ASSERT_TRUE(last <= m_size);
+        if (data() == nullptr)
+        {
+            return last - first;
+        }
+        if (first == last)
+        {
+            return 0u;
+        }
+
+        const block_type* blocks = buffer().data();
+        size_type first_block = block_index(first);
+        const size_type last_block = block_index(last);
+        const block_type first_mask = block_type(~block_type(0) << bit_index(first));
+        const block_type last_mask = block_type(~block_type(~block_type(0) << bit_index(last)));
+
+        if (first_block == last_block)
+        {
+            return static_cast<size_type>(std::popcount(block_type(blocks[first_block] & first_mask & last_mask)));
         }
 
-        return static_cast<size_t>(res);
+        size_type res = 0;
+        if (bit_index(first) != 0)
+        {
+            res += static_cast<size_type>(std::popcount(block_type(blocks[first_block] & first_mask)));
+            ++first_block;
+        }
+        res += count_blocks_non_null(blocks + first_block, last_block - first_block);
+        if (bit_index(last) != 0)
+        {
+            res += static_cast<size_type>(std::popcount(block_type(blocks[last_block] & last_mask)));
+        }
+        return res;
+    }
+
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    auto dynamic_bitset_base<B>::count_blocks_non_null(const block_type* blocks, size_type count) noexcept
+        -> size_type
+    {
+        // Whole blocks are counted byte-wise, which does not depend on the
+        // endianness and allows the vectorized implementation to kick in.
+        return static_cast<size_type>(
+            count_set_bits(reinterpret_cast<const std::uint8_t*>(blocks), count * sizeof(block_type))
+        );
     }
 
     template <typename B>
@@ -501,14 +745,58 @@ namespace sparrow
         }
     }
 
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    constexpr void dynamic_bitset_base<B>::allocate_storage()
+        requires can_allocate_storage
+    {
+        if (data() == nullptr && m_size != 0)
+        {
+            buffer().resize(compute_block_count(m_size), block_type(~block_type(0)));
+            zero_unused_bits();
+        }
+    }
+
+    template <typename B>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    constexpr void dynamic_bitset_base<B>::ensure_storage()
+    {
+        if constexpr (can_allocate_storage)
+        {
+            allocate_storage();
+        }
+        SPARROW_ASSERT_TRUE(data() != nullptr || m_size == 0);
+    }
+
     template <typename B>
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
     constexpr void dynamic_bitset_base<B>::resize(size_type n, value_type b)
     {
+        if (data() == nullptr)
+        {
+            // Without storage, every bit is set: the storage is only needed
+            // to append unset bits
+            if (b || n <= m_size)
+            {
+                m_size = n;
+                return;
+            }
+            allocate_storage();
+        }
+
         const size_type old_block_count = buffer().size();
         const size_type new_block_count = compute_block_count(n);
         const block_type value = b ? block_type(~block_type(0)) : block_type(0);
 
+        if (n < m_size)
+        {
+            m_null_count -= (m_size - n) - count_non_null(n, m_size);
+        }
+        else if (!b)
+        {
+            m_null_count += n - m_size;
+        }
+
         if (new_block_count != old_block_count)
         {
             buffer().resize(new_block_count, value);
@@ -524,7 +812,6 @@ namespace sparrow
         }
 
         m_size = n;
-        m_null_count = m_size - count_non_null();
         zero_unused_bits();
     }
 
@@ -550,10 +837,18 @@ namespace sparrow
     constexpr dynamic_bitset_base<B>::iterator
     dynamic_bitset_base<B>::insert(const_iterator pos, size_type count, value_type value)
     {
-        SPARROW_ASSERT_TRUE(data() != nullptr);
         SPARROW_ASSERT_TRUE(cbegin() <= pos);
         SPARROW_ASSERT_TRUE(pos <= cend());
         const auto index = static_cast<size_type>(std::distance(cbegin(), pos));
+        if (data() == nullptr)
+        {
+            if (value)
+            {
+                m_size += count;
+                return iterator(this, index);
+            }
+            ensure_storage();
+        }
         const size_type old_size = size();
         const size_type new_size = old_size + count;
 
@@ -571,8 +866,7 @@ namespace sparrow
             set(index + i, value);
         }
 
-        auto block = data() + block_index(index);
-        return iterator(this, block, bit_index(index));
+        return iterator(this, index);
     }
 
     template <typename B>
@@ -581,10 +875,10 @@ namespace sparrow
     constexpr dynamic_bitset_base<B>::iterator
     dynamic_bitset_base<B>::insert(const_iterator pos, InputIt first, InputIt last)
     {
-        SPARROW_ASSERT_TRUE(data() != nullptr);
         SPARROW_ASSERT_TRUE(cbegin() <= pos);
         SPARROW_ASSERT_TRUE(pos <= cend());
         const auto index = static_cast<size_type>(std::distance(cbegin(), pos));
+        ensure_storage();
         const size_type old_size = size();
         const size_type count = static_cast<size_type>(std::distance(first, last));
         const size_type new_size = old_size + count;
@@ -603,8 +897,7 @@ namespace sparrow
             set(index + i, *first++);
         }
 
-        auto block = data() + block_index(index);
-        return iterator(this, block, bit_index(index));
+        return iterator(this, index);
     }
 
     template <typename B>
@@ -630,12 +923,16 @@ namespace sparrow
     constexpr dynamic_bitset_base<B>::iterator
     dynamic_bitset_base<B>::erase(const_iterator first, const_iterator last)
     {
-        SPARROW_ASSERT_TRUE(data() != nullptr);
         SPARROW_ASSERT_TRUE(cbegin() <= first);
         SPARROW_ASSERT_TRUE(first <= last);
         SPARROW_ASSERT_TRUE(last <= cend());
 
         const auto first_index = static_cast<size_type>(std::distance(cbegin(), first));
+        if (data() == nullptr)
+        {
+            m_size -= static_cast<size_type>(std::distance(first, last));
+            return iterator(this, first_index);
+        }
 
         if (last == cend())
         {
@@ -656,8 +953,7 @@ namespace sparrow
 
         resize(size() - count);
 
-        auto block = data() + block_index(first_index);
-        return iterator(this, block, bit_index(first_index));
+        return iterator(this, first_index);
     }
 
     template <typename B>
@@ -0,0 +1,152 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    /**
+     * Contiguous memory owned by an external entity, such as a memory-mapped
+     * file or a block read from a stream. Buffers can adopt parts of a region
+     * without copying them through a region_allocator, which keeps the region
+     * alive as long as they reference it.
+     *
+     * Derived classes release the memory in their destructor.
+     */
+    class memory_region
+    {
+    public:
+
+        virtual ~memory_region() = default;
+
+        memory_region(const memory_region&) = delete;
+        memory_region(memory_region&&) = delete;
+        memory_region& operator=(const memory_region&) = delete;
+        memory_region& operator=(memory_region&&) = delete;
+
+        [[nodiscard]] std::byte* data() noexcept
+        {
+            return p_data;
+        }
+
+        [[nodiscard]] const std::byte* data() const noexcept
+        {
+            return p_data;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        /**
+         * @return true if \c p points inside the region.
+         */
+        [[nodiscard]] bool contains(const void* p) const noexcept
+        {
+            const auto* b = static_cast<const std::byte*>(p);
+            return std::greater_equal<>{}(b, p_data) && std::less<>{}(b, p_data + m_size);
+        }
+
+    protected:
+
+        memory_region() = default;
+
+        memory_region(std::byte* data, std::size_t size) noexcept
+            : p_data(data)
+            , m_size(size)
+        {
+        }
+
+        void reset(std::byte* data, std::size_t size) noexcept
+        {
+            p_data = data;
+            m_size = size;
+        }
+
+    private:
+
+        std::byte* p_data = nullptr;
+        std::size_t m_size = 0;
+    };
+
+    /**
+     * Allocator for buffers adopting memory from a memory_region. Memory inside
+     * the region is never deallocated, the region is released when the last
+     * allocator referencing it is destroyed. Memory allocated by the allocator
+     * itself (for instance when a buffer adopting a part of the region grows)
+     * comes from std::allocator.
+     *
+     * @tparam T value_type of the allocator
+     */
+    template <class T>
+    class region_allocator
+    {
+    public:
+
+        using value_type = T;
+
+        explicit region_allocator(std::shared_ptr<memory_region> region)
+            : m_region(std::move(region))
+        {
+            SPARROW_ASSERT_TRUE(m_region != nullptr);
+        }
+
+        // No move constructor on purpose: a moved-from allocator must still be
+        // able to deallocate, so moving copies the reference on the region.
+        region_allocator(const region_allocator&) noexcept = default;
+        region_allocator& operator=(const region_allocator&) noexcept = default;
+
+        template <class U>
+        region_allocator(const region_allocator<U>& rhs) noexcept
+            : m_region(rhs.get_region())
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n)
+        {
+            if (!m_region->contains(p))
+            {
+                std::allocator<T>().deallocate(p, n);
+            }
+        }
+
+        [[nodiscard]] const std::shared_ptr<memory_region>& get_region() const noexcept
+        {
+            return m_region;
+        }
+
+    private:
+
+        std::shared_ptr<memory_region> m_region;
+    };
+
+    template <class T, class U>
+    bool operator==(const region_allocator<T>& lhs, const region_allocator<U>& rhs) noexcept
+    {
+        return lhs.get_region() == rhs.get_region();
+    }
+}
@@ -18,6 +18,7 @@
 #include <ranges>
 #include <type_traits>
 
+#include "sparrow/buffer/buffer.hpp"
 #include "sparrow/buffer/buffer_adaptor.hpp"
 #include "sparrow/utils/ranges.hpp"
 
@@ -78,11 +79,15 @@ namespace sparrow
         u8_buffer& operator=(u8_buffer&& other) = delete;
         u8_buffer& operator=(u8_buffer& other) = delete;
 
-        u8_buffer(std::size_t n, const T& val = T{});
-        template <std::ranges::input_range R>
+        template <allocator A = typename buffer<std::uint8_t>::allocator_type>
+        u8_buffer(std::size_t n, const T& val = T{}, const A& a = A());
+
+        template <std::ranges::input_range R, allocator A = typename buffer<std::uint8_t>::allocator_type>
             requires(!std::same_as<u8_buffer<T>, std::decay_t<R>> && std::convertible_to<std::ranges::range_value_t<R>, T>)
-        u8_buffer(R&& range);
-        u8_buffer(std::initializer_list<T> ilist);
+        u8_buffer(R&& range, const A& a = A());
+
+        template <allocator A = typename buffer<std::uint8_t>::allocator_type>
+        u8_buffer(std::initializer_list<T> ilist, const A& a = A());
     };
 
     template <class T>
@@ -100,27 +105,29 @@ namespace sparrow
     }
 
     template <class T>
-    u8_buffer<T>::u8_buffer(std::size_t n, const T& val)
-        : holder_type{n * sizeof(T)}
+    template <allocator A>
+    u8_buffer<T>::u8_buffer(std::size_t n, const T& val, const A& a)
+        : holder_type{n * sizeof(T), a}
         , buffer_adaptor_type(holder_type::value)
     {
         std::fill(this->begin(), this->end(), val);
     }
 
     template <class T>
-    template <std::ranges::input_range R>
+    template <std::ranges::input_range R, allocator A>
         requires(!std::same_as<u8_buffer<T>, std::decay_t<R>>
                  && std::convertible_to<std::ranges::range_value_t<R>, T>)
-    u8_buffer<T>::u8_buffer(R&& range)
-        : holder_type{range_size(range) * sizeof(T)}
+    u8_buffer<T>::u8_buffer(R&& range, const A& a)
+        : holder_type{range_size(range) * sizeof(T), a}
         , buffer_adaptor_type(holder_type::value)
     {
         std::ranges::copy(range, this->begin());
     }
 
     template <class T>
-    u8_buffer<T>::u8_buffer(std::initializer_list<T> ilist)
-        : holder_type{ilist.size() * sizeof(T)}
+    template <allocator A>
+    u8_buffer<T>::u8_buffer(std::initializer_list<T> ilist, const A& a)
+        : holder_type{ilist.size() * sizeof(T), a}
         , buffer_adaptor_type(holder_type::value)
     {
         std::copy(ilist.begin(), ilist.end(), this->begin());
@@ -15,7 +15,6 @@
 
 #pragma once
 
-#include <map>
 #include <ranges>
 #include <tuple>
 #include <type_traits>
@@ -24,8 +23,8 @@
 
 #include "sparrow/array.hpp"
 #include "sparrow/builder/builder_utils.hpp"
+#include "sparrow/builder/dictionary_encoder.hpp"
 #include "sparrow/builder/nested_eq.hpp"
-#include "sparrow/builder/nested_less.hpp"
 #include "sparrow/layout/dictionary_encoded_array.hpp"
 #include "sparrow/layout/fixed_width_binary_array.hpp"
 #include "sparrow/layout/list_layout/list_array.hpp"
@@ -469,30 +468,16 @@ namespace sparrow
             [[nodiscard]] static type create(U&& t)
             {
                 const auto input_size = range_size(t);
-                key_type key = 0;
-                std::map<raw_range_value_type, key_type, nested_less<raw_range_value_type>> value_map;
-                std::vector<raw_range_value_type> values;
+                dictionary_encoder<raw_range_value_type, key_type> encoder;
                 std::vector<key_type> keys;
-
-                values.reserve(input_size);
                 keys.reserve(input_size);
 
                 for (const auto& v : t)
                 {
-                    auto find_res = value_map.find(v);
-                    if (find_res == value_map.end())
-                    {
-                        value_map.insert({v, key});
-                        values.push_back(v);
-                        keys.push_back(key);
-                        ++key;
-                    }
-                    else
-                    {
-                        keys.push_back(find_res->second);
-                    }
+                    keys.push_back(encoder.encode(v));
                 }
                 auto keys_buffer = sparrow::u8_buffer<key_type>(keys);
+                std::vector<raw_range_value_type> values = encoder.extract_values();
 
                 // since we do not support dict[dict or dict[run_end
                 // we can hard code the layout policy here
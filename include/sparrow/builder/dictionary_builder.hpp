@@ -0,0 +1,126 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+
+#include "sparrow/builder/builder.hpp"
+#include "sparrow/builder/dictionary_encoder.hpp"
+
+namespace sparrow
+{
+    /**
+     * Builds a dictionary-encoded array from values received incrementally,
+     * one at a time or by batches, for instance while reading an input that
+     * does not fit in memory as plain values.
+     *
+     * Each value is encoded as soon as it is appended: only the keys and the
+     * distinct values are kept. The values are deduplicated with a hash table,
+     * so appending costs O(1) on average whatever the number of distinct
+     * values. The values can be of any type supported by the \ref builder
+     * "builder", including nullable values: nulls are stored as an entry of
+     * the dictionary, as with dict_encode.
+     *
+     * @code{.cpp}
+     * sparrow::dictionary_builder<std::string> builder;
+     * builder.append(std::vector<std::string>{"red", "green"});
+     * builder.append(std::vector<std::string>{"green", "blue"});
+     * auto arr = builder.finish();  // keys: [0, 1, 1, 2], dictionary: ["red", "green", "blue"]
+     * @endcode
+     *
+     * @tparam T the type of the values.
+     * @tparam KEY_TYPE the integral type of the keys.
+     */
+    template <class T, std::integral KEY_TYPE = std::uint64_t>
+    class dictionary_builder
+    {
+    public:
+
+        using value_type = T;
+        using key_type = KEY_TYPE;
+        using array_type = dictionary_encoded_array<KEY_TYPE>;
+
+        /**
+         * Appends a value.
+         *
+         * @exception std::overflow_error if the value is a new distinct value
+         * and key_type cannot represent its key.
+         */
+        void push_back(const T& value)
+        {
+            m_keys.push_back(m_encoder.encode(value));
+        }
+
+        /**
+         * Appends a batch of values.
+         *
+         * @exception std::overflow_error if a new distinct value gets a key
+         * that key_type cannot represent.
+         */
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, const T&>
+        void append(R&& values)
+        {
+            if constexpr (std::ranges::sized_range<R>)
+            {
+                m_keys.reserve(m_keys.size() + static_cast<std::size_t>(std::ranges::size(values)));
+            }
+            for (const T& value : values)
+            {
+                m_keys.push_back(m_encoder.encode(value));
+            }
+        }
+
+        /**
+         * @returns the number of values appended so far.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_keys.size();
+        }
+
+        /**
+         * @returns the number of distinct values appended so far.
+         */
+        [[nodiscard]] std::size_t dictionary_size() const noexcept
+        {
+            return m_encoder.size();
+        }
+
+        /**
+         * Builds the array of the values appended so far, and resets the
+         * builder.
+         */
+        [[nodiscard]] array_type finish()
+        {
+            u8_buffer<key_type> keys_buffer(m_keys);
+            m_keys.clear();
+            std::vector<T> values = m_encoder.extract_values();
+            // dict[dict or dict[run_end are not supported, the layout of the
+            // values is the plain one.
+            auto values_array = detail::build_impl<detail::dont_enforce_layout>(values, mpl::typelist<>{});
+            return array_type(std::move(keys_buffer), array(std::move(values_array)));
+        }
+
+    private:
+
+        detail::dictionary_encoder<T, key_type> m_encoder;
+        std::vector<key_type> m_keys;
+    };
+}
@@ -0,0 +1,183 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <sparrow/builder/nested_eq.hpp>
+#include <sparrow/builder/nested_hash.hpp>
+
+namespace sparrow
+{
+    namespace detail
+    {
+        /**
+         * Assigns consecutive keys to the distinct values it is given, in order
+         * of first appearance. The distinct values are stored in a vector and
+         * looked up through an open-addressing hash table (linear probing) of
+         * indices into that vector, hashed with nested_hash and compared with
+         * nested_eq. Encoding a value costs O(1) on average, with one
+         * allocation per distinct value at most (none for scalars) and the
+         * amortized growth of the vectors.
+         *
+         * @tparam T the type of the values.
+         * @tparam KEY_TYPE the integral type of the keys.
+         */
+        template <class T, std::integral KEY_TYPE = std::uint64_t>
+        class dictionary_encoder
+        {
+        public:
+
+            using value_type = T;
+            using key_type = KEY_TYPE;
+
+            /**
+             * @returns the key of \c value, which is added to the dictionary
+             * if it is not already there.
+             * @exception std::overflow_error if a new value would get a key
+             * that cannot be represented by key_type.
+             */
+            key_type encode(const T& value)
+            {
+                const std::size_t h = nested_hash<T>{}(value);
+                if (m_slots.empty())
+                {
+                    rehash(min_capacity);
+                }
+                const std::size_t mask = m_slots.size() - 1;
+                for (std::size_t pos = slot_of(h);; pos = (pos + 1) & mask)
+                {
+                    const std::size_t slot = m_slots[pos];
+                    if (slot == empty_slot)
+                    {
+                        return insert(value, h, pos);
+                    }
+                    const std::size_t index = slot - 1;
+                    if (m_hashes[index] == h && nested_eq<T>{}(m_values[index], value))
+                    {
+                        return static_cast<key_type>(index);
+                    }
+                }
+            }
+
+            /**
+             * @returns the number of distinct values.
+             */
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return m_values.size();
+            }
+
+            /**
+             * @returns the distinct values, the key of a value being its index.
+             */
+            [[nodiscard]] const std::vector<T>& values() const noexcept
+            {
+                return m_values;
+            }
+
+            /**
+             * Moves the distinct values out of the encoder and clears it.
+             */
+            [[nodiscard]] std::vector<T> extract_values()
+            {
+                std::vector<T> res = std::move(m_values);
+                clear();
+                return res;
+            }
+
+            /**
+             * Makes room for \c n distinct values without rehashing.
+             */
+            void reserve(std::size_t n)
+            {
+                m_values.reserve(n);
+                m_hashes.reserve(n);
+                if (n * 2 > m_slots.size())
+                {
+                    rehash(std::bit_ceil(std::max(n * 2, min_capacity)));
+                }
+            }
+
+            void clear()
+            {
+                m_values.clear();
+                m_hashes.clear();
+                m_slots.clear();
+            }
+
+        private:
+
+            static constexpr std::size_t empty_slot = 0;
+            static constexpr std::size_t min_capacity = 16;
+
+            // Fibonacci hashing: spreads the hashes of std::hash, which is
+            // the identity for integers with some standard libraries, on the
+            // high bits used as index.
+            [[nodiscard]] std::size_t slot_of(std::size_t h) const noexcept
+            {
+                const std::uint64_t mixed = static_cast<std::uint64_t>(h) * 0x9e3779b97f4a7c15ull;
+                return static_cast<std::size_t>(mixed >> m_shift);
+            }
+
+            key_type insert(const T& value, std::size_t h, std::size_t pos)
+            {
+                const std::size_t index = m_values.size();
+                if (index > static_cast<std::size_t>(std::numeric_limits<key_type>::max()))
+                {
+                    throw std::overflow_error("dictionary_encoder: too many distinct values for the key type");
+                }
+                m_values.push_back(value);
+                m_hashes.push_back(h);
+                m_slots[pos] = index + 1;
+                // Keeps the load factor under 1/2
+                if (m_values.size() * 2 > m_slots.size())
+                {
+                    rehash(m_slots.size() * 2);
+                }
+                return static_cast<key_type>(index);
+            }
+
+            void rehash(std::size_t capacity)
+            {
+                m_slots.assign(capacity, empty_slot);
+                m_shift = 64 - static_cast<unsigned int>(std::countr_zero(capacity));
+                const std::size_t mask = capacity - 1;
+                for (std::size_t index = 0; index < m_hashes.size(); ++index)
+                {
+                    std::size_t pos = slot_of(m_hashes[index]);
+                    while (m_slots[pos] != empty_slot)
+                    {
+                        pos = (pos + 1) & mask;
+                    }
+                    m_slots[pos] = index + 1;
+                }
+            }
+
+            std::vector<T> m_values;
+            std::vector<std::size_t> m_hashes;
+            // Index of the value + 1, or empty_slot
+            std::vector<std::size_t> m_slots;
+            unsigned int m_shift = 64;
+        };
+    }  // namespace detail
+}  // namespace sparrow
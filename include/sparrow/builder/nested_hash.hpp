@@ -0,0 +1,156 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#include <sparrow/builder/builder_utils.hpp>
+#include <sparrow/utils/ranges.hpp>
+
+namespace sparrow
+{
+    namespace detail
+    {
+        // Combines the hash of an element with the hash of the previous ones
+        [[nodiscard]] constexpr std::size_t hash_combine(std::size_t seed, std::size_t h) noexcept
+        {
+            return seed ^ (h + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+        }
+
+        // contiguous ranges of chars are hashed at once, and are equal
+        // (according to nested_eq) if they have the same characters
+        template <class T>
+        concept char_range = std::ranges::contiguous_range<T> && std::ranges::sized_range<T>
+                             && std::same_as<std::ranges::range_value_t<T>, char> && !tuple_like<T>;
+
+        // nested hash, consistent with nested_eq: values that are nested_eq
+        // have the same hash
+        template <class T>
+        struct nested_hash;
+
+        // scalars
+        template <class T>
+            requires std::is_scalar_v<T>
+        struct nested_hash<T>
+        {
+            [[nodiscard]] std::size_t operator()(const T& a) const
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    // 0.0 == -0.0
+                    if (a == T(0))
+                    {
+                        return std::hash<T>{}(T(0));
+                    }
+                }
+                return std::hash<T>{}(a);
+            }
+        };
+
+        template <is_express_layout_desire T>
+        struct nested_hash<T>
+        {
+            [[nodiscard]] std::size_t operator()(const T& a) const
+            {
+                return nested_hash<typename T::value_type>{}(a.get());
+            }
+        };
+
+        // nullables
+        template <class T>
+            requires is_nullable_like<T>
+        struct nested_hash<T>
+        {
+            [[nodiscard]] std::size_t operator()(const T& a) const
+            {
+                // all the nulls are equal, whatever the underlying value
+                if (!a.has_value())
+                {
+                    return 0;
+                }
+                return hash_combine(1, nested_hash<typename T::value_type>{}(a.value()));
+            }
+        };
+
+        // tuple like
+        template <class T>
+            requires tuple_like<T>
+        struct nested_hash<T>
+        {
+            [[nodiscard]] std::size_t operator()(const T& a) const
+            {
+                constexpr std::size_t N = std::tuple_size_v<T>;
+                std::size_t seed = N;
+                for_each_index<N>(
+                    [&](auto i)
+                    {
+                        using tuple_element_type = std::decay_t<std::tuple_element_t<decltype(i)::value, T>>;
+                        seed = hash_combine(seed, nested_hash<tuple_element_type>{}(std::get<decltype(i)::value>(a)));
+                    }
+                );
+                return seed;
+            }
+        };
+
+        // strings
+        template <char_range T>
+        struct nested_hash<T>
+        {
+            [[nodiscard]] std::size_t operator()(const T& a) const
+            {
+                return std::hash<std::string_view>{}(std::string_view(std::ranges::data(a), std::ranges::size(a)));
+            }
+        };
+
+        // ranges (and not tuple like)
+        template <class T>
+            requires(std::ranges::input_range<T> && !tuple_like<T> && !char_range<T>)
+        struct nested_hash<T>
+        {
+            [[nodiscard]] std::size_t operator()(const T& a) const
+            {
+                using value_type = std::decay_t<std::ranges::range_value_t<T>>;
+                std::size_t seed = 0;
+                for (const auto& v : a)
+                {
+                    seed = hash_combine(seed, nested_hash<value_type>{}(v));
+                }
+                return seed;
+            }
+        };
+
+        // variants
+        template <class T>
+            requires variant_like<T>
+        struct nested_hash<T>
+        {
+            [[nodiscard]] std::size_t operator()(const T& a) const
+            {
+                return std::visit(
+                    [&](const auto& a_val)
+                    {
+                        using value_type = std::decay_t<decltype(a_val)>;
+                        return hash_combine(a.index(), nested_hash<value_type>{}(a_val));
+                    },
+                    a
+                );
+            }
+        };
+    }  // namespace detail
+}  // namespace sparrow
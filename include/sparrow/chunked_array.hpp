@@ -0,0 +1,213 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/utils/iterator.hpp"
+
+namespace sparrow
+{
+    class chunked_array;
+
+    /**
+     * Random access iterator over the elements of a \ref chunked_array,
+     * moving across the boundaries of the chunks.
+     */
+    class chunked_array_iterator : public iterator_base<
+                                       chunked_array_iterator,
+                                       const array::value_type,
+                                       std::random_access_iterator_tag,
+                                       array::const_reference>
+    {
+    public:
+
+        using size_type = std::size_t;
+
+        chunked_array_iterator() = default;
+        SPARROW_API chunked_array_iterator(const chunked_array* ar, size_type index);
+
+    private:
+
+        [[nodiscard]] SPARROW_API array::const_reference dereference() const;
+        SPARROW_API void increment();
+        SPARROW_API void decrement();
+        SPARROW_API void advance(difference_type n);
+        [[nodiscard]] SPARROW_API difference_type distance_to(const chunked_array_iterator& rhs) const;
+        [[nodiscard]] SPARROW_API bool equal(const chunked_array_iterator& rhs) const;
+        [[nodiscard]] SPARROW_API bool less_than(const chunked_array_iterator& rhs) const;
+
+        const chunked_array* p_array = nullptr;
+        size_type m_index = 0;
+        size_type m_chunk = 0;
+
+        friend class iterator_access;
+    };
+
+    /**
+     * Logical array made of several arrays of the same data type, called
+     * chunks.
+     *
+     * The chunks are not copied into a contiguous array: a chunked array
+     * is the natural representation of a column that arrives as a sequence
+     * of record batches. Elements are accessed with global indices, which
+     * are mapped to chunks in O(log(nb_chunks)) through the cumulative
+     * lengths of the chunks.
+     */
+    class chunked_array
+    {
+    public:
+
+        using size_type = std::size_t;
+        using value_type = array::value_type;
+        using const_reference = array::const_reference;
+        using const_iterator = chunked_array_iterator;
+        using chunk_range = std::ranges::ref_view<const std::vector<array>>;
+
+        chunked_array() = default;
+
+        /**
+         * Constructs a @ref chunked_array from a range of arrays.
+         *
+         * @param chunks An input range of arrays.
+         * @exception std::invalid_argument if the arrays do not have the same data type.
+         */
+        template <std::ranges::input_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, array>
+        explicit chunked_array(R&& chunks);
+
+        /**
+         * @returns the number of elements in the \ref chunked_array, i.e. the
+         * sum of the sizes of its chunks.
+         */
+        [[nodiscard]] SPARROW_API size_type size() const noexcept;
+        [[nodiscard]] SPARROW_API bool empty() const noexcept;
+
+        /**
+         * @returns the data type of the chunks. The \ref chunked_array must
+         * have at least one chunk.
+         */
+        [[nodiscard]] SPARROW_API enum data_type data_type() const;
+
+        [[nodiscard]] SPARROW_API size_type nb_chunks() const noexcept;
+
+        /**
+         * @returns the chunk at the specified index. The index must be less
+         * than the number of chunks.
+         */
+        [[nodiscard]] SPARROW_API const array& chunk(size_type index) const;
+
+        /**
+         * @returns a range of the chunks of the \ref chunked_array.
+         */
+        [[nodiscard]] SPARROW_API chunk_range chunks() const;
+
+        /**
+         * @returns the index of the first element of each chunk, followed by
+         * the size of the \ref chunked_array.
+         */
+        [[nodiscard]] SPARROW_API std::span<const size_type> chunk_offsets() const noexcept;
+
+        /**
+         * Maps a global index to the index of the chunk holding the element
+         * and the index of the element in this chunk. The index must be less
+         * than the size of the \ref chunked_array.
+         */
+        [[nodiscard]] SPARROW_API std::pair<size_type, size_type> locate(size_type index) const;
+
+        /**
+         * @returns the element at the specified index, with bounds checking.
+         * @exception std::out_of_range if \c index is not less than the size.
+         */
+        [[nodiscard]] SPARROW_API const_reference at(size_type index) const;
+
+        /**
+         * @returns the element at the specified index. The index must be
+         * less than the size.
+         */
+        [[nodiscard]] SPARROW_API const_reference operator[](size_type index) const;
+
+        [[nodiscard]] SPARROW_API const_iterator begin() const;
+        [[nodiscard]] SPARROW_API const_iterator end() const;
+        [[nodiscard]] SPARROW_API const_iterator cbegin() const;
+        [[nodiscard]] SPARROW_API const_iterator cend() const;
+
+        /**
+         * Appends \c chunk to the chunks of the \ref chunked_array. The data
+         * of the chunk is not copied.
+         *
+         * @exception std::invalid_argument if the data type of \c chunk differs from
+         * the data type of the other chunks.
+         */
+        SPARROW_API void add_chunk(array chunk);
+
+    private:
+
+        SPARROW_API void check_and_index_chunks();
+
+        std::vector<array> m_chunks;
+        // m_offsets[i] is the global index of the first element of the chunk
+        // i, m_offsets.back() is the size of the chunked array.
+        std::vector<size_type> m_offsets = {0};
+
+        friend class chunked_array_iterator;
+        friend SPARROW_API chunked_array concatenate(std::span<const chunked_array> arrays);
+    };
+
+    /**
+     * Compares the elements of two \ref chunked_array objects, regardless
+     * of the way they are split into chunks.
+     */
+    SPARROW_API bool operator==(const chunked_array& lhs, const chunked_array& rhs);
+
+    /**
+     * Concatenates chunked arrays. The chunks of the result are the chunks
+     * of the \c arrays, in order; the data of the chunks is not copied and
+     * the chunk list of the result is allocated once.
+     *
+     * @exception std::invalid_argument if the arrays do not have the same data type.
+     */
+    [[nodiscard]] SPARROW_API chunked_array concatenate(std::span<const chunked_array> arrays);
+
+    /********************************
+     * chunked_array implementation *
+     ********************************/
+
+    template <std::ranges::input_range R>
+        requires std::same_as<std::ranges::range_value_t<R>, array>
+    chunked_array::chunked_array(R&& chunks)
+    {
+        if constexpr (std::ranges::sized_range<R>)
+        {
+            m_chunks.reserve(std::ranges::size(chunks));
+        }
+        if constexpr (std::is_rvalue_reference_v<R&&>)
+        {
+            std::ranges::move(chunks, std::back_inserter(m_chunks));
+        }
+        else
+        {
+            std::ranges::copy(chunks, std::back_inserter(m_chunks));
+        }
+        check_and_index_chunks();
+    }
+}
@@ -0,0 +1,522 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "sparrow/compute/compute_utils.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/decimal_array.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+#include "sparrow/layout/temporal/duration_array.hpp"
+#include "sparrow/layout/temporal/timestamp_array.hpp"
+#include "sparrow/types/data_type.hpp"
+
+// Aggregate kernels over the fixed-width layouts: primitive arrays of
+// numbers, temporal arrays and decimal arrays.
+//
+// The kernels read the data buffer and the validity bitmap of the arrays
+// directly. The bitmap is consumed 64 bits at a time: blocks without null
+// values are processed with a plain loop, blocks with some null values with
+// a branch-free masked loop, so that the compiler can vectorize both.
+
+namespace sparrow::compute
+{
+    namespace detail
+    {
+        template <class T>
+        concept chrono_value = requires { typename T::rep; } && (sizeof(T) == sizeof(typename T::rep));
+
+        /**
+         * Describes how the aggregate kernels read an array:
+         * - \c storage_type is the type of the elements of the data buffer.
+         * - \c compute_type is the type the elements are compared in.
+         * - \c accumulator_type and \c sum_type, when defined, are the types
+         *   the elements are summed in and the result of the sum, built
+         *   by \c make_sum.
+         */
+        template <class A>
+        struct aggregate_traits
+        {
+        };
+
+        template <numeric_value T>
+        struct aggregate_traits<primitive_array_impl<T>>
+        {
+            using storage_type = T;
+            using compute_type = std::conditional_t<std::same_as<T, float16_t>, float, T>;
+            using accumulator_type = std::conditional_t<
+                std::is_floating_point_v<compute_type>,
+                double,
+                std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+            using sum_type = accumulator_type;
+
+            static sum_type make_sum(const primitive_array_impl<T>&, accumulator_type acc)
+            {
+                return acc;
+            }
+        };
+
+        // Durations can be summed, dates and times of day can only be compared.
+        template <chrono_value T>
+            requires(!duration_type<T>)
+        struct aggregate_traits<primitive_array_impl<T>>
+        {
+            using storage_type = typename T::rep;
+            using compute_type = storage_type;
+        };
+
+        template <duration_type T>
+        struct aggregate_traits<primitive_array_impl<T>>
+        {
+            using storage_type = typename T::rep;
+            using compute_type = storage_type;
+            using accumulator_type = std::int64_t;
+            using sum_type = T;
+
+            static sum_type make_sum(const primitive_array_impl<T>&, accumulator_type acc)
+            {
+                return T(static_cast<storage_type>(acc));
+            }
+        };
+
+        template <timestamp_type T>
+        struct aggregate_traits<timestamp_array<T>>
+        {
+            using storage_type = typename T::duration::rep;
+            using compute_type = storage_type;
+        };
+
+        template <class T>
+        struct aggregate_traits<decimal_array<T>>
+        {
+            using storage_type = typename T::integer_type;
+            using compute_type = storage_type;
+            using accumulator_type = storage_type;
+            using sum_type = T;
+
+            static sum_type make_sum(const decimal_array<T>& ar, accumulator_type acc)
+            {
+                return T(acc, ar.scale());
+            }
+        };
+
+        template <class A>
+        using aggregate_traits_t = aggregate_traits<std::remove_cvref_t<A>>;
+    }
+
+    /**
+     * Arrays the aggregate kernels can read.
+     */
+    template <class A>
+    concept aggregatable_array = requires { typename detail::aggregate_traits_t<A>::storage_type; };
+
+    /**
+     * Arrays whose values can be summed.
+     */
+    template <class A>
+    concept summable_array = aggregatable_array<A>
+                             && requires { typename detail::aggregate_traits_t<A>::sum_type; };
+
+    /**
+     * Ranges of arrays the aggregate kernels can read, processed as the
+     * chunks of a single column.
+     */
+    template <class R>
+    concept aggregatable_chunks = std::ranges::forward_range<R>
+                                  && aggregatable_array<std::ranges::range_value_t<R>>;
+
+    template <class R>
+    concept summable_chunks = aggregatable_chunks<R> && summable_array<std::ranges::range_value_t<R>>;
+
+    /**
+     * Arrays whose values can be averaged.
+     */
+    template <class A>
+    concept averageable_array = summable_array<A>
+                                && std::is_constructible_v<double, typename detail::aggregate_traits_t<A>::sum_type>;
+
+    template <class R>
+    concept averageable_chunks = summable_chunks<R> && averageable_array<std::ranges::range_value_t<R>>;
+
+    template <summable_array A>
+    using sum_result_t = typename detail::aggregate_traits_t<A>::sum_type;
+
+    /**
+     * Which elements \ref count counts.
+     */
+    enum class count_mode
+    {
+        only_valid,
+        only_null,
+        all
+    };
+
+    template <aggregatable_array A>
+    [[nodiscard]] std::size_t count(const A& ar, count_mode mode = count_mode::only_valid);
+
+    template <aggregatable_chunks R>
+    [[nodiscard]] std::size_t count(R&& chunks, count_mode mode = count_mode::only_valid);
+
+    /**
+     * Sums the non-null values of \c ar. Integers are summed in 64-bit
+     * integers, floating point values in double, decimals in their
+     * storage type.
+     *
+     * @return The sum, or an empty optional if \c ar has no non-null value.
+     */
+    template <summable_array A>
+    [[nodiscard]] std::optional<sum_result_t<A>> sum(const A& ar);
+
+    template <summable_chunks R>
+    [[nodiscard]] std::optional<sum_result_t<std::ranges::range_value_t<R>>> sum(R&& chunks);
+
+    /**
+     * @return The mean of the non-null values of \c ar, or an empty optional
+     * if \c ar has no non-null value.
+     */
+    template <averageable_array A>
+    [[nodiscard]] std::optional<double> mean(const A& ar);
+
+    template <averageable_chunks R>
+    [[nodiscard]] std::optional<double> mean(R&& chunks);
+
+    /**
+     * @return The smallest non-null value of \c ar, or an empty optional if
+     * \c ar has no non-null value. NaN values are ignored, unless all the
+     * values are NaN.
+     */
+    template <aggregatable_array A>
+    [[nodiscard]] std::optional<typename A::inner_value_type> min(const A& ar);
+
+    template <aggregatable_chunks R>
+    [[nodiscard]] std::optional<typename std::ranges::range_value_t<R>::inner_value_type> min(R&& chunks);
+
+    /**
+     * @return The greatest non-null value of \c ar, or an empty optional if
+     * \c ar has no non-null value. NaN values are ignored, unless all the
+     * values are NaN.
+     */
+    template <aggregatable_array A>
+    [[nodiscard]] std::optional<typename A::inner_value_type> max(const A& ar);
+
+    template <aggregatable_chunks R>
+    [[nodiscard]] std::optional<typename std::ranges::range_value_t<R>::inner_value_type> max(R&& chunks);
+
+    /****************************
+     * detail implementation *
+     ****************************/
+
+    namespace detail
+    {
+        template <aggregatable_array A>
+        array_data<typename aggregate_traits_t<A>::storage_type> get_array_data(const A& ar)
+        {
+            using storage_type = typename aggregate_traits_t<A>::storage_type;
+            return make_array_data<storage_type>(sparrow::detail::array_access::get_arrow_proxy(ar));
+        }
+
+        struct count_state
+        {
+            std::size_t valid = 0;
+
+            template <class S>
+            void dense(const S*, std::size_t n)
+            {
+                valid += n;
+            }
+
+            template <class S>
+            void masked(const S*, std::uint64_t mask, std::size_t)
+            {
+                valid += static_cast<std::size_t>(std::popcount(mask));
+            }
+        };
+
+        template <class S, class Acc>
+        struct sum_state
+        {
+            Acc sum{};
+            std::size_t count = 0;
+
+            void dense(const S* values, std::size_t n)
+            {
+                Acc block{};
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    block += static_cast<Acc>(values[k]);
+                }
+                sum += block;
+                count += n;
+            }
+
+            void masked(const S* values, std::uint64_t mask, std::size_t n)
+            {
+                Acc block{};
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    block += ((mask >> k) & 1u) ? static_cast<Acc>(values[k]) : Acc{};
+                }
+                sum += block;
+                count += static_cast<std::size_t>(std::popcount(mask));
+            }
+        };
+
+        // Keeps the value v such that cmp(x, v) is false for all the values x
+        // seen, starting from an element of the array.
+        template <class S, class C, class Compare>
+        struct extremum_state
+        {
+            C value;
+            Compare cmp;
+
+            void dense(const S* values, std::size_t n)
+            {
+                C res = value;
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    const C v = static_cast<C>(values[k]);
+                    res = cmp(v, res) ? v : res;
+                }
+                value = res;
+            }
+
+            void masked(const S* values, std::uint64_t mask, std::size_t n)
+            {
+                C res = value;
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    const C v = static_cast<C>(values[k]);
+                    res = (((mask >> k) & 1u) && cmp(v, res)) ? v : res;
+                }
+                value = res;
+            }
+        };
+
+        // Finds the first valid element for which pred(value) is true
+        template <class S, class P>
+        std::optional<std::size_t> find_valid(const array_data<S>& data, P pred)
+        {
+            for (std::size_t i = 0; i < data.length; ++i)
+            {
+                const std::size_t index = data.offset + i;
+                const bool valid = data.validity == nullptr || ((data.validity[index / 8] >> (index % 8)) & 1u);
+                if (valid && pred(data.values[index]))
+                {
+                    return i;
+                }
+            }
+            return std::nullopt;
+        }
+
+        template <class A>
+        auto element_value(const A& ar, std::size_t i) -> typename A::inner_value_type
+        {
+            return typename A::inner_value_type(ar[i].get());
+        }
+
+        // Returns the element of the chunks equal to the extremum computed
+        // with cmp, or the first valid element if all the values are NaN.
+        template <class Compare, class R>
+        auto extremum(R&& chunks, Compare cmp)
+            -> std::optional<typename std::remove_cvref_t<std::ranges::range_value_t<R>>::inner_value_type>
+        {
+            using array_type = std::remove_cvref_t<std::ranges::range_value_t<R>>;
+            using traits = aggregate_traits<array_type>;
+            using storage_type = typename traits::storage_type;
+            using compute_type = typename traits::compute_type;
+
+            std::optional<extremum_state<storage_type, compute_type, Compare>> state;
+            for (const array_type& ar : chunks)
+            {
+                const auto data = get_array_data(ar);
+                if (!state.has_value())
+                {
+                    // NaN values cannot be the starting point, since they
+                    // compare false with any value.
+                    const auto first = find_valid(
+                        data,
+                        [](const storage_type& v)
+                        {
+                            return static_cast<compute_type>(v) == static_cast<compute_type>(v);
+                        }
+                    );
+                    if (!first.has_value())
+                    {
+                        continue;
+                    }
+                    state.emplace(static_cast<compute_type>(data.values[data.offset + *first]), cmp);
+                }
+                visit_validity_blocks(data, *state);
+            }
+
+            if (state.has_value())
+            {
+                const compute_type res = state->value;
+                for (const array_type& ar : chunks)
+                {
+                    const auto index = find_valid(
+                        get_array_data(ar),
+                        [res](const storage_type& v)
+                        {
+                            return static_cast<compute_type>(v) == res;
+                        }
+                    );
+                    if (index.has_value())
+                    {
+                        return element_value(ar, *index);
+                    }
+                }
+            }
+            for (const array_type& ar : chunks)
+            {
+                const auto index = find_valid(
+                    get_array_data(ar),
+                    [](const storage_type&)
+                    {
+                        return true;
+                    }
+                );
+                if (index.has_value())
+                {
+                    return element_value(ar, *index);
+                }
+            }
+            return std::nullopt;
+        }
+
+        template <class R>
+        auto sum_chunks(R&& chunks)
+        {
+            using array_type = std::remove_cvref_t<std::ranges::range_value_t<R>>;
+            using traits = aggregate_traits<array_type>;
+            sum_state<typename traits::storage_type, typename traits::accumulator_type> state;
+            for (const array_type& ar : chunks)
+            {
+                visit_validity_blocks(get_array_data(ar), state);
+            }
+            return state;
+        }
+
+        template <class R>
+        auto make_sum(R&& chunks, const typename aggregate_traits_t<std::ranges::range_value_t<R>>::accumulator_type& acc)
+        {
+            // The sum does not depend on the chunk the parameters of the
+            // result (e.g. the scale of decimals) are read from.
+            return aggregate_traits_t<std::ranges::range_value_t<R>>::make_sum(*std::ranges::begin(chunks), acc);
+        }
+    }
+
+    /***************************
+     * kernels implementation *
+     ***************************/
+
+    template <aggregatable_array A>
+    std::size_t count(const A& ar, count_mode mode)
+    {
+        return count(std::span<const A>(&ar, 1), mode);
+    }
+
+    template <aggregatable_chunks R>
+    std::size_t count(R&& chunks, count_mode mode)
+    {
+        detail::count_state state;
+        std::size_t length = 0;
+        for (const auto& ar : chunks)
+        {
+            const auto data = detail::get_array_data(ar);
+            detail::visit_validity_blocks(data, state);
+            length += data.length;
+        }
+        switch (mode)
+        {
+            case count_mode::only_valid:
+                return state.valid;
+            case count_mode::only_null:
+                return length - state.valid;
+            case count_mode::all:
+                return length;
+        }
+        return length;
+    }
+
+    template <summable_array A>
+    std::optional<sum_result_t<A>> sum(const A& ar)
+    {
+        return sum(std::span<const A>(&ar, 1));
+    }
+
+    template <summable_chunks R>
+    std::optional<sum_result_t<std::ranges::range_value_t<R>>> sum(R&& chunks)
+    {
+        const auto state = detail::sum_chunks(chunks);
+        if (state.count == 0)
+        {
+            return std::nullopt;
+        }
+        return detail::make_sum(chunks, state.sum);
+    }
+
+    template <averageable_array A>
+    std::optional<double> mean(const A& ar)
+    {
+        return mean(std::span<const A>(&ar, 1));
+    }
+
+    template <averageable_chunks R>
+    std::optional<double> mean(R&& chunks)
+    {
+        const auto state = detail::sum_chunks(chunks);
+        if (state.count == 0)
+        {
+            return std::nullopt;
+        }
+        return static_cast<double>(detail::make_sum(chunks, state.sum)) / static_cast<double>(state.count);
+    }
+
+    template <aggregatable_array A>
+    std::optional<typename A::inner_value_type> min(const A& ar)
+    {
+        return min(std::span<const A>(&ar, 1));
+    }
+
+    template <aggregatable_chunks R>
+    std::optional<typename std::ranges::range_value_t<R>::inner_value_type> min(R&& chunks)
+    {
+        return detail::extremum(std::forward<R>(chunks), std::less<>{});
+    }
+
+    template <aggregatable_array A>
+    std::optional<typename A::inner_value_type> max(const A& ar)
+    {
+        return max(std::span<const A>(&ar, 1));
+    }
+
+    template <aggregatable_chunks R>
+    std::optional<typename std::ranges::range_value_t<R>::inner_value_type> max(R&& chunks)
+    {
+        return detail::extremum(std::forward<R>(chunks), std::greater<>{});
+    }
+}
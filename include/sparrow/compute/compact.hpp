@@ -0,0 +1,90 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/compute/selection.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/variable_size_binary_view_builder.hpp"
+
+// Compaction of binary view arrays: slicing or filtering a binary view
+// array keeps all its variadic data buffers alive, even when only a few
+// of their bytes are still referenced by the views of the array.
+//
+// compact measures the bytes referenced by the valid elements in each data
+// buffer. Data buffers that are not referenced anymore are released,
+// sparse ones are rewritten: the long values they hold are copied in new
+// data buffers, and only the views of these values are updated. The other
+// data buffers are shared with the source array without being copied.
+// Identical long values can also be stored once in the result.
+
+namespace sparrow::compute
+{
+    struct compact_options
+    {
+        /**
+         * Data buffers whose referenced bytes are less than this fraction
+         * of their size are rewritten. 0 only releases the data buffers
+         * that are not referenced anymore, 1 rewrites all the data buffers
+         * that are not fully referenced.
+         */
+        double min_occupancy = 0.5;
+
+        /**
+         * Stores the identical long values copied from the rewritten data
+         * buffers once, or references them in the data buffers shared with
+         * the source array when they are already stored there.
+         */
+        bool deduplicate = false;
+
+        /**
+         * Size cap of the data buffers created by the compaction.
+         */
+        std::size_t max_data_buffer_size = variable_size_binary_view_builder::default_max_data_buffer_size;
+    };
+
+    /**
+     * @return An array with the same elements as \c ar, whose data buffers
+     * only hold the values of \c ar. \c ar is returned unchanged, sharing its
+     * buffers, when none of its data buffers is sparse.
+     * @throw std::invalid_argument if \c ar is not a string view or binary
+     * view array, or if \c options.max_data_buffer_size is 0 or greater than
+     * variable_size_binary_view_builder::max_data_buffer_size_limit.
+     */
+    template <layout_or_array A>
+    [[nodiscard]] A compact(const A& ar, const compact_options& options = {});
+
+    namespace detail
+    {
+        [[nodiscard]] SPARROW_API arrow_proxy compact(const arrow_proxy& source, const compact_options& options);
+    }
+
+    /**************************
+     * compact implementation *
+     **************************/
+
+    template <layout_or_array A>
+    A compact(const A& ar, const compact_options& options)
+    {
+        return detail::make_from_proxy<A>(
+            detail::compact(sparrow::detail::array_access::get_arrow_proxy(ar), options)
+        );
+    }
+}
@@ -0,0 +1,181 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/buffer/dynamic_bitset.hpp"
+#include "sparrow/types/data_type.hpp"
+
+// Building blocks shared by the compute kernels, to read the buffers of
+// the arrays and process their validity bitmaps 64 bits at a time.
+
+namespace sparrow::compute::detail
+{
+    template <class T>
+    concept numeric_value = (std::is_arithmetic_v<T> && !std::same_as<T, bool>) || std::same_as<T, float16_t>;
+
+    /**
+     * Raw view on the data buffer and the validity bitmap of an array.
+     * \c validity is null when the array has no null value.
+     */
+    template <class S>
+    struct array_data
+    {
+        const S* values;
+        const std::uint8_t* validity;
+        std::size_t offset;
+        std::size_t length;
+    };
+
+    template <class S>
+    array_data<S> make_array_data(const arrow_proxy& proxy, std::size_t data_buffer_index = 1)
+    {
+        const auto& buffers = proxy.buffers();
+        const std::uint8_t* validity = proxy.null_count() == 0 ? nullptr : buffers[0].data();
+        return {buffers[data_buffer_index].template data<const S>(), validity, proxy.offset(), proxy.length()};
+    }
+
+    // Bits [bit, bit + count) of the bitmap, with count <= 64. Only the bytes
+    // holding these bits are read.
+    inline std::uint64_t load_bits(const std::uint8_t* bitmap, std::size_t bit, std::size_t count)
+    {
+        const std::uint8_t* bytes = bitmap + bit / 8;
+        const std::size_t shift = bit % 8;
+        const std::size_t byte_count = (shift + count + 7) / 8;
+        std::uint64_t res = 0;
+        for (std::size_t k = 0; k < std::min(byte_count, std::size_t(8)); ++k)
+        {
+            res |= static_cast<std::uint64_t>(bytes[k]) << (8 * k);
+        }
+        res >>= shift;
+        if (byte_count > 8)
+        {
+            res |= static_cast<std::uint64_t>(bytes[8]) << (64 - shift);
+        }
+        if (count < 64)
+        {
+            res &= (std::uint64_t(1) << count) - 1u;
+        }
+        return res;
+    }
+
+    // Writes the count lowest bits of word at the beginning of bytes
+    inline void store_bits(std::uint8_t* bytes, std::uint64_t word, std::size_t count)
+    {
+        for (std::size_t k = 0; k < (count + 7) / 8; ++k)
+        {
+            bytes[k] = static_cast<std::uint8_t>(word >> (8 * k));
+        }
+    }
+
+    // Copies the bits [src_bit, src_bit + count) of src to the bits starting
+    // at dst_bit of dst. The bits of dst following dst_bit must be zero;
+    // the bits of the last byte written after the copied ones are cleared.
+    inline void copy_bits(const std::uint8_t* src, std::size_t src_bit, std::uint8_t* dst, std::size_t dst_bit, std::size_t count)
+    {
+        // Bit by bit until the destination is aligned on a byte, then by
+        // words of 64 bits shifted from the source
+        std::size_t k = 0;
+        for (; k < count && (dst_bit + k) % 8 != 0; ++k)
+        {
+            const auto bit = static_cast<std::uint8_t>((src[(src_bit + k) / 8] >> ((src_bit + k) % 8)) & 1u);
+            dst[(dst_bit + k) / 8] |= static_cast<std::uint8_t>(bit << ((dst_bit + k) % 8));
+        }
+        for (; k < count; k += 64)
+        {
+            const std::size_t n = std::min(count - k, std::size_t(64));
+            store_bits(dst + (dst_bit + k) / 8, load_bits(src, src_bit + k, n), n);
+        }
+    }
+
+    /**
+     * Splits the elements of \c data into blocks of at most 64 elements
+     * and calls, for each block:
+     * - \c f.dense(values, n) if all its elements are valid,
+     * - \c f.masked(values, mask, n) if some of them are, where bit k of
+     *   \c mask is the validity of values[k].
+     * Blocks without valid elements are skipped.
+     */
+    template <class S, class F>
+    void visit_validity_blocks(const array_data<S>& data, F& f)
+    {
+        const S* values = data.values + data.offset;
+        if (data.validity == nullptr)
+        {
+            if (data.length != 0)
+            {
+                f.dense(values, data.length);
+            }
+            return;
+        }
+
+        for (std::size_t i = 0; i < data.length; i += 64)
+        {
+            const std::size_t n = std::min(data.length - i, std::size_t(64));
+            const std::uint64_t mask = load_bits(data.validity, data.offset + i, n);
+            if (mask == 0)
+            {
+                continue;
+            }
+            if (n == 64 && mask == ~std::uint64_t(0))
+            {
+                f.dense(values + i, n);
+            }
+            else
+            {
+                f.masked(values + i, mask, n);
+            }
+        }
+    }
+
+    /**
+     * Builds the validity bitmap of the result of an element-wise kernel:
+     * element i is valid if it is valid in all of \c inputs. The bitmaps are
+     * combined one 64-bit word at a time.
+     */
+    template <class... S>
+    validity_bitmap combine_validity(std::size_t length, const array_data<S>&... inputs)
+    {
+        if (((inputs.validity == nullptr) && ...))
+        {
+            return sparrow::detail::make_all_valid_bitmap(length);
+        }
+        buffer<std::uint8_t> bytes(validity_bitmap::compute_block_count(length), std::uint8_t(0));
+        for (std::size_t i = 0; i < length; i += 64)
+        {
+            const std::size_t n = std::min(length - i, std::size_t(64));
+            std::uint64_t word = ~std::uint64_t(0);
+            (
+                [&]
+                {
+                    if (inputs.validity != nullptr)
+                    {
+                        word &= load_bits(inputs.validity, inputs.offset + i, n);
+                    }
+                }(),
+                ...
+            );
+            store_bits(bytes.data() + i / 8, word, n);
+        }
+        return validity_bitmap(std::move(bytes), length);
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/compute/selection.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/layout/array_access.hpp"
+
+// Concatenation of arrays into a single array.
+//
+// The sizes of the inputs are summed before anything is copied, so that
+// each buffer of the result is allocated once: validity bitmaps are
+// merged by shifting the bits of each input in place, offsets are rebased
+// with one addition per element, and the data of each input is copied
+// with a single memcpy. Nested layouts concatenate the ranges of their
+// children used by the inputs. Dictionary-encoded arrays whose inputs do
+// not share the same dictionary get a unified dictionary, and their keys
+// are remapped to it.
+
+namespace sparrow::compute
+{
+    /**
+     * Concatenates arrays of the same data type.
+     *
+     * @throw std::invalid_argument if \c arrays is empty or if the arrays
+     * do not have the same data type.
+     * @throw std::overflow_error if the offsets or the dictionary keys of
+     * the result do not fit in their type.
+     */
+    [[nodiscard]] SPARROW_API array concatenate(std::span<const array> arrays);
+
+    /**
+     * Concatenates typed arrays.
+     *
+     * @throw std::invalid_argument if \c arrays is empty or if the arrays
+     * do not have the same data type.
+     * @throw std::overflow_error if the offsets or the dictionary keys of
+     * the result do not fit in their type.
+     */
+    template <layout_or_array A>
+        requires(!std::same_as<A, array>)
+    [[nodiscard]] A concatenate(std::span<const A> arrays);
+
+    namespace detail
+    {
+        [[nodiscard]] SPARROW_API arrow_proxy concatenate(std::span<const arrow_proxy* const> sources);
+    }
+
+    /******************************
+     * concatenate implementation *
+     ******************************/
+
+    template <layout_or_array A>
+        requires(!std::same_as<A, array>)
+    A concatenate(std::span<const A> arrays)
+    {
+        std::vector<const arrow_proxy*> sources;
+        sources.reserve(arrays.size());
+        for (const A& ar : arrays)
+        {
+            sources.push_back(&sparrow::detail::array_access::get_arrow_proxy(ar));
+        }
+        return detail::make_from_proxy<A>(detail::concatenate(sources));
+    }
+}
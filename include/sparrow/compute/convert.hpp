@@ -0,0 +1,107 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+#include "sparrow/types/data_type.hpp"
+
+// Conversions between the offset-based layouts of strings and binaries
+// (string_array, binary_array and their 64-bit offsets counterparts) and
+// the binary view layout (string_view_array and binary_view_array).
+//
+// Neither conversion builds the values of the elements. to_view_array
+// writes the views in a single pass over the offsets: the values short
+// enough to be inlined are copied in their views, the other ones are
+// referenced in the data buffer of the source array, which becomes the
+// only data buffer of the result without being copied. to_offset_array
+// computes the offsets with a prefix sum of the lengths of the views, and
+// then copies each value at its offset in a data buffer allocated once.
+
+namespace sparrow::compute
+{
+    namespace detail
+    {
+        template <class T>
+        struct view_array_type;
+
+        template <>
+        struct view_array_type<std::string>
+        {
+            using type = string_view_array;
+        };
+
+        template <>
+        struct view_array_type<binary_traits::value_type>
+        {
+            using type = binary_view_array;
+        };
+
+        template <class T>
+        using view_array_type_t = typename view_array_type<T>::type;
+    }
+
+    /**
+     * @return The elements of \c ar in the binary view layout. The long
+     * values of the result share the data buffer of \c ar.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    [[nodiscard]] detail::view_array_type_t<T> to_view_array(const variable_size_binary_array_impl<T, CR, OT>& ar);
+
+    /**
+     * @return The elements of \c ar in the offset-based layout \c A, one of
+     * string_array, big_string_array, binary_array or big_binary_array.
+     * @throw std::length_error if the values of \c ar are too long for the
+     * offsets of \c A.
+     */
+    template <class A>
+    [[nodiscard]] A to_offset_array(const detail::view_array_type_t<typename A::inner_value_type>& ar);
+
+    namespace detail
+    {
+        [[nodiscard]] SPARROW_API arrow_proxy to_view_array(const arrow_proxy& source);
+
+        /**
+         * @param type The data type of the result: STRING, LARGE_STRING,
+         * BINARY or LARGE_BINARY.
+         */
+        [[nodiscard]] SPARROW_API arrow_proxy to_offset_array(const arrow_proxy& source, data_type type);
+    }
+
+    /**************************
+     * convert implementation *
+     **************************/
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    detail::view_array_type_t<T> to_view_array(const variable_size_binary_array_impl<T, CR, OT>& ar)
+    {
+        return detail::view_array_type_t<T>(detail::to_view_array(sparrow::detail::array_access::get_arrow_proxy(ar)));
+    }
+
+    template <class A>
+    A to_offset_array(const detail::view_array_type_t<typename A::inner_value_type>& ar)
+    {
+        return A(detail::to_offset_array(
+            sparrow::detail::array_access::get_arrow_proxy(ar),
+            sparrow::detail::get_data_type_from_array<A>::get()
+        ));
+    }
+}
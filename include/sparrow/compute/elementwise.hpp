@@ -0,0 +1,626 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/compute/compute_utils.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+#include "sparrow/types/data_traits.hpp"
+
+// Element-wise kernels over primitive arrays of numbers: arithmetic,
+// comparisons and casts.
+//
+// The kernels write the values of the result with a plain loop over the
+// data buffers, whatever the validity of the elements, so that the compiler
+// can vectorize it; the validity bitmap of the result is the bitwise AND of
+// the bitmaps of the operands, computed 64 bits at a time. The values of the
+// null elements of the result are unspecified.
+//
+// Integer arithmetic wraps around on overflow. float16 values are computed
+// in float. Casts of floating-point values to integral types are the
+// exception to the loop above: they skip the null elements and throw on the
+// values that do not fit.
+
+namespace sparrow::compute
+{
+    template <class T>
+    concept elementwise_value = detail::numeric_value<T>;
+
+    /**
+     * @return The array of the sums of the elements of \c lhs and \c rhs.
+     * @throw std::invalid_argument if \c lhs and \c rhs have different sizes.
+     */
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> add(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> add(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> add(const std::type_identity_t<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> subtract(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> subtract(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> subtract(const std::type_identity_t<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> multiply(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> multiply(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> multiply(const std::type_identity_t<T>& lhs, const primitive_array<T>& rhs);
+
+    /**
+     * Divides the elements of \c lhs by the elements of \c rhs. Integers
+     * are truncated toward zero; the division of the smallest value of a
+     * signed type by -1 wraps around.
+     *
+     * @throw std::invalid_argument if \c lhs and \c rhs have different sizes.
+     * @throw std::domain_error if an integer is divided by zero in a
+     * non-null element of the result.
+     */
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> divide(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> divide(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<T> divide(const std::type_identity_t<T>& lhs, const primitive_array<T>& rhs);
+
+    /**
+     * Comparisons of the elements of \c lhs and \c rhs. An element of the
+     * result is null if one of the compared elements is null.
+     *
+     * @throw std::invalid_argument if \c lhs and \c rhs have different sizes.
+     */
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool> equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool> equal(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool> not_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool>
+    not_equal(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool> less(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool> less(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool> less_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool>
+    less_equal(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool> greater(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool> greater(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool>
+    greater_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs);
+
+    template <elementwise_value T>
+    [[nodiscard]] primitive_array<bool>
+    greater_equal(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs);
+
+    /**
+     * Converts the elements of \c ar to \c R with \c static_cast; the null
+     * elements stay null.
+     *
+     * Floating-point values converted to an integral type are truncated; the
+     * values of the null elements are zero in that case.
+     *
+     * @throw std::overflow_error if a floating-point element converted to an
+     * integral type is not null and is NaN or out of the range of \c R once
+     * truncated.
+     */
+    template <elementwise_value R, elementwise_value T>
+    [[nodiscard]] primitive_array<R> cast(const primitive_array<T>& ar);
+
+    /****************************
+     * detail implementation *
+     ****************************/
+
+    namespace detail
+    {
+        template <class T>
+        struct arithmetic_type
+        {
+            using type = T;
+        };
+
+        // Integers are computed in an unsigned type at least as wide as
+        // unsigned int, so that overflows wrap around instead of being
+        // undefined behavior.
+        template <std::integral T>
+        struct arithmetic_type<T>
+        {
+            using type = std::conditional_t<(sizeof(T) < sizeof(unsigned int)), unsigned int, std::make_unsigned_t<T>>;
+        };
+
+        template <>
+        struct arithmetic_type<float16_t>
+        {
+            using type = float;
+        };
+
+        template <class T>
+        using arithmetic_type_t = typename arithmetic_type<T>::type;
+
+        template <class T, class F>
+        constexpr T apply_arithmetic(T lhs, T rhs, F f)
+        {
+            using A = arithmetic_type_t<T>;
+            return static_cast<T>(f(static_cast<A>(lhs), static_cast<A>(rhs)));
+        }
+
+        struct add_op
+        {
+            template <class T>
+            static constexpr T apply(T lhs, T rhs)
+            {
+                return apply_arithmetic(lhs, rhs, std::plus<>{});
+            }
+        };
+
+        struct subtract_op
+        {
+            template <class T>
+            static constexpr T apply(T lhs, T rhs)
+            {
+                return apply_arithmetic(lhs, rhs, std::minus<>{});
+            }
+        };
+
+        struct multiply_op
+        {
+            template <class T>
+            static constexpr T apply(T lhs, T rhs)
+            {
+                return apply_arithmetic(lhs, rhs, std::multiplies<>{});
+            }
+        };
+
+        struct divide_op
+        {
+            // Divisions by zero and of the smallest signed value by -1 are
+            // computed on a replaced divisor so that they never trap; the
+            // kernel rejects the former and the latter is fixed up with a
+            // wrapping negation.
+            template <class T>
+            static constexpr T apply(T lhs, T rhs)
+            {
+                if constexpr (std::integral<T>)
+                {
+                    if constexpr (std::is_signed_v<T>)
+                    {
+                        const bool minus_one = rhs == static_cast<T>(-1);
+                        const T divisor = (rhs == T(0) || minus_one) ? T(1) : rhs;
+                        const T negated = apply_arithmetic(T(0), lhs, std::minus<>{});
+                        return minus_one ? negated : static_cast<T>(lhs / divisor);
+                    }
+                    else
+                    {
+                        const T divisor = rhs == T(0) ? T(1) : rhs;
+                        return static_cast<T>(lhs / divisor);
+                    }
+                }
+                else
+                {
+                    return apply_arithmetic(lhs, rhs, std::divides<>{});
+                }
+            }
+        };
+
+        template <class Compare>
+        struct compare_op
+        {
+            template <class T>
+            static constexpr bool apply(T lhs, T rhs)
+            {
+                return Compare{}(lhs, rhs);
+            }
+        };
+
+        template <class T>
+        array_data<T> get_primitive_data(const primitive_array<T>& ar)
+        {
+            return make_array_data<T>(sparrow::detail::array_access::get_arrow_proxy(ar));
+        }
+
+        // Operands of the binary kernels are either arrays or scalars
+        template <class T>
+        T value_at(const array_data<T>& data, std::size_t i)
+        {
+            return data.values[data.offset + i];
+        }
+
+        template <class T>
+        T value_at(const T& value, std::size_t)
+        {
+            return value;
+        }
+
+        template <class O>
+        struct is_array_data : std::false_type
+        {
+        };
+
+        template <class T>
+        struct is_array_data<array_data<T>> : std::true_type
+        {
+        };
+
+        template <class L, class R>
+        std::size_t operands_length(const L& lhs, const R& rhs)
+        {
+            if constexpr (is_array_data<L>::value && is_array_data<R>::value)
+            {
+                if (lhs.length != rhs.length)
+                {
+                    throw std::invalid_argument("element-wise kernel: the arrays must have the same length");
+                }
+                return lhs.length;
+            }
+            else if constexpr (is_array_data<L>::value)
+            {
+                return lhs.length;
+            }
+            else
+            {
+                return rhs.length;
+            }
+        }
+
+        template <class L, class R>
+        validity_bitmap operands_validity(std::size_t length, const L& lhs, const R& rhs)
+        {
+            if constexpr (is_array_data<L>::value && is_array_data<R>::value)
+            {
+                return combine_validity(length, lhs, rhs);
+            }
+            else if constexpr (is_array_data<L>::value)
+            {
+                return combine_validity(length, lhs);
+            }
+            else
+            {
+                return combine_validity(length, rhs);
+            }
+        }
+
+        // Throws if a non-null element of the result has a zero divisor
+        template <class T, class R>
+        void check_divisors(const R& rhs, const validity_bitmap& validity)
+        {
+            const std::uint8_t* bitmap = validity.data();
+            const std::size_t length = validity.size();
+            for (std::size_t i = 0; i < length; i += 64)
+            {
+                const std::size_t n = std::min(length - i, std::size_t(64));
+                std::uint64_t zeros = 0;
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    zeros |= static_cast<std::uint64_t>(value_at(rhs, i + k) == T(0)) << k;
+                }
+                const std::uint64_t valid = bitmap != nullptr ? load_bits(bitmap, i, n) : ~std::uint64_t(0);
+                if ((zeros & valid) != 0)
+                {
+                    throw std::domain_error("divide: integer division by zero");
+                }
+            }
+        }
+
+        template <class Res, class Op, class T, class L, class R>
+        primitive_array<Res> binary_kernel(const L& lhs, const R& rhs)
+        {
+            const std::size_t length = operands_length(lhs, rhs);
+            validity_bitmap validity = operands_validity(length, lhs, rhs);
+            if constexpr (std::same_as<Op, divide_op> && std::integral<T>)
+            {
+                check_divisors<T>(rhs, validity);
+            }
+
+            u8_buffer<Res> values(length);
+            Res* out = values.data();
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                out[i] = Op::apply(value_at(lhs, i), value_at(rhs, i));
+            }
+            return primitive_array<Res>(std::move(values), std::move(validity));
+        }
+
+        template <class Op, class T>
+        primitive_array<T> arithmetic(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+        {
+            return binary_kernel<T, Op, T>(get_primitive_data(lhs), get_primitive_data(rhs));
+        }
+
+        template <class Op, class T>
+        primitive_array<T> arithmetic(const primitive_array<T>& lhs, const T& rhs)
+        {
+            return binary_kernel<T, Op, T>(get_primitive_data(lhs), rhs);
+        }
+
+        template <class Op, class T>
+        primitive_array<T> arithmetic(const T& lhs, const primitive_array<T>& rhs)
+        {
+            return binary_kernel<T, Op, T>(lhs, get_primitive_data(rhs));
+        }
+
+        template <class Compare, class T>
+        primitive_array<bool> compare(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+        {
+            return binary_kernel<bool, compare_op<Compare>, T>(get_primitive_data(lhs), get_primitive_data(rhs));
+        }
+
+        template <class Compare, class T>
+        primitive_array<bool> compare(const primitive_array<T>& lhs, const T& rhs)
+        {
+            return binary_kernel<bool, compare_op<Compare>, T>(get_primitive_data(lhs), rhs);
+        }
+
+        template <class R, class T>
+        constexpr R convert(T value)
+        {
+            // float16 is converted through float, as the integral types
+            // are not always constructible from it
+            if constexpr (std::same_as<T, float16_t> || std::same_as<R, float16_t>)
+            {
+                return static_cast<R>(static_cast<float>(value));
+            }
+            else
+            {
+                return static_cast<R>(value);
+            }
+        }
+
+        // Casts of floating-point values to integral types are undefined for NaN
+        // and out of range values, they are checked before converting them
+        template <class R, class T>
+        concept checked_cast = std::integral<R> && (std::floating_point<T> || std::same_as<T, float16_t>);
+
+        template <std::integral R, class F>
+        bool in_range(F value)
+        {
+            // The bounds are powers of two, exactly representable in F
+            constexpr F upper = static_cast<F>(std::numeric_limits<R>::max() / 2 + 1) * F(2);
+            constexpr F lower = std::is_signed_v<R> ? -upper : F(0);
+            const F truncated = std::trunc(value);
+            return truncated >= lower && truncated < upper;
+        }
+
+        template <class R, class T>
+        primitive_array<R> checked_cast_kernel(const array_data<T>& data)
+        {
+            validity_bitmap validity = combine_validity(data.length, data);
+            u8_buffer<R> values(data.length);
+            R* out = values.data();
+            const T* in = data.values + data.offset;
+            for (std::size_t i = 0; i < data.length; ++i)
+            {
+                if (!validity.test(i))
+                {
+                    out[i] = R(0);
+                    continue;
+                }
+                using float_type = std::conditional_t<std::same_as<T, float16_t>, float, T>;
+                const auto value = static_cast<float_type>(in[i]);
+                if (!in_range<R>(value))
+                {
+                    throw std::overflow_error("cast: value out of the range of the integral type");
+                }
+                out[i] = static_cast<R>(value);
+            }
+            return primitive_array<R>(std::move(values), std::move(validity));
+        }
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> add(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::arithmetic<detail::add_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> add(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::arithmetic<detail::add_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> add(const std::type_identity_t<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::arithmetic<detail::add_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> subtract(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::arithmetic<detail::subtract_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> subtract(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::arithmetic<detail::subtract_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> subtract(const std::type_identity_t<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::arithmetic<detail::subtract_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> multiply(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::arithmetic<detail::multiply_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> multiply(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::arithmetic<detail::multiply_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> multiply(const std::type_identity_t<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::arithmetic<detail::multiply_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> divide(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::arithmetic<detail::divide_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> divide(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::arithmetic<detail::divide_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<T> divide(const std::type_identity_t<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::arithmetic<detail::divide_op>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::compare<std::equal_to<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> equal(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::compare<std::equal_to<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> not_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::compare<std::not_equal_to<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> not_equal(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::compare<std::not_equal_to<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> less(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::compare<std::less<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> less(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::compare<std::less<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> less_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::compare<std::less_equal<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> less_equal(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::compare<std::less_equal<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> greater(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::compare<std::greater<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> greater(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::compare<std::greater<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> greater_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::compare<std::greater_equal<>>(lhs, rhs);
+    }
+
+    template <elementwise_value T>
+    primitive_array<bool> greater_equal(const primitive_array<T>& lhs, const std::type_identity_t<T>& rhs)
+    {
+        return detail::compare<std::greater_equal<>>(lhs, rhs);
+    }
+
+    template <elementwise_value R, elementwise_value T>
+    primitive_array<R> cast(const primitive_array<T>& ar)
+    {
+        const auto data = detail::get_primitive_data(ar);
+        if constexpr (detail::checked_cast<R, T>)
+        {
+            return detail::checked_cast_kernel<R>(data);
+        }
+        else
+        {
+            validity_bitmap validity = detail::combine_validity(data.length, data);
+            u8_buffer<R> values(data.length);
+            R* out = values.data();
+            const T* in = data.values + data.offset;
+            for (std::size_t i = 0; i < data.length; ++i)
+            {
+                out[i] = detail::convert<R>(in[i]);
+            }
+            return primitive_array<R>(std::move(values), std::move(validity));
+        }
+    }
+}
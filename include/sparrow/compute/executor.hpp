@@ -0,0 +1,250 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/record_batch.hpp"
+#include "sparrow/utils/thread_pool.hpp"
+
+namespace sparrow::compute
+{
+    /**
+     * Range of rows [begin, end) of a record batch.
+     */
+    struct row_range
+    {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return end - begin;
+        }
+
+        constexpr bool operator==(const row_range&) const = default;
+    };
+
+    /**
+     * Runs kernels over the columns of a record batch in parallel.
+     *
+     * The rows of the batch are split into morsels of at most morsel_size()
+     * rows. The kernels are given views on the morsels, built with
+     * array::slice_view: they share the buffers of the batch, nothing is
+     * copied. The morsels, and the columns when the batch is wide, are
+     * scheduled as independent tasks on a thread_pool; the thread calling
+     * the executor takes part in the work, so an executor can be used from
+     * a task of the same pool.
+     *
+     * The views are created before the kernels are scheduled. Kernels are
+     * run concurrently on views of the same batch and must therefore only
+     * read them. If kernels throw, the first exception is rethrown once the
+     * running tasks are completed.
+     */
+    class record_batch_executor
+    {
+    public:
+
+        static constexpr std::size_t default_morsel_size = 64 * 1024;
+
+        /**
+         * @param pool The thread pool running the tasks, which must outlive the executor.
+         * @param morsel_size The maximum number of rows of a morsel, must be positive.
+         */
+        SPARROW_API explicit record_batch_executor(
+            thread_pool& pool = default_thread_pool(),
+            std::size_t morsel_size = default_morsel_size
+        );
+
+        [[nodiscard]] SPARROW_API thread_pool& pool() const noexcept;
+        [[nodiscard]] SPARROW_API std::size_t morsel_size() const noexcept;
+
+        /**
+         * @return The row ranges of the morsels of a batch of \c nb_rows rows.
+         */
+        [[nodiscard]] SPARROW_API std::vector<row_range> split(std::size_t nb_rows) const;
+
+        /**
+         * Calls \c f(morsel, range) for each morsel of \c rb, where \c morsel
+         * is a record batch of views on the rows of \c range.
+         *
+         * @return The results of the calls, in the order of the morsels.
+         */
+        template <class F>
+            requires std::invocable<F&, const record_batch&, row_range>
+        auto map_morsels(const record_batch& rb, F&& f) const;
+
+        /**
+         * Calls \c f(column, index) for each column of \c rb.
+         *
+         * @return The results of the calls, in the order of the columns.
+         */
+        template <class F>
+            requires std::invocable<F&, const array&, std::size_t>
+        auto map_columns(const record_batch& rb, F&& f) const;
+
+        /**
+         * Calls \c f(view, index, range) for each column of \c rb and each
+         * morsel of its rows, where \c view is a view on the rows of \c range
+         * of the column at \c index. Each call is a separate task, so that
+         * the work of wide batches is spread over the columns as well as
+         * over the rows.
+         *
+         * @return The results of the calls, indexed by column and then by
+         * morsel.
+         */
+        template <class F>
+            requires std::invocable<F&, const array&, std::size_t, row_range>
+        auto map_column_morsels(const record_batch& rb, F&& f) const;
+
+    private:
+
+        [[nodiscard]] SPARROW_API std::vector<array>
+        make_views(const record_batch& rb, const std::vector<row_range>& ranges) const;
+
+        // Returns std::vector<R>, or nothing if R is void
+        template <class R, class F>
+        auto map_tasks(std::size_t nb_tasks, F& f) const;
+
+        thread_pool* p_pool;
+        std::size_t m_morsel_size;
+    };
+
+    namespace detail
+    {
+        /**
+         * Calls \c f(i) for i in [0, n) on \c pool and the calling thread,
+         * and returns when all the calls are completed.
+         */
+        SPARROW_API void parallel_for(thread_pool& pool, std::size_t n, const std::function<void(std::size_t)>& f);
+    }
+
+    /******************************************
+     * record_batch_executor implementation *
+     ******************************************/
+
+    template <class F>
+        requires std::invocable<F&, const record_batch&, row_range>
+    auto record_batch_executor::map_morsels(const record_batch& rb, F&& f) const
+    {
+        using result_type = std::invoke_result_t<F&, const record_batch&, row_range>;
+        const std::vector<row_range> ranges = split(rb.nb_rows());
+        std::vector<array> views = make_views(rb, ranges);
+        const std::vector<record_batch::name_type> names(rb.names().begin(), rb.names().end());
+
+        std::vector<record_batch> morsels;
+        morsels.reserve(ranges.size());
+        const std::size_t nb_columns = rb.nb_columns();
+        for (std::size_t m = 0; m < ranges.size(); ++m)
+        {
+            std::vector<array> columns;
+            columns.reserve(nb_columns);
+            for (std::size_t c = 0; c < nb_columns; ++c)
+            {
+                columns.push_back(std::move(views[c * ranges.size() + m]));
+            }
+            morsels.emplace_back(names, std::move(columns));
+        }
+
+        auto task = [&](std::size_t m)
+        {
+            return std::invoke(f, std::as_const(morsels[m]), ranges[m]);
+        };
+        return map_tasks<result_type>(ranges.size(), task);
+    }
+
+    template <class F>
+        requires std::invocable<F&, const array&, std::size_t>
+    auto record_batch_executor::map_columns(const record_batch& rb, F&& f) const
+    {
+        using result_type = std::invoke_result_t<F&, const array&, std::size_t>;
+        auto task = [&](std::size_t c)
+        {
+            return std::invoke(f, rb.get_column(c), c);
+        };
+        return map_tasks<result_type>(rb.nb_columns(), task);
+    }
+
+    template <class F>
+        requires std::invocable<F&, const array&, std::size_t, row_range>
+    auto record_batch_executor::map_column_morsels(const record_batch& rb, F&& f) const
+    {
+        using result_type = std::invoke_result_t<F&, const array&, std::size_t, row_range>;
+        const std::vector<row_range> ranges = split(rb.nb_rows());
+        const std::vector<array> views = make_views(rb, ranges);
+        const std::size_t nb_morsels = ranges.size();
+
+        auto task = [&](std::size_t i)
+        {
+            return std::invoke(f, views[i], i / nb_morsels, ranges[i % nb_morsels]);
+        };
+
+        if constexpr (std::is_void_v<result_type>)
+        {
+            map_tasks<void>(views.size(), task);
+        }
+        else
+        {
+            std::vector<result_type> flat = map_tasks<result_type>(views.size(), task);
+            std::vector<std::vector<result_type>> res(rb.nb_columns());
+            for (std::size_t c = 0; c < res.size(); ++c)
+            {
+                res[c].reserve(nb_morsels);
+                for (std::size_t m = 0; m < nb_morsels; ++m)
+                {
+                    res[c].push_back(std::move(flat[c * nb_morsels + m]));
+                }
+            }
+            return res;
+        }
+    }
+
+    template <class R, class F>
+    auto record_batch_executor::map_tasks(std::size_t nb_tasks, F& f) const
+    {
+        if constexpr (std::is_void_v<R>)
+        {
+            detail::parallel_for(*p_pool, nb_tasks, f);
+        }
+        else
+        {
+            // Results are stored in optionals so that R does not need to be
+            // default constructible
+            std::vector<std::optional<R>> results(nb_tasks);
+            detail::parallel_for(
+                *p_pool,
+                nb_tasks,
+                [&](std::size_t i)
+                {
+                    results[i].emplace(f(i));
+                }
+            );
+            std::vector<R> res;
+            res.reserve(nb_tasks);
+            for (auto& r : results)
+            {
+                res.push_back(std::move(*r));
+            }
+            return res;
+        }
+    }
+}
@@ -0,0 +1,168 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/compute/compute_utils.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+
+// Selection kernels: take gathers the elements of an array at given
+// positions, filter keeps the elements selected by a boolean mask.
+//
+// Both work on any layout. They first build a selection vector, the
+// positions of the selected elements, and then gather the buffers of the
+// array once per layout: fixed-width values are gathered in a single
+// loop, the lengths of variable-size elements are summed before the data
+// is copied so that each buffer of the result is allocated once, nested
+// layouts recurse into their children and dictionary-encoded arrays only
+// gather their keys.
+
+namespace sparrow::compute
+{
+    /**
+     * Positions of the elements selected from an array, in the order of the
+     * result. A negative position selects a null element.
+     */
+    using selection_vector = std::vector<std::int64_t>;
+
+    /**
+     * Builds the selection vector of the elements whose value in \c mask is
+     * true. Null elements of the mask are not selected.
+     */
+    [[nodiscard]] SPARROW_API selection_vector make_selection(const primitive_array<bool>& mask);
+
+    /**
+     * Builds the selection vector of the positions in \c indices. Null
+     * indices select null elements.
+     *
+     * @throw std::out_of_range if a non-null index is negative.
+     */
+    template <std::integral I>
+        requires(!std::same_as<I, bool>)
+    [[nodiscard]] selection_vector make_selection(const primitive_array<I>& indices);
+
+    /**
+     * @return The elements of \c ar at the positions of \c selection.
+     * @throw std::out_of_range if a position is not less than the size of \c ar.
+     */
+    template <layout_or_array A>
+    [[nodiscard]] A take(const A& ar, std::span<const std::int64_t> selection);
+
+    /**
+     * @return The elements of \c ar at the positions of \c indices. The
+     * elements of the result at null indices are null.
+     * @throw std::out_of_range if an index is not within the range of \c ar.
+     */
+    template <layout_or_array A, std::integral I>
+        requires(!std::same_as<I, bool>)
+    [[nodiscard]] A take(const A& ar, const primitive_array<I>& indices);
+
+    /**
+     * @return The elements of \c ar whose value in \c mask is true.
+     * @throw std::invalid_argument if \c ar and \c mask have different sizes.
+     */
+    template <layout_or_array A>
+    [[nodiscard]] A filter(const A& ar, const primitive_array<bool>& mask);
+
+    namespace detail
+    {
+        [[nodiscard]] SPARROW_API arrow_proxy
+        take(const arrow_proxy& source, std::span<const std::int64_t> selection);
+
+        template <layout_or_array A>
+        A make_from_proxy(arrow_proxy&& proxy)
+        {
+            if constexpr (std::same_as<A, array>)
+            {
+                ArrowArray arr = proxy.extract_array();
+                ArrowSchema schema = proxy.extract_schema();
+                return array(std::move(arr), std::move(schema));
+            }
+            else
+            {
+                return A(std::move(proxy));
+            }
+        }
+    }
+
+    /****************************
+     * selection implementation *
+     ****************************/
+
+    template <std::integral I>
+        requires(!std::same_as<I, bool>)
+    selection_vector make_selection(const primitive_array<I>& indices)
+    {
+        const auto data = detail::make_array_data<I>(sparrow::detail::array_access::get_arrow_proxy(indices));
+        selection_vector res(data.length);
+        for (std::size_t i = 0; i < data.length; ++i)
+        {
+            const std::size_t index = data.offset + i;
+            const bool valid = data.validity == nullptr || ((data.validity[index / 8] >> (index % 8)) & 1u);
+            const I value = data.values[index];
+            if (!valid)
+            {
+                res[i] = -1;
+            }
+            else if (std::cmp_less(value, 0) || std::cmp_greater(value, std::numeric_limits<std::int64_t>::max()))
+            {
+                throw std::out_of_range("take: index out of range");
+            }
+            else
+            {
+                res[i] = static_cast<std::int64_t>(value);
+            }
+        }
+        return res;
+    }
+
+    template <layout_or_array A>
+    A take(const A& ar, std::span<const std::int64_t> selection)
+    {
+        const arrow_proxy& proxy = sparrow::detail::array_access::get_arrow_proxy(ar);
+        return detail::make_from_proxy<A>(detail::take(proxy, selection));
+    }
+
+    template <layout_or_array A, std::integral I>
+        requires(!std::same_as<I, bool>)
+    A take(const A& ar, const primitive_array<I>& indices)
+    {
+        const selection_vector selection = make_selection(indices);
+        return take(ar, std::span<const std::int64_t>(selection));
+    }
+
+    template <layout_or_array A>
+    A filter(const A& ar, const primitive_array<bool>& mask)
+    {
+        if (ar.size() != mask.size())
+        {
+            throw std::invalid_argument("filter: the array and the mask must have the same size");
+        }
+        const selection_vector selection = make_selection(mask);
+        return take(ar, std::span<const std::int64_t>(selection));
+    }
+}
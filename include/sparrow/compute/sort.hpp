@@ -0,0 +1,128 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/compute/selection.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/record_batch.hpp"
+
+// Sort kernels: sort_indices computes the permutation that sorts an array,
+// sort applies it with take.
+//
+// Sorts are stable. Null elements are moved to one end, in their original
+// order, and only the valid elements are sorted. Integers, floating points
+// and the temporal types are sorted with a LSD radix sort on keys whose
+// unsigned order is the order of the values, one pass per byte, skipping
+// the bytes that are the same for all the keys. NaN values are sorted
+// after all the other floating points, in both orders. Strings and binaries
+// are compared on a 4-byte big-endian prefix first, read directly from the
+// views of the binary view layout, and only compared in full when the
+// prefixes are equal.
+//
+// A record_batch is sorted on several columns by sorting the permutation
+// stably on each column, from the last key to the first one.
+
+namespace sparrow::compute
+{
+    enum class sort_order
+    {
+        ascending,
+        descending
+    };
+
+    enum class null_placement
+    {
+        at_start,
+        at_end
+    };
+
+    struct sort_options
+    {
+        sort_order order = sort_order::ascending;
+        null_placement nulls = null_placement::at_end;
+    };
+
+    /**
+     * Column of a record_batch to sort on, and how to sort it.
+     */
+    struct sort_key
+    {
+        std::string name;
+        sort_options options = {};
+    };
+
+    /**
+     * @return The positions of the elements of \c ar in sorted order.
+     * @throw std::invalid_argument if the elements of \c ar cannot be sorted:
+     * only the integer, floating point, temporal, string and binary types
+     * are supported.
+     */
+    template <layout_or_array A>
+    [[nodiscard]] selection_vector sort_indices(const A& ar, const sort_options& options = {});
+
+    /**
+     * @return The positions of the rows of \c rb in the lexicographic order
+     * of the columns of \c keys.
+     * @throw std::out_of_range if a key is not the name of a column of \c rb.
+     * @throw std::invalid_argument if a column cannot be sorted.
+     */
+    [[nodiscard]] SPARROW_API selection_vector
+    sort_indices(const record_batch& rb, std::span<const sort_key> keys);
+
+    /**
+     * @return The elements of \c ar in sorted order.
+     */
+    template <layout_or_array A>
+    [[nodiscard]] A sort(const A& ar, const sort_options& options = {});
+
+    namespace detail
+    {
+        /**
+         * Sorts stably the positions of the elements of \c source.
+         */
+        SPARROW_API void
+        sort_positions(const arrow_proxy& source, const sort_options& options, selection_vector& positions);
+    }
+
+    /***********************
+     * sort implementation *
+     ***********************/
+
+    template <layout_or_array A>
+    selection_vector sort_indices(const A& ar, const sort_options& options)
+    {
+        const arrow_proxy& proxy = sparrow::detail::array_access::get_arrow_proxy(ar);
+        selection_vector positions(proxy.length());
+        std::iota(positions.begin(), positions.end(), std::int64_t(0));
+        detail::sort_positions(proxy, options, positions);
+        return positions;
+    }
+
+    template <layout_or_array A>
+    A sort(const A& ar, const sort_options& options)
+    {
+        const selection_vector positions = sort_indices(ar, options);
+        return take(ar, std::span<const std::int64_t>(positions));
+    }
+}
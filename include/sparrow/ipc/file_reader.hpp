@@ -0,0 +1,95 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "sparrow/config/config.hpp"
+#include "sparrow/ipc/ipc_error.hpp"
+#include "sparrow/record_batch.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * Reader for the Arrow IPC file format:
+     * https://arrow.apache.org/docs/format/Columnar.html#ipc-file-format
+     *
+     * The file is memory-mapped, and the arrays of the record batches returned
+     * by the reader adopt the mapped memory instead of copying it: reading a
+     * batch only decodes its metadata, and unpacks boolean values, which are
+     * stored as bits by Arrow IPC and as bytes by sparrow. The mapping is private, modifying an
+     * array does not modify the file. It stays alive as long as an array
+     * references it, even after the reader is destroyed.
+     *
+     * Compressed bodies, big-endian files and delta dictionaries are not
+     * supported; opening or reading such files throws an ipc_error.
+     *
+     * Example of usage:
+     * @code{.cpp}
+     * sparrow::ipc::file_reader reader("features.arrow");
+     * for (std::size_t i = 0; i < reader.num_record_batches(); ++i)
+     * {
+     *     sparrow::record_batch batch = reader.read_record_batch(i);
+     *     // ...
+     * }
+     * @endcode
+     */
+    class file_reader
+    {
+    public:
+
+        /**
+         * Maps the file and decodes its footer and schema.
+         *
+         * @param path The path of the file.
+         * @exception ipc_error if the file cannot be mapped or is not a valid Arrow IPC file.
+         */
+        SPARROW_API explicit file_reader(const std::filesystem::path& path);
+
+        SPARROW_API ~file_reader();
+
+        file_reader(const file_reader&) = delete;
+        file_reader& operator=(const file_reader&) = delete;
+
+        SPARROW_API file_reader(file_reader&&) noexcept;
+        SPARROW_API file_reader& operator=(file_reader&&) noexcept;
+
+        /**
+         * @returns the number of record batches in the file.
+         */
+        [[nodiscard]] SPARROW_API std::size_t num_record_batches() const noexcept;
+
+        /**
+         * Reads the record batch at the given index.
+         *
+         * @param index The index of the record batch, must be less than num_record_batches().
+         * @exception ipc_error if the record batch is malformed.
+         */
+        [[nodiscard]] SPARROW_API record_batch read_record_batch(std::size_t index) const;
+
+        /**
+         * Reads all the record batches of the file.
+         */
+        [[nodiscard]] SPARROW_API std::vector<record_batch> read_all() const;
+
+    private:
+
+        struct impl;
+        std::unique_ptr<impl> p_impl;
+    };
+}
@@ -0,0 +1,36 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace sparrow::ipc
+{
+    /**
+     * Exception thrown when reading or writing Arrow IPC data fails, either
+     * because of an I/O error or because the data is malformed or uses a
+     * feature that is not supported.
+     */
+    class ipc_error : public std::runtime_error
+    {
+    public:
+
+        explicit ipc_error(const std::string& message)
+            : std::runtime_error(message)
+        {
+        }
+    };
+}
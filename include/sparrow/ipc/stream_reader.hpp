@@ -0,0 +1,122 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "sparrow/config/config.hpp"
+#include "sparrow/ipc/ipc_error.hpp"
+#include "sparrow/record_batch.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * Reader for the Arrow IPC streaming format:
+     * https://arrow.apache.org/docs/format/Columnar.html#ipc-streaming-format
+     *
+     * The stream is read message by message, and a record batch is returned
+     * as soon as its message is complete, so that unbounded streams can be
+     * consumed with bounded memory.
+     *
+     * The body of each message is read into a block that the arrays of the
+     * record batch adopt without copying it. Blocks are recycled: once all
+     * the arrays of a batch are destroyed, its block is reused for the next
+     * messages that fit in it. Consuming batches one at a time thus reads the
+     * whole stream with a handful of allocations.
+     *
+     * Compressed bodies, big-endian streams and delta dictionaries are not
+     * supported; reading such streams throws an ipc_error.
+     *
+     * Example of usage:
+     * @code{.cpp}
+     * sparrow::ipc::stream_reader reader(fd);
+     * while (std::optional<sparrow::record_batch> batch = reader.next())
+     * {
+     *     // ...
+     * }
+     * @endcode
+     */
+    class stream_reader
+    {
+    public:
+
+        /**
+         * Reads at most \c dest.size() bytes into \c dest and returns the
+         * number of bytes read, blocking until at least one byte is
+         * available. Returns 0 at the end of the stream.
+         */
+        using source_type = std::function<std::size_t(std::span<std::uint8_t> dest)>;
+
+        /**
+         * Opens the file at \c path and reads its schema.
+         *
+         * @exception ipc_error if the file cannot be opened or does not start
+         * with a valid schema message.
+         */
+        SPARROW_API explicit stream_reader(const std::filesystem::path& path);
+
+        /**
+         * Reads from the file descriptor \c fd, which is not closed by the
+         * reader, starting with the schema.
+         *
+         * @exception ipc_error if the stream does not start with a valid
+         * schema message.
+         */
+        SPARROW_API explicit stream_reader(int fd);
+
+        /**
+         * Reads from a user-defined source, starting with the schema.
+         *
+         * @exception ipc_error if the stream does not start with a valid
+         * schema message.
+         */
+        SPARROW_API explicit stream_reader(source_type source);
+
+        SPARROW_API ~stream_reader();
+
+        stream_reader(const stream_reader&) = delete;
+        stream_reader& operator=(const stream_reader&) = delete;
+
+        SPARROW_API stream_reader(stream_reader&&) noexcept;
+        SPARROW_API stream_reader& operator=(stream_reader&&) noexcept;
+
+        /**
+         * Reads the messages of the stream up to the next record batch,
+         * handling the dictionary batches on the way.
+         *
+         * @returns the record batch, or an empty optional at the end of the
+         * stream.
+         * @exception ipc_error if the stream is malformed or cannot be read.
+         */
+        [[nodiscard]] SPARROW_API std::optional<record_batch> next();
+
+        /**
+         * Reads all the remaining record batches of the stream.
+         */
+        [[nodiscard]] SPARROW_API std::vector<record_batch> read_all();
+
+    private:
+
+        struct impl;
+        std::unique_ptr<impl> p_impl;
+    };
+}
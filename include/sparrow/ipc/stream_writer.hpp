@@ -0,0 +1,113 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+
+#include "sparrow/config/config.hpp"
+#include "sparrow/ipc/ipc_error.hpp"
+#include "sparrow/record_batch.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * Writer for the Arrow IPC streaming format:
+     * https://arrow.apache.org/docs/format/Columnar.html#ipc-streaming-format
+     *
+     * The schema message is written with the first record batch, and the
+     * end-of-stream marker when the writer is closed. The buffers of the
+     * arrays are not copied: each message is handed to the output as a list
+     * of segments pointing to them, which is written with a single gather
+     * write (writev) for file descriptors. Only boolean values, stored as
+     * bytes by sparrow and as bits by Arrow IPC, and the validity bitmaps of
+     * slices that do not start on a byte boundary are copied.
+     *
+     * The dictionaries of dictionary-encoded columns are written before each
+     * record batch, as replacement dictionaries.
+     *
+     * Example of usage:
+     * @code{.cpp}
+     * sparrow::ipc::stream_writer writer("features.arrows");
+     * writer.write(batch1);
+     * writer.write(batch2);
+     * writer.close();
+     * @endcode
+     */
+    class stream_writer
+    {
+    public:
+
+        /**
+         * Receives the segments of a message, to be written in order.
+         */
+        using sink_type = std::function<void(std::span<const std::span<const std::uint8_t>>)>;
+
+        /**
+         * Creates or truncates the file at \c path and writes to it.
+         *
+         * @exception ipc_error if the file cannot be opened.
+         */
+        SPARROW_API explicit stream_writer(const std::filesystem::path& path);
+
+        /**
+         * Writes to the file descriptor \c fd, which is not closed by the
+         * writer.
+         */
+        SPARROW_API explicit stream_writer(int fd);
+
+        /**
+         * Writes to a user-defined sink.
+         */
+        SPARROW_API explicit stream_writer(sink_type sink);
+
+        /**
+         * Closes the writer if it is not closed yet, ignoring errors.
+         */
+        SPARROW_API ~stream_writer();
+
+        stream_writer(const stream_writer&) = delete;
+        stream_writer& operator=(const stream_writer&) = delete;
+
+        SPARROW_API stream_writer(stream_writer&&) noexcept;
+        SPARROW_API stream_writer& operator=(stream_writer&&) noexcept;
+
+        /**
+         * Writes a record batch. All the batches must have the same schema as
+         * the first one.
+         *
+         * @param batch The record batch to write.
+         * @exception ipc_error if the batch cannot be written or if its schema
+         * differs from the schema of the stream.
+         */
+        SPARROW_API void write(const record_batch& batch);
+
+        /**
+         * Writes the end-of-stream marker and releases the output. Writing a
+         * stream without batches writes no schema, only the marker.
+         *
+         * @exception ipc_error if the marker cannot be written.
+         */
+        SPARROW_API void close();
+
+    private:
+
+        struct impl;
+        std::unique_ptr<impl> p_impl;
+    };
+}
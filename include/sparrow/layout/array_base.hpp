@@ -407,7 +407,9 @@ namespace sparrow
     auto array_crtp_base<D>::has_value(size_type i) const -> bitmap_const_reference
     {
         SPARROW_ASSERT_TRUE(i < size());
-        return *sparrow::next(bitmap_begin(), i);
+        // test short-circuits the arrays without validity buffer or without
+        // null element
+        return this->derived_cast().get_bitmap().test(get_arrow_proxy().offset() + i);
     }
 
     template <class D>
@@ -19,6 +19,21 @@
 
 namespace sparrow
 {
+    /**
+     * Raw view on the validity bitmap of an array, for code processing the
+     * bitmap bytes directly. The validity of the element \c i of the array
+     * is the bit <tt>offset + i</tt> of \c data. \c data is null when the
+     * array has no validity buffer, all its elements being valid.
+     */
+    struct validity_bitmap_view
+    {
+        const std::uint8_t* data = nullptr;
+        std::size_t offset = 0;
+        std::size_t size = 0;
+
+        [[nodiscard]] constexpr bool test(std::size_t i) const;
+    };
+
     /**
      * Base class for arrays using a validity buffer for
      * defining their bitmap.
@@ -49,6 +64,8 @@ namespace sparrow
 
         using iterator_tag = typename base_type::iterator_tag;
 
+        [[nodiscard]] validity_bitmap_view bitmap_view() const;
+
     protected:
 
         array_bitmap_base_impl(arrow_proxy);
@@ -110,6 +127,17 @@ namespace sparrow
     template <class D>
     using mutable_array_bitmap_base = array_bitmap_base_impl<D, true>;
 
+    /***************************************
+     * validity_bitmap_view implementation *
+     ***************************************/
+
+    constexpr bool validity_bitmap_view::test(std::size_t i) const
+    {
+        SPARROW_ASSERT_TRUE(i < size);
+        const std::size_t bit = offset + i;
+        return data == nullptr || ((data[bit / 8] >> (bit % 8)) & 1u) != 0;
+    }
+
     /************************************
      * array_bitmap_base implementation *
      ************************************/
@@ -150,6 +178,17 @@ namespace sparrow
         return m_bitmap;
     }
 
+    /**
+     * Returns a view on the bytes of the validity bitmap of the array,
+     * taking its offset into account.
+     */
+    template <class D, bool is_mutable>
+    auto array_bitmap_base_impl<D, is_mutable>::bitmap_view() const -> validity_bitmap_view
+    {
+        const arrow_proxy& proxy = this->get_arrow_proxy();
+        return {m_bitmap.data(), proxy.offset(), proxy.length()};
+    }
+
     template <class D, bool is_mutable>
     auto array_bitmap_base_impl<D, is_mutable>::make_bitmap() -> bitmap_type
     {
@@ -181,7 +220,7 @@ namespace sparrow
         const auto pos_index = static_cast<size_t>(std::distance(this->bitmap_cbegin(), pos))
                                + arrow_proxy.offset();
         const auto idx = arrow_proxy.insert_bitmap(pos_index, value, count);
-        return sparrow::next(this->bitmap_begin(), idx);
+        return sparrow::next(this->bitmap_begin(), idx - arrow_proxy.offset());
     }
 
     template <class D, bool is_mutable>
@@ -199,7 +238,7 @@ namespace sparrow
         const auto pos_index = static_cast<size_t>(std::distance(this->bitmap_cbegin(), pos))
                                + arrow_proxy.offset();
         const auto idx = arrow_proxy.insert_bitmap(pos_index, std::ranges::subrange(first, last));
-        return sparrow::next(this->bitmap_begin(), idx);
+        return sparrow::next(this->bitmap_begin(), idx - arrow_proxy.offset());
     }
 
     template <class D, bool is_mutable>
@@ -212,7 +251,7 @@ namespace sparrow
         arrow_proxy& arrow_proxy = this->get_arrow_proxy();
         const auto pos_idx = static_cast<size_t>(std::distance(this->bitmap_cbegin(), pos));
         const auto idx = arrow_proxy.erase_bitmap(pos_idx, count);
-        return sparrow::next(this->bitmap_begin(), idx);
+        return sparrow::next(this->bitmap_begin(), idx - arrow_proxy.offset());
     }
 
     template <class D, bool is_mutable>
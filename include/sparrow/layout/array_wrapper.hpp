@@ -18,6 +18,7 @@
 #include <variant>
 
 #include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/config/config.hpp"
 #include "sparrow/layout/array_access.hpp"
 #include "sparrow/types/data_traits.hpp"
 #include "sparrow/utils/memory.hpp"
@@ -64,6 +65,30 @@ namespace sparrow
         };
     }
 
+    class array_wrapper;
+
+    namespace detail
+    {
+        /**
+         * Element accessors of a layout type, working on the array_wrapper
+         * holding it. They are resolved once when the wrapper is built, so
+         * that accessing an element through the wrapper does not go through
+         * the type switch of visit.
+         */
+        struct array_kernels
+        {
+            std::size_t (*size)(const array_wrapper&);
+            bool (*has_value)(const array_wrapper&, std::size_t);
+            array_traits::const_reference (*element)(const array_wrapper&, std::size_t);
+        };
+
+        /**
+         * @return The accessors of the layout matching \c dt and \c dictionary, or
+         * nullptr if visit does not support this layout.
+         */
+        [[nodiscard]] SPARROW_API const array_kernels* get_array_kernels(data_type dt, bool dictionary);
+    }
+
     /**
      * Base class for array type erasure
      */
@@ -84,18 +109,25 @@ namespace sparrow
         [[nodiscard]] enum data_type data_type() const;
         [[nodiscard]] bool is_dictionary() const;
 
+        /**
+         * @return The element accessors of the wrapped layout, or nullptr if
+         * its type is not supported by visit.
+         */
+        [[nodiscard]] const detail::array_kernels* kernels() const noexcept;
+
         [[nodiscard]] arrow_proxy& get_arrow_proxy();
         [[nodiscard]] const arrow_proxy& get_arrow_proxy() const;
 
     protected:
 
-        array_wrapper(enum data_type dt);
+        array_wrapper(enum data_type dt, bool dictionary);
         array_wrapper(const array_wrapper&) = default;
 
     private:
 
         enum data_type m_data_type;
-        [[nodiscard]] virtual bool is_dictionary_impl() const = 0;
+        bool m_dictionary;
+        const detail::array_kernels* p_kernels;
         [[nodiscard]] virtual arrow_proxy& get_arrow_proxy_impl() = 0;
         [[nodiscard]] virtual const arrow_proxy& get_arrow_proxy_impl() const = 0;
         [[nodiscard]] virtual wrapper_ptr clone_impl() const = 0;
@@ -119,10 +151,10 @@ namespace sparrow
 
         using wrapper_ptr = array_wrapper::wrapper_ptr;
 
-        [[nodiscard]] constexpr enum data_type get_data_type() const;
+        [[nodiscard]] static constexpr enum data_type get_data_type();
+        [[nodiscard]] static constexpr bool get_is_dictionary();
 
         array_wrapper_impl(const array_wrapper_impl&);
-        [[nodiscard]] bool is_dictionary_impl() const override;
         [[nodiscard]] arrow_proxy& get_arrow_proxy_impl() override;
         [[nodiscard]] const arrow_proxy& get_arrow_proxy_impl() const override;
         [[nodiscard]] wrapper_ptr clone_impl() const override;
@@ -154,7 +186,12 @@ namespace sparrow
 
     inline bool array_wrapper::is_dictionary() const
     {
-        return is_dictionary_impl();
+        return m_dictionary;
+    }
+
+    inline const detail::array_kernels* array_wrapper::kernels() const noexcept
+    {
+        return p_kernels;
     }
 
     inline arrow_proxy& array_wrapper::get_arrow_proxy()
@@ -167,8 +204,10 @@ namespace sparrow
         return get_arrow_proxy_impl();
     }
 
-    inline array_wrapper::array_wrapper(enum data_type dt)
+    inline array_wrapper::array_wrapper(enum data_type dt, bool dictionary)
         : m_data_type(dt)
+        , m_dictionary(dictionary)
+        , p_kernels(detail::get_array_kernels(dt, dictionary))
     {
     }
 
@@ -178,7 +217,7 @@ namespace sparrow
 
     template <class T>
     array_wrapper_impl<T>::array_wrapper_impl(T&& ar)
-        : array_wrapper(get_data_type())
+        : array_wrapper(get_data_type(), get_is_dictionary())
         , m_storage(value_ptr<T>(std::move(ar)))
         , p_array(std::get<value_ptr<T>>(m_storage).get())
     {
@@ -186,7 +225,7 @@ namespace sparrow
 
     template <class T>
     array_wrapper_impl<T>::array_wrapper_impl(T* ar)
-        : array_wrapper(get_data_type())
+        : array_wrapper(get_data_type(), get_is_dictionary())
         , m_storage(ar)
         , p_array(ar)
     {
@@ -194,7 +233,7 @@ namespace sparrow
 
     template <class T>
     array_wrapper_impl<T>::array_wrapper_impl(std::shared_ptr<T> ar)
-        : array_wrapper(get_data_type())
+        : array_wrapper(get_data_type(), get_is_dictionary())
         , m_storage(std::move(ar))
         , p_array(std::get<std::shared_ptr<T>>(m_storage).get())
     {
@@ -213,11 +252,17 @@ namespace sparrow
     }
 
     template <class T>
-    constexpr enum data_type array_wrapper_impl<T>::get_data_type() const
+    constexpr enum data_type array_wrapper_impl<T>::get_data_type()
     {
         return detail::get_data_type_from_array<T>::get();
     }
 
+    template <class T>
+    constexpr bool array_wrapper_impl<T>::get_is_dictionary()
+    {
+        return detail::is_dictionary_encoded_array<T>::get();
+    }
+
     template <class T>
     array_wrapper_impl<T>::array_wrapper_impl(const array_wrapper_impl& rhs)
         : array_wrapper(rhs)
@@ -240,12 +285,6 @@ namespace sparrow
         );
     }
 
-    template <class T>
-    bool array_wrapper_impl<T>::is_dictionary_impl() const
-    {
-        return detail::is_dictionary_encoded_array<T>::get();
-    }
-
     template <class T>
     arrow_proxy& array_wrapper_impl<T>::get_arrow_proxy_impl()
     {
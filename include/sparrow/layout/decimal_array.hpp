@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstddef>
+#include <span>
 #include <sstream>
 
 #include "sparrow/arrow_array_schema_proxy.hpp"
@@ -150,6 +151,22 @@ namespace sparrow
         {
         }
 
+        /**
+         * @return The precision of the decimal values of the array.
+         */
+        [[nodiscard]] std::size_t precision() const noexcept;
+
+        /**
+         * @return The scale of the decimal values of the array.
+         */
+        [[nodiscard]] int scale() const noexcept;
+
+        /**
+         * @return A span on the contiguous unscaled integers stored in the
+         * array, taking its offset into account. The integers of the null
+         * elements are included.
+         */
+        [[nodiscard]] std::span<const storage_type> value_span() const;
 
     private:
 
@@ -227,6 +244,18 @@ namespace sparrow
         }
     }
 
+    template <class T>
+    std::size_t decimal_array<T>::precision() const noexcept
+    {
+        return m_precision;
+    }
+
+    template <class T>
+    int decimal_array<T>::scale() const noexcept
+    {
+        return m_scale;
+    }
+
     template <class T>
     auto decimal_array<T>::create_proxy(
         u8_buffer<storage_type>&& data_buffer,
@@ -296,20 +325,26 @@ namespace sparrow
         return arrow_proxy(std::move(arr), std::move(schema));
     }
 
+    template <class T>
+    auto decimal_array<T>::value_span() const -> std::span<const storage_type>
+    {
+        const arrow_proxy& proxy = this->get_arrow_proxy();
+        const auto ptr = proxy.buffers()[DATA_BUFFER_INDEX].template data<const storage_type>();
+        return std::span<const storage_type>(ptr + proxy.offset(), proxy.length());
+    }
+
     template <class T>
     auto decimal_array<T>::value(size_type i) -> inner_reference
     {
         SPARROW_ASSERT_TRUE(i < this->size());
-        const auto ptr = this->get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].template data<const storage_type>();
-        return inner_reference(ptr[i], m_scale);
+        return inner_reference(value_span()[i], m_scale);
     }
 
     template <class T>
     auto decimal_array<T>::value(size_type i) const -> inner_const_reference
     {
         SPARROW_ASSERT_TRUE(i < this->size());
-        const auto ptr = this->get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].template data<const storage_type>();
-        return inner_const_reference(ptr[i], m_scale);
+        return inner_const_reference(value_span()[i], m_scale);
     }
 
     template <class T>
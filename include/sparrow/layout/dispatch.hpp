@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 
 #include "sparrow/layout/array_wrapper.hpp"
@@ -35,142 +36,273 @@
 #include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
 #include "sparrow/types/data_traits.hpp"
 #include "sparrow/types/data_type.hpp"
+#include "sparrow/utils/contracts.hpp"
 
 namespace sparrow
 {
     template <class F>
-    using visit_result_t = std::invoke_result_t<F, null_array>;
+    using visit_layout_type_result_t = std::invoke_result_t<F, std::type_identity<null_array>>;
+
+    /**
+     * @param dt The data type of the array.
+     * @param dictionary Whether the array is dictionary encoded, in which case
+     *                   \c dt is the type of its keys.
+     * @return Whether \c visit_layout_type supports arrays of type \c dt, in
+     *         which case it does not throw.
+     */
+    [[nodiscard]] constexpr bool is_visitable_layout_type(data_type dt, bool dictionary) noexcept
+    {
+        if (dictionary)
+        {
+            return data_type_is_integer(dt);
+        }
+        switch (dt)
+        {
+            case data_type::MAP:
+            case data_type::STRING_VIEW:
+            case data_type::BINARY_VIEW:
+                return false;
+            default:
+                return true;
+        }
+    }
 
+    /**
+     * Calls \c func with a \c std::type_identity of the layout type storing
+     * arrays of type \c dt, dictionary encoded or not.
+     *
+     * @param func The functor to call, it must accept the tag of any layout.
+     * @param dt The data type of the array.
+     * @param dictionary Whether the array is dictionary encoded, in which case
+     *                   \c dt is the type of its keys.
+     * @return The result of calling \c func.
+     * @exception std::runtime_error If the array is dictionary encoded and
+     *            \c dt is not an integer type.
+     * @exception std::invalid_argument If \c dt is not supported.
+     */
     template <class F>
-    [[nodiscard]] visit_result_t<F> visit(F&& func, const array_wrapper& ar)
+    [[nodiscard]] visit_layout_type_result_t<F> visit_layout_type(F&& func, data_type dt, bool dictionary)
     {
-        if (ar.is_dictionary())
+        if (dictionary)
         {
-            switch (ar.data_type())
+            switch (dt)
             {
                 case data_type::UINT8:
-                    return func(unwrap_array<dictionary_encoded_array<std::uint8_t>>(ar));
+                    return func(std::type_identity<dictionary_encoded_array<std::uint8_t>>{});
                 case data_type::INT8:
-                    return func(unwrap_array<dictionary_encoded_array<std::int8_t>>(ar));
+                    return func(std::type_identity<dictionary_encoded_array<std::int8_t>>{});
                 case data_type::UINT16:
-                    return func(unwrap_array<dictionary_encoded_array<std::uint16_t>>(ar));
+                    return func(std::type_identity<dictionary_encoded_array<std::uint16_t>>{});
                 case data_type::INT16:
-                    return func(unwrap_array<dictionary_encoded_array<std::int16_t>>(ar));
+                    return func(std::type_identity<dictionary_encoded_array<std::int16_t>>{});
                 case data_type::UINT32:
-                    return func(unwrap_array<dictionary_encoded_array<std::uint32_t>>(ar));
+                    return func(std::type_identity<dictionary_encoded_array<std::uint32_t>>{});
                 case data_type::INT32:
-                    return func(unwrap_array<dictionary_encoded_array<std::int32_t>>(ar));
+                    return func(std::type_identity<dictionary_encoded_array<std::int32_t>>{});
                 case data_type::UINT64:
-                    return func(unwrap_array<dictionary_encoded_array<std::uint64_t>>(ar));
+                    return func(std::type_identity<dictionary_encoded_array<std::uint64_t>>{});
                 case data_type::INT64:
-                    return func(unwrap_array<dictionary_encoded_array<std::int64_t>>(ar));
+                    return func(std::type_identity<dictionary_encoded_array<std::int64_t>>{});
                 default:
                     throw std::runtime_error("data datype of dictionary encoded array must be an integer");
             }
         }
         else
         {
-            switch (ar.data_type())
+            switch (dt)
             {
                 case data_type::NA:
-                    return func(unwrap_array<null_array>(ar));
+                    return func(std::type_identity<null_array>{});
                 case data_type::BOOL:
-                    return func(unwrap_array<primitive_array<bool>>(ar));
+                    return func(std::type_identity<primitive_array<bool>>{});
                 case data_type::UINT8:
-                    return func(unwrap_array<primitive_array<std::uint8_t>>(ar));
+                    return func(std::type_identity<primitive_array<std::uint8_t>>{});
                 case data_type::INT8:
-                    return func(unwrap_array<primitive_array<std::int8_t>>(ar));
+                    return func(std::type_identity<primitive_array<std::int8_t>>{});
                 case data_type::UINT16:
-                    return func(unwrap_array<primitive_array<std::uint16_t>>(ar));
+                    return func(std::type_identity<primitive_array<std::uint16_t>>{});
                 case data_type::INT16:
-                    return func(unwrap_array<primitive_array<std::int16_t>>(ar));
+                    return func(std::type_identity<primitive_array<std::int16_t>>{});
                 case data_type::UINT32:
-                    return func(unwrap_array<primitive_array<std::uint32_t>>(ar));
+                    return func(std::type_identity<primitive_array<std::uint32_t>>{});
                 case data_type::INT32:
-                    return func(unwrap_array<primitive_array<std::int32_t>>(ar));
+                    return func(std::type_identity<primitive_array<std::int32_t>>{});
                 case data_type::UINT64:
-                    return func(unwrap_array<primitive_array<std::uint64_t>>(ar));
+                    return func(std::type_identity<primitive_array<std::uint64_t>>{});
                 case data_type::INT64:
-                    return func(unwrap_array<primitive_array<std::int64_t>>(ar));
+                    return func(std::type_identity<primitive_array<std::int64_t>>{});
                 case data_type::HALF_FLOAT:
-                    return func(unwrap_array<primitive_array<float16_t>>(ar));
+                    return func(std::type_identity<primitive_array<float16_t>>{});
                 case data_type::FLOAT:
-                    return func(unwrap_array<primitive_array<float32_t>>(ar));
+                    return func(std::type_identity<primitive_array<float32_t>>{});
                 case data_type::DOUBLE:
-                    return func(unwrap_array<primitive_array<float64_t>>(ar));
+                    return func(std::type_identity<primitive_array<float64_t>>{});
                 case data_type::STRING:
-                    return func(unwrap_array<string_array>(ar));
+                    return func(std::type_identity<string_array>{});
                 case data_type::LARGE_STRING:
-                    return func(unwrap_array<big_string_array>(ar));
+                    return func(std::type_identity<big_string_array>{});
                 case data_type::BINARY:
-                    return func(unwrap_array<binary_array>(ar));
+                    return func(std::type_identity<binary_array>{});
                 case data_type::LARGE_BINARY:
-                    return func(unwrap_array<big_binary_array>(ar));
+                    return func(std::type_identity<big_binary_array>{});
                 case data_type::RUN_ENCODED:
-                    return func(unwrap_array<run_end_encoded_array>(ar));
+                    return func(std::type_identity<run_end_encoded_array>{});
                 case data_type::LIST:
-                    return func(unwrap_array<list_array>(ar));
+                    return func(std::type_identity<list_array>{});
                 case data_type::LARGE_LIST:
-                    return func(unwrap_array<big_list_array>(ar));
+                    return func(std::type_identity<big_list_array>{});
                 case data_type::LIST_VIEW:
-                    return func(unwrap_array<list_view_array>(ar));
+                    return func(std::type_identity<list_view_array>{});
                 case data_type::LARGE_LIST_VIEW:
-                    return func(unwrap_array<big_list_view_array>(ar));
+                    return func(std::type_identity<big_list_view_array>{});
                 case data_type::FIXED_SIZED_LIST:
-                    return func(unwrap_array<fixed_sized_list_array>(ar));
+                    return func(std::type_identity<fixed_sized_list_array>{});
                 case data_type::STRUCT:
-                    return func(unwrap_array<struct_array>(ar));
+                    return func(std::type_identity<struct_array>{});
                 case data_type::DENSE_UNION:
-                    return func(unwrap_array<dense_union_array>(ar));
+                    return func(std::type_identity<dense_union_array>{});
                 case data_type::SPARSE_UNION:
-                    return func(unwrap_array<sparse_union_array>(ar));
+                    return func(std::type_identity<sparse_union_array>{});
                 case data_type::DECIMAL32:
-                    return func(unwrap_array<decimal_32_array>(ar));
+                    return func(std::type_identity<decimal_32_array>{});
                 case data_type::DECIMAL64:
-                    return func(unwrap_array<decimal_64_array>(ar));
+                    return func(std::type_identity<decimal_64_array>{});
                 case data_type::DECIMAL128:
-                    return func(unwrap_array<decimal_128_array>(ar));
+                    return func(std::type_identity<decimal_128_array>{});
                 case data_type::DECIMAL256:
-                    return func(unwrap_array<decimal_256_array>(ar));
+                    return func(std::type_identity<decimal_256_array>{});
                 case data_type::FIXED_WIDTH_BINARY:
-                    return func(unwrap_array<fixed_width_binary_array>(ar));
+                    return func(std::type_identity<fixed_width_binary_array>{});
                 case sparrow::data_type::DATE_DAYS:
-                    return func(unwrap_array<date_days_array>(ar));
+                    return func(std::type_identity<date_days_array>{});
                 case data_type::DATE_MILLISECONDS:
-                    return func(unwrap_array<date_milliseconds_array>(ar));
+                    return func(std::type_identity<date_milliseconds_array>{});
                 case data_type::TIMESTAMP_SECONDS:
-                    return func(unwrap_array<timestamp_array<timestamp<std::chrono::seconds>>>(ar));
+                    return func(std::type_identity<timestamp_array<timestamp<std::chrono::seconds>>>{});
                 case data_type::TIMESTAMP_MILLISECONDS:
-                    return func(unwrap_array<timestamp_array<timestamp<std::chrono::milliseconds>>>(ar));
+                    return func(std::type_identity<timestamp_array<timestamp<std::chrono::milliseconds>>>{});
                 case data_type::TIMESTAMP_MICROSECONDS:
-                    return func(unwrap_array<timestamp_array<timestamp<std::chrono::microseconds>>>(ar));
+                    return func(std::type_identity<timestamp_array<timestamp<std::chrono::microseconds>>>{});
                 case data_type::TIMESTAMP_NANOSECONDS:
-                    return func(unwrap_array<timestamp_array<timestamp<std::chrono::nanoseconds>>>(ar));
+                    return func(std::type_identity<timestamp_array<timestamp<std::chrono::nanoseconds>>>{});
                 case data_type::TIME_SECONDS:
-                    return func(unwrap_array<time_seconds_array>(ar));
+                    return func(std::type_identity<time_seconds_array>{});
                 case data_type::TIME_MILLISECONDS:
-                    return func(unwrap_array<time_milliseconds_array>(ar));
+                    return func(std::type_identity<time_milliseconds_array>{});
                 case data_type::TIME_MICROSECONDS:
-                    return func(unwrap_array<time_microseconds_array>(ar));
+                    return func(std::type_identity<time_microseconds_array>{});
                 case data_type::TIME_NANOSECONDS:
-                    return func(unwrap_array<time_nanoseconds_array>(ar));
+                    return func(std::type_identity<time_nanoseconds_array>{});
                 case data_type::DURATION_SECONDS:
-                    return func(unwrap_array<duration_seconds_array>(ar));
+                    return func(std::type_identity<duration_seconds_array>{});
                 case data_type::DURATION_MILLISECONDS:
-                    return func(unwrap_array<duration_milliseconds_array>(ar));
+                    return func(std::type_identity<duration_milliseconds_array>{});
                 case data_type::DURATION_MICROSECONDS:
-                    return func(unwrap_array<duration_microseconds_array>(ar));
+                    return func(std::type_identity<duration_microseconds_array>{});
                 case data_type::DURATION_NANOSECONDS:
-                    return func(unwrap_array<duration_nanoseconds_array>(ar));
+                    return func(std::type_identity<duration_nanoseconds_array>{});
                 case data_type::INTERVAL_MONTHS:
-                    return func(unwrap_array<months_interval_array>(ar));
+                    return func(std::type_identity<months_interval_array>{});
                 case data_type::INTERVAL_DAYS_TIME:
-                    return func(unwrap_array<days_time_interval_array>(ar));
+                    return func(std::type_identity<days_time_interval_array>{});
                 case data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS:
-                    return func(unwrap_array<month_day_nanoseconds_interval_array>(ar));
+                    return func(std::type_identity<month_day_nanoseconds_interval_array>{});
                 default:
                     throw std::invalid_argument("array type not supported");
             }
         }
     }
+
+    template <class F>
+    using visit_result_t = std::invoke_result_t<F, null_array>;
+
+    template <class F>
+    [[nodiscard]] visit_result_t<F> visit(F&& func, const array_wrapper& ar)
+    {
+        return visit_layout_type(
+            [&func, &ar]<class T>(std::type_identity<T>) -> visit_result_t<F>
+            {
+                return func(unwrap_array<T>(ar));
+            },
+            ar.data_type(),
+            ar.is_dictionary()
+        );
+    }
+
+    /**
+     * Calls \c func on each element of \c ar in the range [\c first, \c last).
+     * The type of the layout is dispatched once for the whole range, and
+     * \c func receives the elements with their actual reference type, as
+     * the layout returns them. \c func must accept the elements of any
+     * layout.
+     *
+     * @code{.cpp}
+     * std::size_t non_null = 0;
+     * visit_elements(
+     *     [&non_null](const auto& value)
+     *     {
+     *         non_null += value.has_value();
+     *     },
+     *     wrapper,
+     *     0,
+     *     array_size(wrapper)
+     * );
+     * @endcode
+     */
+    template <class F>
+    void visit_elements(F&& func, const array_wrapper& ar, std::size_t first, std::size_t last)
+    {
+        SPARROW_ASSERT_TRUE(first <= last);
+        visit(
+            [&func, first, last](const auto& impl)
+            {
+                SPARROW_ASSERT_TRUE(last <= impl.size());
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    func(impl[i]);
+                }
+            },
+            ar
+        );
+    }
+
+    /**
+     * Calls \c func(child, child_indices, positions) for each child of a union
+     * array holding elements of \c partition, where \c child is the child
+     * array with its actual type, \c child_indices the indices of these
+     * elements in the child and \c positions their positions in the union
+     * array. The type of each child is dispatched once, whatever its number
+     * of elements.
+     *
+     * @code{.cpp}
+     * visit_partitions(
+     *     [&](const auto& child, std::span<const std::size_t> indices, std::span<const std::size_t> positions)
+     *     {
+     *         for (std::size_t k = 0; k < indices.size(); ++k)
+     *         {
+     *             out[positions[k]] = format_value(child[indices[k]]);
+     *         }
+     *     },
+     *     union_arr.partition()
+     * );
+     * @endcode
+     */
+    template <class F>
+    void visit_partitions(F&& func, const union_partition& partition)
+    {
+        for (std::size_t c = 0; c < partition.children_count(); ++c)
+        {
+            if (partition.size(c) == 0)
+            {
+                continue;
+            }
+            visit(
+                [&](const auto& child)
+                {
+                    func(child, partition.child_indices(c), partition.positions(c));
+                },
+                partition.child(c)
+            );
+        }
+    }
 }
@@ -403,6 +403,7 @@ namespace sparrow
     {
         SPARROW_ASSERT_TRUE(std::ranges::size(rhs) == m_element_size);
         SPARROW_ASSERT_TRUE(index < size());
+        this->detach();
         std::copy(std::ranges::begin(rhs), std::ranges::end(rhs), data(index * m_element_size));
     }
 
@@ -14,11 +14,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <ranges>
+
+#include "sparrow/buffer/buffer.hpp"
 #include "sparrow/layout/array_base.hpp"
+#include "sparrow/layout/validity_reference.hpp"
+#include "sparrow/utils/functor_index_iterator.hpp"
 #include "sparrow/utils/mp_utils.hpp"
 
 namespace sparrow
 {
+    template <class D>
+    class array_appender;
+
     /**
      * Base class definining common interface for arrays
      * with a bitmap.
@@ -27,6 +37,11 @@ namespace sparrow
      * common interface for arrays with a bitmap. The immutable
      * interface is inherited from \ref array_crtp_base.
      *
+     * The buffers of the array may be shared with copies of it; they are
+     * copied before the first modification of the array, when an element
+     * or its validity is assigned, or when elements are inserted or erased.
+     * Reading through the mutable interface does not copy them.
+     *
      * @tparam D The derived type, i.e. the inheriting class for which
      *           mutable_array_base provides the interface.
      */
@@ -44,9 +59,9 @@ namespace sparrow
         using difference_type = base_type::difference_type;
 
         using bitmap_type = typename inner_types::bitmap_type;
-        using bitmap_reference = bitmap_type::reference;
+        using bitmap_reference = validity_reference<self_type>;
         using bitmap_const_reference = bitmap_type::const_reference;
-        using bitmap_iterator = bitmap_type::iterator;
+        using bitmap_iterator = functor_index_iterator<detail::layout_validity_functor<self_type>>;
         using bitmap_range = std::ranges::subrange<bitmap_iterator>;
         using const_bitmap_range = base_type::const_bitmap_range;
 
@@ -112,6 +127,7 @@ namespace sparrow
             SPARROW_ASSERT_TRUE(pos <= this->cend());
             SPARROW_ASSERT_TRUE(first <= last);
             const difference_type distance = std::distance(this->cbegin(), pos);
+            detach();
             const auto validity_range = std::ranges::subrange(first, last)
                                         | std::views::transform(
                                             [](const auto& obj)
@@ -169,6 +185,8 @@ namespace sparrow
         void push_back(const nullable<T>& value);
         void pop_back();
 
+        [[nodiscard]] array_appender<D> appender(size_type capacity = 0);
+
     protected:
 
         mutable_array_base(arrow_proxy);
@@ -184,7 +202,103 @@ namespace sparrow
         [[nodiscard]] bitmap_iterator bitmap_begin();
         [[nodiscard]] bitmap_iterator bitmap_end();
 
+        // Copies the buffers shared with copies of the array before they are
+        // modified
+        void detach();
+
+        // Called by the validity references
+        void set_validity(size_type i, bool value);
+
+        // Modifiers that do not build the returned iterators, so that
+        // push_back and pop_back do not need a mutable access to the bitmap
+        template <typename T>
+        void insert_impl(size_type index, const nullable<T>& value, size_type count);
+        void erase_impl(size_type index, size_type count);
+
         friend class layout_iterator<iterator_types>;
+        friend class validity_reference<self_type>;
+    };
+
+    /**
+     * Batched append session on a mutable array.
+     *
+     * push_back writes the value and the validity bit of each element
+     * directly at the end of the buffers of the array, without updating
+     * its length, null count and cached views. commit() makes the appended
+     * elements part of the array in one step; it is called by the
+     * destructor. The array must not be accessed before the session is
+     * committed.
+     *
+     * The derived array must provide the reserve_values and append_value
+     * methods, and declare array_appender as a friend:
+     * - reserve_values(capacity) drops the data past the last element of
+     *   the array and reserves room for \c capacity elements.
+     * - append_value(value) appends a value after the last element.
+     *
+     * @tparam D The type of the array.
+     */
+    template <class D>
+    class array_appender
+    {
+    public:
+
+        using array_type = D;
+        using size_type = std::size_t;
+
+        /**
+         * Starts an append session on \c array.
+         *
+         * @param array The array to append to.
+         * @param capacity The number of elements the array is expected to hold at the end of the session.
+         */
+        explicit array_appender(array_type& array, size_type capacity = 0);
+        ~array_appender();
+
+        array_appender(const array_appender&) = delete;
+        array_appender& operator=(const array_appender&) = delete;
+        array_appender(array_appender&&) = delete;
+        array_appender& operator=(array_appender&&) = delete;
+
+        /**
+         * Reserves room for the array to hold \c capacity elements.
+         */
+        void reserve(size_type capacity);
+
+        template <typename T>
+        void push_back(const nullable<T>& value);
+
+        /**
+         * Appends the elements of \c range, reserving room for them first if the
+         * size of the range is known.
+         */
+        template <std::ranges::input_range R>
+            requires mpl::is_type_instance_of_v<std::ranges::range_value_t<R>, nullable>
+        void append(R&& range);
+
+        /**
+         * @return The number of elements of the array, including the elements
+         * appended since the beginning of the session.
+         */
+        [[nodiscard]] size_type size() const noexcept;
+
+        /**
+         * Updates the length and the null count of the array to include the
+         * appended elements. The session can be continued after a commit.
+         */
+        void commit();
+
+    private:
+
+        // Allocates the validity buffer of an array that had none, when the
+        // first null element is appended
+        void allocate_bitmap();
+
+        array_type* p_array;
+        buffer<std::uint8_t>* p_bitmap;
+        size_type m_offset;
+        size_type m_size;
+        bool m_all_valid = false;
+        bool m_dirty = false;
     };
 
     /*************************************
@@ -225,26 +339,66 @@ namespace sparrow
     auto mutable_array_base<D>::operator[](size_type i) -> reference
     {
         SPARROW_ASSERT_TRUE(i < this->size());
-        return reference(inner_reference(this->derived_cast().value(i)), this->derived_cast().has_value(i));
+        return reference(inner_reference(this->derived_cast().value(i)), has_value(i));
     }
 
     template <class D>
     auto mutable_array_base<D>::has_value(size_type i) -> bitmap_reference
     {
         SPARROW_ASSERT_TRUE(i < this->size());
-        return *sparrow::next(bitmap_begin(), i);
+        return bitmap_reference(this, i);
     }
 
     template <class D>
     auto mutable_array_base<D>::bitmap_begin() -> bitmap_iterator
     {
-        return sparrow::next(this->derived_cast().get_bitmap().begin(), this->get_arrow_proxy().offset());
+        return bitmap_iterator(detail::layout_validity_functor<self_type>(this), 0);
     }
 
     template <class D>
     auto mutable_array_base<D>::bitmap_end() -> bitmap_iterator
     {
-        return sparrow::next(bitmap_begin(), this->size());
+        return bitmap_iterator(detail::layout_validity_functor<self_type>(this), this->size());
+    }
+
+    template <class D>
+    void mutable_array_base<D>::set_validity(size_type i, bool value)
+    {
+        SPARROW_ASSERT_TRUE(i < this->size());
+        detach();
+        auto& derived = this->derived_cast();
+        if (derived.get_bitmap().data() == nullptr)
+        {
+            // Arrays without null elements may have no validity buffer, it
+            // is allocated when the first element is set to null.
+            if (value)
+            {
+                return;
+            }
+            this->get_arrow_proxy().allocate_bitmap();
+            derived.update();
+        }
+        derived.get_bitmap().set(this->get_arrow_proxy().offset() + i, value);
+    }
+
+    /**
+     * Starts a batched append session on the array, see \ref array_appender.
+     *
+     * @param capacity The number of elements the array is expected to hold at the end of the session.
+     */
+    template <class D>
+    auto mutable_array_base<D>::appender(size_type capacity) -> array_appender<D>
+    {
+        return array_appender<D>(this->derived_cast(), capacity);
+    }
+
+    template <class D>
+    void mutable_array_base<D>::detach()
+    {
+        if (this->get_arrow_proxy().detach_buffers())
+        {
+            this->derived_cast().update();
+        }
     }
 
     /**
@@ -259,6 +413,7 @@ namespace sparrow
     template <typename T>
     void mutable_array_base<D>::resize(size_type new_length, const nullable<T>& value)
     {
+        detach();
         auto& derived = this->derived_cast();
         derived.resize_bitmap(new_length, value.has_value());
         derived.resize_values(new_length, value.get());
@@ -296,12 +451,7 @@ namespace sparrow
         SPARROW_ASSERT_TRUE(pos >= this->cbegin());
         SPARROW_ASSERT_TRUE(pos <= this->cend());
         const size_t distance = static_cast<size_t>(std::distance(this->cbegin(), pos));
-        auto& derived = this->derived_cast();
-        derived.insert_bitmap(sparrow::next(this->bitmap_cbegin(), distance), value.has_value(), count);
-        derived.insert_value(sparrow::next(derived.value_cbegin(), distance), value.get(), count);
-        this->get_arrow_proxy().set_length(this->size() + count);  // Must be done after resizing the bitmap
-                                                                   // and values
-        derived.update();
+        insert_impl(distance, value, count);
         return sparrow::next(this->begin(), distance);
     }
 
@@ -353,12 +503,7 @@ namespace sparrow
             return sparrow::next(begin(), first_index);
         }
         const auto count = static_cast<size_t>(std::distance(first, last));
-        auto& derived = this->derived_cast();
-        derived.erase_bitmap(sparrow::next(this->bitmap_cbegin(), first_index), count);
-        derived.erase_values(sparrow::next(derived.value_cbegin(), first_index), count);
-        this->get_arrow_proxy().set_length(this->size() - count);  // Must be done after modifying the bitmap
-                                                                   // and values
-        derived.update();
+        erase_impl(static_cast<size_type>(first_index), count);
         return sparrow::next(begin(), first_index);
     }
 
@@ -371,7 +516,7 @@ namespace sparrow
     template <typename T>
     void mutable_array_base<D>::push_back(const nullable<T>& value)
     {
-        insert(this->cend(), value);
+        insert_impl(this->size(), value, 1);
     }
 
     /**
@@ -380,6 +525,139 @@ namespace sparrow
     template <class D>
     void mutable_array_base<D>::pop_back()
     {
-        erase(std::prev(this->cend()));
+        SPARROW_ASSERT_TRUE(this->size() != 0);
+        erase_impl(this->size() - 1, 1);
+    }
+
+    template <class D>
+    template <typename T>
+    void mutable_array_base<D>::insert_impl(size_type index, const nullable<T>& value, size_type count)
+    {
+        detach();
+        auto& derived = this->derived_cast();
+        derived.insert_bitmap(sparrow::next(this->bitmap_cbegin(), index), value.has_value(), count);
+        derived.insert_value(sparrow::next(derived.value_cbegin(), index), value.get(), count);
+        this->get_arrow_proxy().set_length(this->size() + count);  // Must be done after resizing the bitmap
+                                                                   // and values
+        derived.update();
+    }
+
+    template <class D>
+    void mutable_array_base<D>::erase_impl(size_type index, size_type count)
+    {
+        detach();
+        auto& derived = this->derived_cast();
+        derived.erase_bitmap(sparrow::next(this->bitmap_cbegin(), index), count);
+        derived.erase_values(sparrow::next(derived.value_cbegin(), index), count);
+        this->get_arrow_proxy().set_length(this->size() - count);  // Must be done after modifying the bitmap
+                                                                   // and values
+        derived.update();
+    }
+
+    /*********************************
+     * array_appender implementation *
+     *********************************/
+
+    template <class D>
+    array_appender<D>::array_appender(array_type& array, size_type capacity)
+        : p_array(&array)
+    {
+        arrow_proxy& proxy = p_array->get_arrow_proxy();
+        if (proxy.detach_buffers())
+        {
+            p_array->update();
+        }
+        p_bitmap = &proxy.get_array_private_data()->buffers()[0];
+        m_all_valid = p_bitmap->empty();
+        m_offset = proxy.offset();
+        m_size = proxy.length();
+        reserve(std::max(capacity, m_size));
+    }
+
+    template <class D>
+    array_appender<D>::~array_appender()
+    {
+        commit();
+    }
+
+    template <class D>
+    void array_appender<D>::reserve(size_type capacity)
+    {
+        if (!m_all_valid)
+        {
+            p_bitmap->reserve((m_offset + capacity + 7) / 8);
+        }
+        p_array->reserve_values(capacity);
+    }
+
+    template <class D>
+    void array_appender<D>::allocate_bitmap()
+    {
+        const size_type bit_count = m_offset + m_size;
+        p_bitmap->resize((bit_count + 7) / 8, std::uint8_t(0xFF));
+        if (bit_count % 8 != 0)
+        {
+            p_bitmap->back() = static_cast<std::uint8_t>((1u << (bit_count % 8)) - 1u);
+        }
+        m_all_valid = false;
+    }
+
+    template <class D>
+    template <typename T>
+    void array_appender<D>::push_back(const nullable<T>& value)
+    {
+        if (m_all_valid && !value.has_value())
+        {
+            allocate_bitmap();
+        }
+        // Arrays without null elements have no validity buffer to update
+        if (!m_all_valid)
+        {
+            const size_type index = m_offset + m_size;
+            const size_type byte_index = index / 8;
+            if (byte_index == p_bitmap->size())
+            {
+                p_bitmap->push_back(0);
+            }
+            const auto mask = static_cast<std::uint8_t>(1u << (index % 8));
+            std::uint8_t& byte = p_bitmap->data()[byte_index];
+            byte = value.has_value() ? static_cast<std::uint8_t>(byte | mask)
+                                     : static_cast<std::uint8_t>(byte & ~mask);
+        }
+        p_array->append_value(value.get());
+        ++m_size;
+        m_dirty = true;
+    }
+
+    template <class D>
+    template <std::ranges::input_range R>
+        requires mpl::is_type_instance_of_v<std::ranges::range_value_t<R>, nullable>
+    void array_appender<D>::append(R&& range)
+    {
+        if constexpr (std::ranges::sized_range<R>)
+        {
+            reserve(m_size + static_cast<size_type>(std::ranges::size(range)));
+        }
+        for (const auto& value : range)
+        {
+            push_back(value);
+        }
+    }
+
+    template <class D>
+    auto array_appender<D>::size() const noexcept -> size_type
+    {
+        return m_size;
+    }
+
+    template <class D>
+    void array_appender<D>::commit()
+    {
+        if (m_dirty)
+        {
+            p_array->get_arrow_proxy().set_length(m_size);
+            p_array->update();
+            m_dirty = false;
+        }
     }
-}
\ No newline at end of file
+}
@@ -15,12 +15,17 @@
 
 #pragma once
 
+#include <span>
+
 #include "sparrow/arrow_interface/arrow_array.hpp"
 #include "sparrow/arrow_interface/arrow_schema.hpp"
 #include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
 #include "sparrow/buffer/u8_buffer.hpp"
 #include "sparrow/layout/array_bitmap_base.hpp"
+#include "sparrow/layout/layout_utils.hpp"
 #include "sparrow/layout/primitive_layout/primitive_data_access.hpp"
+#include "sparrow/layout/primitive_layout/primitive_reference.hpp"
+#include "sparrow/utils/functor_index_iterator.hpp"
 #include "sparrow/utils/mp_utils.hpp"
 #include "sparrow/utils/repeat_container.hpp"
 
@@ -36,12 +41,13 @@ namespace sparrow
 
         using data_access_type = details::primitive_data_access<T>;
         using inner_value_type = typename data_access_type::inner_value_type;
-        using inner_reference = typename data_access_type::inner_reference;
+        using inner_reference = primitive_reference<array_type>;
         using inner_const_reference = typename data_access_type::inner_const_reference;
         using pointer = typename data_access_type::inner_pointer;
         using const_pointer = typename data_access_type::inner_const_pointer;
 
-        using value_iterator = typename data_access_type::value_iterator;
+        using functor_type = detail::layout_value_functor<array_type, inner_reference>;
+        using value_iterator = functor_index_iterator<functor_type>;
         using const_value_iterator = typename data_access_type::const_value_iterator;
 
         using bitmap_const_reference = bitmap_type::const_reference;
@@ -72,6 +78,8 @@ namespace sparrow
         using value_iterator = typename base_type::value_iterator;
         using const_value_iterator = typename base_type::const_value_iterator;
 
+        using functor_type = typename inner_types::functor_type;
+
         explicit primitive_array_impl(arrow_proxy);
 
         /**
@@ -125,6 +133,19 @@ namespace sparrow
         primitive_array_impl(primitive_array_impl&&);
         primitive_array_impl& operator=(primitive_array_impl&&);
 
+        /**
+         * @return A span on the contiguous values of the array, taking its
+         * offset into account. The values of the null elements are included.
+         * The buffers shared with copies of the array are copied first.
+         */
+        [[nodiscard]] std::span<inner_value_type> value_span();
+
+        /**
+         * @return A span on the contiguous values of the array, taking its
+         * offset into account. The values of the null elements are included.
+         */
+        [[nodiscard]] std::span<const inner_value_type> value_span() const;
+
     private:
 
         static arrow_proxy create_proxy(
@@ -178,11 +199,16 @@ namespace sparrow
             std::optional<std::string_view> metadata = std::nullopt
         );
 
+        [[nodiscard]] inner_reference value(size_type i);
         using access_class_type::value;
-        using access_class_type::value_begin;
+
+        [[nodiscard]] value_iterator value_begin();
+        [[nodiscard]] value_iterator value_end();
+
         using access_class_type::value_cbegin;
         using access_class_type::value_cend;
-        using access_class_type::value_end;
+
+        void assign(const inner_value_type& rhs, size_type index);
 
         // Modifiers
 
@@ -191,9 +217,15 @@ namespace sparrow
         using access_class_type::insert_values;
         using access_class_type::resize_values;
 
+        using access_class_type::append_value;
+        using access_class_type::reserve_values;
+
         static constexpr size_type DATA_BUFFER_INDEX = 1;
 
         friend class run_end_encoded_array;
+        friend class array_appender<self_type>;
+        friend class primitive_reference<self_type>;
+        friend functor_type;
         friend base_type;
         friend base_type::base_type;
         friend base_type::base_type::base_type;
@@ -240,6 +272,46 @@ namespace sparrow
         return *this;
     }
 
+    template <trivial_copyable_type T>
+    auto primitive_array_impl<T>::value_span() -> std::span<inner_value_type>
+    {
+        this->detach();
+        return access_class_type::value_span();
+    }
+
+    template <trivial_copyable_type T>
+    auto primitive_array_impl<T>::value_span() const -> std::span<const inner_value_type>
+    {
+        return access_class_type::value_span();
+    }
+
+    template <trivial_copyable_type T>
+    auto primitive_array_impl<T>::value(size_type i) -> inner_reference
+    {
+        SPARROW_ASSERT_TRUE(i < this->size());
+        return inner_reference(this, i);
+    }
+
+    template <trivial_copyable_type T>
+    auto primitive_array_impl<T>::value_begin() -> value_iterator
+    {
+        return value_iterator(functor_type(this), 0);
+    }
+
+    template <trivial_copyable_type T>
+    auto primitive_array_impl<T>::value_end() -> value_iterator
+    {
+        return value_iterator(functor_type(this), this->size());
+    }
+
+    template <trivial_copyable_type T>
+    void primitive_array_impl<T>::assign(const inner_value_type& rhs, size_type index)
+    {
+        SPARROW_ASSERT_TRUE(index < this->size());
+        this->detach();
+        access_class_type::value(index) = rhs;
+    }
+
     template <trivial_copyable_type T>
     template <validity_bitmap_input R>
     auto primitive_array_impl<T>::create_proxy(
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "sparrow/arrow_array_schema_proxy.hpp"
 #include "sparrow/buffer/buffer_adaptor.hpp"
 #include "sparrow/layout/array_access.hpp"
@@ -75,6 +77,9 @@ namespace sparrow
             [[nodiscard]] constexpr const_value_iterator value_cbegin() const;
             [[nodiscard]] constexpr const_value_iterator value_cend() const;
 
+            [[nodiscard]] constexpr std::span<inner_value_type> value_span();
+            [[nodiscard]] constexpr std::span<const inner_value_type> value_span() const;
+
             constexpr void resize_values(size_t new_length, const T& value);
 
             constexpr value_iterator insert_value(const_value_iterator pos, T value, size_t count);
@@ -90,6 +95,9 @@ namespace sparrow
             constexpr value_iterator erase_values(const_value_iterator pos, size_t count);
             constexpr value_iterator erase_values(size_t idx, size_t count);
 
+            constexpr void reserve_values(size_t capacity);
+            constexpr void append_value(const T& value);
+
             void reset_proxy(arrow_proxy& proxy);
 
         private:
@@ -166,6 +174,19 @@ namespace sparrow
             return sparrow::next(value_cbegin(), get_proxy().length());
         }
 
+        template <trivial_copyable_type T>
+        [[nodiscard]] constexpr auto primitive_data_access<T>::value_span() -> std::span<inner_value_type>
+        {
+            return std::span<inner_value_type>(data(), get_proxy().length());
+        }
+
+        template <trivial_copyable_type T>
+        [[nodiscard]] constexpr auto primitive_data_access<T>::value_span() const
+            -> std::span<const inner_value_type>
+        {
+            return std::span<const inner_value_type>(data(), get_proxy().length());
+        }
+
         template <trivial_copyable_type T>
         constexpr void primitive_data_access<T>::resize_values(size_t new_length, const T& value)
         {
@@ -254,6 +275,23 @@ namespace sparrow
             return sparrow::next(value_iterator{data()}, idx);
         }
 
+        template <trivial_copyable_type T>
+        constexpr void primitive_data_access<T>::reserve_values(size_t capacity)
+        {
+            const size_t offset = get_proxy().offset();
+            auto data_buffer = get_data_buffer();
+            data_buffer.resize(offset + get_proxy().length());
+            data_buffer.reserve(offset + capacity);
+        }
+
+        template <trivial_copyable_type T>
+        constexpr void primitive_data_access<T>::append_value(const T& value)
+        {
+            auto& buffer = get_proxy().get_array_private_data()->buffers()[m_data_buffer_index];
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(std::addressof(value));
+            buffer.insert(buffer.cend(), bytes, bytes + sizeof(T));
+        }
+
         template <trivial_copyable_type T>
         void primitive_data_access<T>::reset_proxy(arrow_proxy& proxy)
         {
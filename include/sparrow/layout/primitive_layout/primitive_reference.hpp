@@ -0,0 +1,226 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include <ostream>
+
+#if defined(__cpp_lib_format)
+#    include <format>
+#endif
+
+namespace sparrow
+{
+    /**
+     * Implementation of reference to inner type used for layout L
+     *
+     * Reading the value does not modify the layout; assigning it calls the
+     * \c assign method of the layout, which copies the buffers shared with
+     * other arrays before writing them.
+     *
+     * @tparam L the layout type
+     */
+    template <class L>
+    class primitive_reference
+    {
+    public:
+
+        using self_type = primitive_reference<L>;
+        using value_type = typename L::inner_value_type;
+        using const_reference = typename L::inner_const_reference;
+        using size_type = typename L::size_type;
+        using difference_type = std::ptrdiff_t;
+
+        primitive_reference(L* layout, size_type index);
+        primitive_reference(const primitive_reference&) = default;
+        primitive_reference(primitive_reference&&) = default;
+
+        self_type& operator=(const self_type& rhs);
+        self_type& operator=(self_type&& rhs);
+        self_type& operator=(const value_type& rhs);
+
+        template <class U>
+            requires requires(value_type& v, const U& u) { v += u; }
+        self_type& operator+=(const U& rhs);
+        template <class U>
+            requires requires(value_type& v, const U& u) { v -= u; }
+        self_type& operator-=(const U& rhs);
+        template <class U>
+            requires requires(value_type& v, const U& u) { v *= u; }
+        self_type& operator*=(const U& rhs);
+        template <class U>
+            requires requires(value_type& v, const U& u) { v /= u; }
+        self_type& operator/=(const U& rhs);
+
+        operator const_reference() const;
+
+        bool operator==(const self_type& rhs) const;
+
+        template <class U>
+            requires(!std::same_as<U, self_type>) && std::equality_comparable_with<value_type, U>
+        bool operator==(const U& rhs) const;
+
+        template <class U>
+            requires(!std::same_as<U, self_type>) && std::three_way_comparable_with<value_type, U>
+        auto operator<=>(const U& rhs) const;
+
+    private:
+
+        [[nodiscard]] const_reference value() const
+        {
+            return static_cast<const L*>(p_layout)->value(m_index);
+        }
+
+        L* p_layout = nullptr;
+        size_type m_index = size_type(0);
+    };
+}
+
+namespace sparrow
+{
+    /*************************************
+     * primitive_reference implementation *
+     *************************************/
+
+    template <class L>
+    primitive_reference<L>::primitive_reference(L* layout, size_type index)
+        : p_layout(layout)
+        , m_index(index)
+    {
+    }
+
+    template <class L>
+    auto primitive_reference<L>::operator=(const self_type& rhs) -> self_type&
+    {
+        p_layout->assign(rhs.value(), m_index);
+        return *this;
+    }
+
+    template <class L>
+    auto primitive_reference<L>::operator=(self_type&& rhs) -> self_type&
+    {
+        p_layout->assign(rhs.value(), m_index);
+        return *this;
+    }
+
+    template <class L>
+    auto primitive_reference<L>::operator=(const value_type& rhs) -> self_type&
+    {
+        p_layout->assign(rhs, m_index);
+        return *this;
+    }
+
+    template <class L>
+    template <class U>
+        requires requires(typename L::inner_value_type& v, const U& u) { v += u; }
+    auto primitive_reference<L>::operator+=(const U& rhs) -> self_type&
+    {
+        value_type res = value();
+        res += rhs;
+        return *this = res;
+    }
+
+    template <class L>
+    template <class U>
+        requires requires(typename L::inner_value_type& v, const U& u) { v -= u; }
+    auto primitive_reference<L>::operator-=(const U& rhs) -> self_type&
+    {
+        value_type res = value();
+        res -= rhs;
+        return *this = res;
+    }
+
+    template <class L>
+    template <class U>
+        requires requires(typename L::inner_value_type& v, const U& u) { v *= u; }
+    auto primitive_reference<L>::operator*=(const U& rhs) -> self_type&
+    {
+        value_type res = value();
+        res *= rhs;
+        return *this = res;
+    }
+
+    template <class L>
+    template <class U>
+        requires requires(typename L::inner_value_type& v, const U& u) { v /= u; }
+    auto primitive_reference<L>::operator/=(const U& rhs) -> self_type&
+    {
+        value_type res = value();
+        res /= rhs;
+        return *this = res;
+    }
+
+    template <class L>
+    primitive_reference<L>::operator const_reference() const
+    {
+        return value();
+    }
+
+    template <class L>
+    bool primitive_reference<L>::operator==(const self_type& rhs) const
+    {
+        return value() == rhs.value();
+    }
+
+    template <class L>
+    template <class U>
+        requires(!std::same_as<U, primitive_reference<L>>)
+                && std::equality_comparable_with<typename L::inner_value_type, U>
+    bool primitive_reference<L>::operator==(const U& rhs) const
+    {
+        return value() == rhs;
+    }
+
+    template <class L>
+    template <class U>
+        requires(!std::same_as<U, primitive_reference<L>>)
+                && std::three_way_comparable_with<typename L::inner_value_type, U>
+    auto primitive_reference<L>::operator<=>(const U& rhs) const
+    {
+        return value() <=> rhs;
+    }
+}
+
+#if defined(__cpp_lib_format)
+
+template <typename L>
+struct std::formatter<sparrow::primitive_reference<L>>
+{
+    constexpr auto parse(std::format_parse_context& ctx)
+    {
+        return ctx.begin();  // Simple implementation
+    }
+
+    auto format(const sparrow::primitive_reference<L>& ref, std::format_context& ctx) const
+    {
+        const typename L::inner_const_reference value = ref;
+        return std::format_to(ctx.out(), "{}", value);
+    }
+};
+
+#endif
+
+template <typename L>
+    requires requires(std::ostream& os, typename L::inner_const_reference v) { os << v; }
+inline std::ostream& operator<<(std::ostream& os, const sparrow::primitive_reference<L>& value)
+{
+    const typename L::inner_const_reference v = value;
+    os << v;
+    return os;
+}
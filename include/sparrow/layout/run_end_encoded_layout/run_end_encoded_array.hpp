@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <concepts>
+#include <cstdint>
+#include <variant>
+
 #include "sparrow/array_api.hpp"
 #include "sparrow/config/config.hpp"
 #include "sparrow/layout/array_access.hpp"
@@ -24,6 +28,7 @@
 namespace sparrow
 {
     class run_end_encoded_array;
+    class run_end_encoded_cursor;
 
     /**
      * Checks whether T is a run_end_encoded_array type.
@@ -89,6 +94,29 @@ namespace sparrow
         [[nodiscard]] SPARROW_API bool empty() const;
         [[nodiscard]] SPARROW_API size_type size() const;
 
+        /**
+         * @returns the number of runs, i.e. the length of the run ends and
+         * values children.
+         */
+        [[nodiscard]] SPARROW_API size_type run_count() const;
+
+        /**
+         * @returns a cursor for accessing the elements of the array in
+         * (mostly) increasing order without a binary search per element.
+         */
+        [[nodiscard]] SPARROW_API run_end_encoded_cursor cursor() const;
+
+        /**
+         * Calls \c f with the value and the length of each run, in order. This
+         * costs O(run_count()) instead of the O(size() * log(run_count())) of
+         * accessing each element.
+         *
+         * @param f A callable taking an array_traits::const_reference and the
+         * length of the run as an std::uint64_t.
+         */
+        template <std::invocable<array_traits::const_reference, std::uint64_t> F>
+        void for_each_run(F&& f) const;
+
         [[nodiscard]] std::optional<std::string_view> name() const;
         [[nodiscard]] std::optional<std::string_view> metadata() const;
 
@@ -108,6 +136,9 @@ namespace sparrow
         [[nodiscard]] SPARROW_API static acc_length_ptr_variant_type
         get_acc_lengths_ptr(const array_wrapper& ar);
         [[nodiscard]] SPARROW_API std::uint64_t get_run_length(std::uint64_t run_index) const;
+        [[nodiscard]] SPARROW_API std::uint64_t get_run_end(std::uint64_t run_index) const;
+        // Index of the run holding the element i, searching forward from the run \c first
+        [[nodiscard]] SPARROW_API std::uint64_t find_run(std::uint64_t i, std::uint64_t first) const;
 
         [[nodiscard]] SPARROW_API arrow_proxy& get_arrow_proxy();
         [[nodiscard]] SPARROW_API const arrow_proxy& get_arrow_proxy() const;
@@ -122,9 +153,93 @@ namespace sparrow
         // friend classes
         friend class run_encoded_array_iterator<false>;
         friend class run_encoded_array_iterator<true>;
+        friend class run_end_encoded_cursor;
         friend class detail::array_access;
     };
 
+    /**
+     * Accessor to the elements of a run_end_encoded_array that remembers the
+     * run of the last accessed element. Accessing an element of the same run
+     * costs O(1), and the run of an element further in the array is found by
+     * galloping from the current run, in O(log d) where d is the number of
+     * runs skipped. A scan in increasing order thus costs O(size() + run_count())
+     * instead of O(size() * log(run_count())) with operator[].
+     *
+     * The cursor references the array, which must outlive it.
+     */
+    class run_end_encoded_cursor
+    {
+    public:
+
+        using size_type = std::size_t;
+
+        SPARROW_API explicit run_end_encoded_cursor(const run_end_encoded_array& array);
+
+        /**
+         * Moves the cursor to the element \c i and returns it.
+         *
+         * @param i The index of the element, must be less than the size of the array.
+         */
+        [[nodiscard]] SPARROW_API array_traits::const_reference operator[](std::uint64_t i);
+
+        /**
+         * Moves the cursor to the element \c i.
+         *
+         * @param i The index of the element, must be less than the size of the array.
+         * @returns the index of the run holding the element.
+         */
+        SPARROW_API std::uint64_t seek(std::uint64_t i);
+
+        /**
+         * @returns the index of the current run.
+         */
+        [[nodiscard]] std::uint64_t run_index() const noexcept
+        {
+            return m_run;
+        }
+
+        /**
+         * @returns the index of the first element of the current run.
+         */
+        [[nodiscard]] std::uint64_t run_begin() const noexcept
+        {
+            return m_run_begin;
+        }
+
+        /**
+         * @returns the index following the last element of the current run.
+         */
+        [[nodiscard]] std::uint64_t run_end() const noexcept
+        {
+            return m_run_end;
+        }
+
+    private:
+
+        const run_end_encoded_array* p_array;
+        std::uint64_t m_run = 0;
+        std::uint64_t m_run_begin = 0;
+        std::uint64_t m_run_end = 0;
+    };
+
+    template <std::invocable<array_traits::const_reference, std::uint64_t> F>
+    void run_end_encoded_array::for_each_run(F&& f) const
+    {
+        std::visit(
+            [this, &f](const auto* acc_lengths_ptr)
+            {
+                std::uint64_t run_begin = 0;
+                for (std::uint64_t r = 0; r < m_encoded_length; ++r)
+                {
+                    const auto run_end = static_cast<std::uint64_t>(acc_lengths_ptr[r]);
+                    f(array_element(*p_encoded_values_array, static_cast<std::size_t>(r)), run_end - run_begin);
+                    run_begin = run_end;
+                }
+            },
+            m_acc_lengths
+        );
+    }
+
     SPARROW_API
     bool operator==(const run_end_encoded_array& lhs, const run_end_encoded_array& rhs);
 }  // namespace sparrow
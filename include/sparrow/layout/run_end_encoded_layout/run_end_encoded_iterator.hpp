@@ -71,7 +71,7 @@ namespace sparrow
         , p_encoded_values_array(array_ptr->p_encoded_values_array.get())
         , m_index(index)
         , m_run_end_index(run_end_index)
-        , m_runs_left(array_ptr->get_run_length(index))
+        , m_runs_left(index < array_ptr->size() ? array_ptr->get_run_length(run_end_index) : 0)
     {
     }
 
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "sparrow/arrow_interface/arrow_array.hpp"
 #include "sparrow/arrow_interface/arrow_schema.hpp"
 #include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
@@ -199,6 +201,21 @@ namespace sparrow
         timestamp_array(timestamp_array&& rhs);
         timestamp_array& operator=(timestamp_array&& rhs);
 
+        /**
+         * @return A span on the contiguous durations since the epoch stored in
+         * the array, taking its offset into account. The durations of the null
+         * elements are included. The buffers shared with copies of the array
+         * are copied first.
+         */
+        [[nodiscard]] std::span<inner_value_type_duration> value_span();
+
+        /**
+         * @return A span on the contiguous durations since the epoch stored in
+         * the array, taking its offset into account. The durations of the null
+         * elements are included.
+         */
+        [[nodiscard]] std::span<const inner_value_type_duration> value_span() const;
+
     private:
 
         [[nodiscard]] inner_reference value(size_type i);
@@ -512,6 +529,7 @@ namespace sparrow
     void timestamp_array<T>::assign(const T& rhs, size_type index)
     {
         SPARROW_ASSERT_TRUE(index < this->size());
+        this->detach();
         m_data_access.value(index) = rhs.get_sys_time().time_since_epoch();
     }
 
@@ -519,6 +537,7 @@ namespace sparrow
     void timestamp_array<T>::assign(T&& rhs, size_type index)
     {
         SPARROW_ASSERT_TRUE(index < this->size());
+        this->detach();
         m_data_access.value(index) = rhs.get_sys_time().time_since_epoch();
     }
 
@@ -539,6 +558,19 @@ namespace sparrow
         return T{m_timezone, sys_time};
     }
 
+    template <timestamp_type T>
+    auto timestamp_array<T>::value_span() -> std::span<inner_value_type_duration>
+    {
+        this->detach();
+        return m_data_access.value_span();
+    }
+
+    template <timestamp_type T>
+    auto timestamp_array<T>::value_span() const -> std::span<const inner_value_type_duration>
+    {
+        return m_data_access.value_span();
+    }
+
     template <timestamp_type T>
     auto timestamp_array<T>::value_begin() -> value_iterator
     {
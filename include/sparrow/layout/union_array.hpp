@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <span>
+#include <vector>
+
 #include "sparrow/array_api.hpp"
 #include "sparrow/array_factory.hpp"
 #include "sparrow/config/config.hpp"
@@ -22,6 +26,7 @@
 #include "sparrow/layout/array_wrapper.hpp"
 #include "sparrow/layout/layout_utils.hpp"
 #include "sparrow/layout/nested_value_types.hpp"
+#include "sparrow/utils/contracts.hpp"
 #include "sparrow/utils/crtp_base.hpp"
 #include "sparrow/utils/functor_index_iterator.hpp"
 #include "sparrow/utils/memory.hpp"
@@ -68,6 +73,81 @@ namespace sparrow
     template <class T>
     constexpr bool is_sparse_union_array_v = std::same_as<T, sparse_union_array>;
 
+    template <class DERIVED>
+    class union_array_crtp_base;
+
+    /**
+     * Elements of a range of a union array, grouped by child.
+     *
+     * For each child of the union, the partition holds the positions in the
+     * union array of the elements stored in that child, in increasing order,
+     * and the corresponding indices in the child. This allows to process the
+     * elements of a union child by child, with one dispatch on the type of
+     * each child instead of one per element (see visit_partitions).
+     */
+    class union_partition
+    {
+    public:
+
+        using size_type = std::size_t;
+
+        /**
+         * @returns the number of children of the union array.
+         */
+        [[nodiscard]] size_type children_count() const noexcept
+        {
+            return m_children.size();
+        }
+
+        /**
+         * @returns the child of index \c child.
+         */
+        [[nodiscard]] const array_wrapper& child(size_type child) const
+        {
+            return *m_children[child];
+        }
+
+        /**
+         * @returns the number of elements of the partition stored in the
+         * child of index \c child.
+         */
+        [[nodiscard]] size_type size(size_type child) const
+        {
+            return m_bounds[child + 1] - m_bounds[child];
+        }
+
+        /**
+         * @returns the positions in the union array of the elements stored in
+         * the child of index \c child.
+         */
+        [[nodiscard]] std::span<const size_type> positions(size_type child) const
+        {
+            return std::span<const size_type>(m_positions).subspan(m_bounds[child], size(child));
+        }
+
+        /**
+         * @returns the indices in the child of index \c child of its elements,
+         * in the same order as positions(child).
+         */
+        [[nodiscard]] std::span<const size_type> child_indices(size_type child) const
+        {
+            return std::span<const size_type>(m_child_indices).subspan(m_bounds[child], size(child));
+        }
+
+    private:
+
+        union_partition() = default;
+
+        std::vector<const array_wrapper*> m_children;
+        // Elements of child c are in [m_bounds[c], m_bounds[c + 1])
+        std::vector<size_type> m_bounds;
+        std::vector<size_type> m_positions;
+        std::vector<size_type> m_child_indices;
+
+        template <class DERIVED>
+        friend class union_array_crtp_base;
+    };
+
     // helper crtp-base to have sparse and dense and dense union share most of their code
     template <class DERIVED>
     class union_array_crtp_base : public crtp_base<DERIVED>
@@ -99,6 +179,13 @@ namespace sparrow
         [[nodiscard]] bool empty() const;
         [[nodiscard]] size_type size() const;
 
+        /**
+         * Groups the elements of the range [first, last) by child, in a
+         * single pass over the type ids.
+         */
+        [[nodiscard]] union_partition partition(size_type first, size_type last) const;
+        [[nodiscard]] union_partition partition() const;
+
         [[nodiscard]] iterator begin();
         [[nodiscard]] iterator end();
         [[nodiscard]] const_iterator begin() const;
@@ -402,6 +489,48 @@ namespace sparrow
         return m_proxy.length();
     }
 
+    template <class DERIVED>
+    union_partition union_array_crtp_base<DERIVED>::partition(size_type first, size_type last) const
+    {
+        SPARROW_ASSERT_TRUE(first <= last);
+        SPARROW_ASSERT_TRUE(last <= size());
+        const size_type n_children = m_children.size();
+        union_partition res;
+        res.m_children.reserve(n_children);
+        for (const auto& child : m_children)
+        {
+            res.m_children.push_back(child.get());
+        }
+
+        // Counting sort on the child index
+        res.m_bounds.assign(n_children + 1, 0);
+        for (size_type i = first; i < last; ++i)
+        {
+            ++res.m_bounds[static_cast<size_type>(m_type_id_map[p_type_ids[i]]) + 1];
+        }
+        for (size_type c = 0; c < n_children; ++c)
+        {
+            res.m_bounds[c + 1] += res.m_bounds[c];
+        }
+
+        std::vector<size_type> next(res.m_bounds.begin(), res.m_bounds.end() - 1);
+        res.m_positions.resize(last - first);
+        res.m_child_indices.resize(last - first);
+        for (size_type i = first; i < last; ++i)
+        {
+            const size_type k = next[m_type_id_map[p_type_ids[i]]]++;
+            res.m_positions[k] = i;
+            res.m_child_indices[k] = static_cast<size_type>(this->derived_cast().element_offset(i));
+        }
+        return res;
+    }
+
+    template <class DERIVED>
+    union_partition union_array_crtp_base<DERIVED>::partition() const
+    {
+        return partition(0, size());
+    }
+
     template <class DERIVED>
     bool union_array_crtp_base<DERIVED>::empty() const
     {
@@ -0,0 +1,176 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+
+namespace sparrow
+{
+    /**
+     * Reference proxy to the validity of an element of a mutable array.
+     *
+     * Reading the validity does not modify the array. Assigning it calls the
+     * \c set_validity method of the array, which copies the buffers shared
+     * with other arrays before writing them.
+     *
+     * @tparam L the array type
+     */
+    template <class L>
+    class validity_reference
+    {
+    public:
+
+        using self_type = validity_reference<L>;
+        using size_type = std::size_t;
+
+        validity_reference(L* layout, size_type index);
+        validity_reference(const validity_reference&) = default;
+        validity_reference(validity_reference&&) = default;
+
+        self_type& operator=(const self_type& rhs);
+        self_type& operator=(self_type&& rhs);
+        self_type& operator=(bool rhs);
+
+        operator bool() const;
+
+        bool operator~() const;
+
+        self_type& operator&=(bool rhs);
+        self_type& operator|=(bool rhs);
+        self_type& operator^=(bool rhs);
+
+    private:
+
+        L* p_layout = nullptr;
+        size_type m_index = size_type(0);
+    };
+
+    template <class L1, class L2>
+    bool operator==(const validity_reference<L1>& lhs, const validity_reference<L2>& rhs);
+
+    template <class L>
+    bool operator==(const validity_reference<L>& lhs, bool rhs);
+
+    namespace detail
+    {
+        // Functor returning the validity reference of the element i of a
+        // layout, to be passed to the functor_index_iterator.
+        template <class L>
+        class layout_validity_functor
+        {
+        public:
+
+            using layout_type = L;
+
+            constexpr explicit layout_validity_functor(layout_type* layout_ = nullptr)
+                : p_layout(layout_)
+            {
+            }
+
+            [[nodiscard]] validity_reference<layout_type> operator()(std::size_t i) const
+            {
+                return validity_reference<layout_type>(p_layout, i);
+            }
+
+        private:
+
+            layout_type* p_layout;
+        };
+    }
+
+    /************************************
+     * validity_reference implementation *
+     ************************************/
+
+    template <class L>
+    validity_reference<L>::validity_reference(L* layout, size_type index)
+        : p_layout(layout)
+        , m_index(index)
+    {
+    }
+
+    template <class L>
+    auto validity_reference<L>::operator=(const self_type& rhs) -> self_type&
+    {
+        return *this = static_cast<bool>(rhs);
+    }
+
+    template <class L>
+    auto validity_reference<L>::operator=(self_type&& rhs) -> self_type&
+    {
+        return *this = static_cast<bool>(rhs);
+    }
+
+    template <class L>
+    auto validity_reference<L>::operator=(bool rhs) -> self_type&
+    {
+        p_layout->set_validity(m_index, rhs);
+        return *this;
+    }
+
+    template <class L>
+    validity_reference<L>::operator bool() const
+    {
+        return static_cast<const L*>(p_layout)->has_value(m_index);
+    }
+
+    template <class L>
+    bool validity_reference<L>::operator~() const
+    {
+        return !static_cast<bool>(*this);
+    }
+
+    template <class L>
+    auto validity_reference<L>::operator&=(bool rhs) -> self_type&
+    {
+        if (!rhs)
+        {
+            *this = false;
+        }
+        return *this;
+    }
+
+    template <class L>
+    auto validity_reference<L>::operator|=(bool rhs) -> self_type&
+    {
+        if (rhs)
+        {
+            *this = true;
+        }
+        return *this;
+    }
+
+    template <class L>
+    auto validity_reference<L>::operator^=(bool rhs) -> self_type&
+    {
+        if (rhs)
+        {
+            *this = !static_cast<bool>(*this);
+        }
+        return *this;
+    }
+
+    template <class L1, class L2>
+    bool operator==(const validity_reference<L1>& lhs, const validity_reference<L2>& rhs)
+    {
+        return bool(lhs) == bool(rhs);
+    }
+
+    template <class L>
+    bool operator==(const validity_reference<L>& lhs, bool rhs)
+    {
+        return bool(lhs) == rhs;
+    }
+}
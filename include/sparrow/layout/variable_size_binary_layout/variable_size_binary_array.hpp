@@ -352,6 +352,13 @@ namespace sparrow
             requires mpl::convertible_ranges<U, T>
         void assign(U&& rhs, size_type index);
 
+        void reserve_values(size_type capacity);
+
+        template <std::ranges::sized_range U>
+            requires mpl::convertible_ranges<U, T>
+        void append_value(const U& value);
+
+        friend class array_appender<self_type>;
         friend class variable_size_binary_reference<self_type>;
         friend const_value_iterator;
         friend base_type;
@@ -368,12 +375,9 @@ namespace sparrow
         : base_type(std::move(proxy))
     {
         const auto type = this->get_arrow_proxy().data_type();
-        SPARROW_ASSERT_TRUE(type == data_type::STRING || type == data_type::BINARY);  // TODO: Add
-                                                                                      // data_type::LARGE_STRING
-                                                                                      // and
-                                                                                      // data_type::LARGE_BINARY
         SPARROW_ASSERT_TRUE(
             ((type == data_type::STRING || type == data_type::BINARY) && std::same_as<OT, int32_t>)
+            || ((type == data_type::LARGE_STRING || type == data_type::LARGE_BINARY) && std::same_as<OT, int64_t>)
         );
     }
 
@@ -513,6 +517,7 @@ namespace sparrow
     void variable_size_binary_array_impl<T, CR, OT>::assign(U&& rhs, size_type index)
     {
         SPARROW_ASSERT_TRUE(index < size());
+        this->detach();
         const auto offset_beg = *offset(index);
         const auto offset_end = *offset(index + 1);
         const auto initial_value_length = offset_end - offset_beg;
@@ -690,6 +695,37 @@ namespace sparrow
         return sparrow::next(value_begin(), idx);
     }
 
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array_impl<T, CR, OT>::reserve_values(size_type capacity)
+    {
+        auto& buffers = this->get_arrow_proxy().get_array_private_data()->buffers();
+        const size_t offset = this->get_arrow_proxy().offset();
+        auto offset_buffer_adaptor = make_buffer_adaptor<OT>(buffers[OFFSET_BUFFER_INDEX]);
+        offset_buffer_adaptor.resize(offset + size() + 1);
+        offset_buffer_adaptor.reserve(offset + capacity + 1);
+        buffers[DATA_BUFFER_INDEX].resize(static_cast<size_t>(offset_buffer_adaptor.back()));
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    template <std::ranges::sized_range U>
+        requires mpl::convertible_ranges<U, T>
+    void variable_size_binary_array_impl<T, CR, OT>::append_value(const U& value)
+    {
+        auto& buffers = this->get_arrow_proxy().get_array_private_data()->buffers();
+        auto& data_buffer = buffers[DATA_BUFFER_INDEX];
+        const size_t old_size = data_buffer.size();
+        data_buffer.resize(old_size + std::ranges::size(value));
+        std::ranges::transform(
+            value,
+            sparrow::next(data_buffer.begin(), old_size),
+            [](const auto& v)
+            {
+                return static_cast<uint8_t>(v);
+            }
+        );
+        make_buffer_adaptor<OT>(buffers[OFFSET_BUFFER_INDEX]).push_back(static_cast<OT>(data_buffer.size()));
+    }
+
     template <std::ranges::sized_range T, class CR, layout_offset OT>
     auto variable_size_binary_array_impl<T, CR, OT>::insert_offset(
         const_offset_iterator pos,
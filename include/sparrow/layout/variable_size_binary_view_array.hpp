@@ -16,6 +16,8 @@
 
 #include <cstddef>
 #include <ranges>
+#include <span>
+#include <type_traits>
 
 #include "sparrow/arrow_array_schema_proxy.hpp"
 #include "sparrow/arrow_interface/arrow_array.hpp"
@@ -25,6 +27,7 @@
 #include "sparrow/layout/array_access.hpp"
 #include "sparrow/layout/array_bitmap_base.hpp"
 #include "sparrow/layout/layout_utils.hpp"
+#include "sparrow/layout/variable_size_binary_view_builder.hpp"
 #include "sparrow/utils/functor_index_iterator.hpp"
 #include "sparrow/utils/iterator.hpp"
 #include "sparrow/utils/nullable.hpp"
@@ -62,6 +65,12 @@ namespace sparrow
                 return sparrow::data_type::BINARY_VIEW;
             }
         };
+
+        // Values whose bytes can be copied without converting them first. Arrays are
+        // excluded since character literals are converted up to their null terminator.
+        template <class V>
+        concept contiguous_bytes = std::ranges::contiguous_range<V> && std::ranges::sized_range<V>
+                                   && !std::is_array_v<V> && sizeof(std::ranges::range_value_t<V>) == 1;
     }
 
     template <class T>
@@ -150,6 +159,18 @@ namespace sparrow
             std::optional<std::string_view> metadata = std::nullopt
         );
 
+        // max_data_buffer_size is the size cap of the variadic data buffers,
+        // see variable_size_binary_view_builder
+        template <std::ranges::input_range R, validity_bitmap_input VB>
+            requires std::convertible_to<std::ranges::range_value_t<R>, T>
+        [[nodiscard]] static arrow_proxy create_proxy(
+            R&& range,
+            VB&& bitmap_input,
+            std::size_t max_data_buffer_size,
+            std::optional<std::string_view> name = std::nullopt,
+            std::optional<std::string_view> metadata = std::nullopt
+        );
+
         [[nodiscard]] inner_reference value(size_type i);
         [[nodiscard]] inner_const_reference value(size_type i) const;
 
@@ -160,17 +181,12 @@ namespace sparrow
         [[nodiscard]] const_value_iterator value_cend() const;
 
         static constexpr size_type LENGTH_BUFFER_INDEX = 1;
-        static constexpr std::size_t DATA_BUFFER_SIZE = 16;
-        static constexpr std::size_t SHORT_STRING_SIZE = 12;
-        static constexpr std::size_t PREFIX_SIZE = 4;
-        static constexpr std::ptrdiff_t PREFIX_OFFSET = 4;
-        static constexpr std::ptrdiff_t SHORT_STRING_OFFSET = 4;
-        static constexpr std::ptrdiff_t BUFFER_INDEX_OFFSET = 8;
-        static constexpr std::ptrdiff_t BUFFER_OFFSET_OFFSET = 12;
-        static constexpr std::size_t FIRST_VAR_DATA_BUFFER_INDEX = 2;
 
         friend base_type;
         friend base_type::base_type;
+        friend base_type::base_type::base_type;
+        friend class detail::layout_value_functor<self_type, inner_value_type>;
+        friend class detail::layout_value_functor<const self_type, inner_value_type>;
     };
 
     template <class T>
@@ -189,91 +205,49 @@ namespace sparrow
         std::optional<std::string_view> metadata
     )
     {
-#ifdef __GNUC__
-#    pragma GCC diagnostic push
-#    pragma GCC diagnostic ignored "-Wcast-align"
-#endif
-
-        const auto size = range_size(range);
-        validity_bitmap vbitmap = ensure_validity_bitmap(size, std::forward<VB>(validity_input));
-        const auto null_count = vbitmap.null_count();
-
-        buffer<uint8_t> length_buffer(size * DATA_BUFFER_SIZE);
+        return create_proxy(
+            std::forward<R>(range),
+            std::forward<VB>(validity_input),
+            variable_size_binary_view_builder::default_max_data_buffer_size,
+            std::move(name),
+            std::move(metadata)
+        );
+    }
 
-        std::size_t long_string_storage_size = 0;
-        std::size_t i = 0;
+    template <class T>
+    template <std::ranges::input_range R, validity_bitmap_input VB>
+        requires std::convertible_to<std::ranges::range_value_t<R>, T>
+    arrow_proxy variable_size_binary_view_array_impl<T>::create_proxy(
+        R&& range,
+        VB&& validity_input,
+        std::size_t max_data_buffer_size,
+        std::optional<std::string_view> name,
+        std::optional<std::string_view> metadata
+    )
+    {
+        // The range is iterated only once, its size may not be known beforehand
+        variable_size_binary_view_builder builder(max_data_buffer_size);
+        if constexpr (std::ranges::sized_range<R>)
+        {
+            builder.reserve(range_size(range));
+        }
+        using value_type = std::remove_cvref_t<std::ranges::range_reference_t<R>>;
         for (auto&& val : range)
         {
-            auto val_casted = val
-                              | std::ranges::views::transform(
-                                  [](const auto& v)
-                                  {
-                                      return static_cast<std::uint8_t>(v);
-                                  }
-                              );
-
-            const auto length = val.size();
-            auto length_ptr = length_buffer.data() + (i * DATA_BUFFER_SIZE);
-
-            // write length
-            *reinterpret_cast<std::int32_t*>(length_ptr) = static_cast<std::int32_t>(length);
-
-            if (length <= SHORT_STRING_SIZE)
+            if constexpr (detail::contiguous_bytes<value_type>)
             {
-                // write data itself
-                std::ranges::copy(val_casted, length_ptr + SHORT_STRING_OFFSET);
+                builder.push_back(std::as_bytes(std::span(std::ranges::data(val), std::ranges::size(val))));
             }
             else
             {
-                // write the prefix of the data
-                auto prefix_sub_range = val_casted | std::ranges::views::take(PREFIX_SIZE);
-                std::ranges::copy(prefix_sub_range, length_ptr + PREFIX_OFFSET);
-
-                // write the buffer index
-                *reinterpret_cast<std::int32_t*>(
-                    length_ptr + BUFFER_INDEX_OFFSET
-                ) = static_cast<std::int32_t>(FIRST_VAR_DATA_BUFFER_INDEX);
-
-                // write the buffer offset
-                *reinterpret_cast<std::int32_t*>(
-                    length_ptr + BUFFER_OFFSET_OFFSET
-                ) = static_cast<std::int32_t>(long_string_storage_size);
-
-                // count the size of the long string storage
-                long_string_storage_size += length;
+                const T value = val;
+                builder.push_back(std::as_bytes(std::span(value.data(), value.size())));
             }
-            ++i;
         }
 
-        // write the long string storage
-        buffer<uint8_t> long_string_storage(long_string_storage_size);
-        std::size_t long_string_storage_offset = 0;
-        for (auto&& val : range)
-        {
-            const auto length = val.size();
-            if (length > SHORT_STRING_SIZE)
-            {
-                auto val_casted = val
-                                  | std::ranges::views::transform(
-                                      [](const auto& v)
-                                      {
-                                          return static_cast<std::uint8_t>(v);
-                                      }
-                                  );
-
-                std::ranges::copy(val_casted, long_string_storage.data() + long_string_storage_offset);
-                long_string_storage_offset += length;
-            }
-        }
-
-        // For binary or utf-8 view arrays, an extra buffer is appended which stores
-        // the lengths of each variadic data buffer as int64_t.
-        // This buffer is necessary since these buffer lengths are not trivially
-        // extractable from other data in an array of binary or utf-8 view type.
-        u8_buffer<int64_t> buffer_sizes(
-            static_cast<std::size_t>(1),
-            static_cast<int64_t>(long_string_storage_size)
-        );
+        const auto size = builder.size();
+        validity_bitmap vbitmap = ensure_validity_bitmap(size, std::forward<VB>(validity_input));
+        const auto null_count = vbitmap.null_count();
 
         const repeat_view<bool> children_ownership(true, 0);
 
@@ -289,12 +263,9 @@ namespace sparrow
             true
         );
 
-        std::vector<buffer<uint8_t>> buffers{
-            std::move(vbitmap).extract_storage(),
-            std::move(length_buffer),
-            std::move(long_string_storage),
-            std::move(buffer_sizes).extract_storage()
-        };
+        // The views, the variadic data buffers and their sizes follow the bitmap
+        std::vector<buffer<uint8_t>> buffers = builder.finish();
+        buffers.insert(buffers.begin(), std::move(vbitmap).extract_storage());
 
         // create arrow array
         ArrowArray arr = make_arrow_array(
@@ -309,10 +280,6 @@ namespace sparrow
         );
 
         return arrow_proxy{std::move(arr), std::move(schema)};
-
-#ifdef __GNUC__
-#    pragma GCC diagnostic pop
-#endif
     }
 
     template <class T>
@@ -333,7 +300,7 @@ namespace sparrow
 
         constexpr std::size_t element_size = 16;
         auto data_ptr = this->get_arrow_proxy().buffers()[LENGTH_BUFFER_INDEX].template data<uint8_t>()
-                        + (i * element_size);
+                        + ((this->get_arrow_proxy().offset() + i) * element_size);
 
         auto length = static_cast<std::size_t>(*reinterpret_cast<const std::int32_t*>(data_ptr));
         using char_or_byte = typename inner_const_reference::value_type;
@@ -367,7 +334,7 @@ namespace sparrow
     template <class T>
     auto variable_size_binary_view_array_impl<T>::value_begin() -> value_iterator
     {
-        return value_iterator(detail::layout_value_functor<self_type, inner_value_type>(), 0);
+        return value_iterator(detail::layout_value_functor<self_type, inner_value_type>(this), 0);
     }
 
     template <class T>
@@ -0,0 +1,88 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/config/config.hpp"
+
+namespace sparrow
+{
+    /**
+     * Builds the buffers of a binary view array in a single pass over its
+     * values, so that they can be read from input ranges that cannot be
+     * iterated twice.
+     *
+     * The 16-byte views are written as the values are appended. The values
+     * that are too long to be inlined in their view are copied in bulk into
+     * variadic data buffers, which grow geometrically up to a size cap: a new
+     * data buffer is started when a value does not fit in the current one.
+     * A value longer than the cap gets a data buffer of its own.
+     */
+    class SPARROW_API variable_size_binary_view_builder
+    {
+    public:
+
+        static constexpr std::size_t default_max_data_buffer_size = std::size_t(2) * 1024 * 1024;
+
+        // The offsets in the data buffers are stored as 32-bit integers
+        static constexpr std::size_t max_data_buffer_size_limit = std::numeric_limits<std::int32_t>::max();
+
+        /**
+         * @param max_data_buffer_size The size cap of the variadic data buffers.
+         * @exception std::invalid_argument If \c max_data_buffer_size is 0 or
+         * greater than \c max_data_buffer_size_limit.
+         */
+        explicit variable_size_binary_view_builder(std::size_t max_data_buffer_size = default_max_data_buffer_size);
+
+        /**
+         * Reserves the views of \c count values.
+         */
+        void reserve(std::size_t count);
+
+        /**
+         * Appends the view of \c value, copying it into a data buffer if it
+         * cannot be inlined.
+         * @exception std::length_error If \c value is longer than
+         * \c max_data_buffer_size_limit bytes.
+         */
+        void push_back(std::span<const std::byte> value);
+
+        /**
+         * @return The number of values appended.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @return The buffers following the validity bitmap in a binary view
+         * array: the views, the variadic data buffers and the buffer holding
+         * the sizes of the data buffers. The builder is left empty.
+         */
+        [[nodiscard]] std::vector<buffer<std::uint8_t>> finish();
+
+    private:
+
+        [[nodiscard]] buffer<std::uint8_t>& data_buffer_for(std::size_t size);
+
+        std::size_t m_max_data_buffer_size;
+        buffer<std::uint8_t> m_views;
+        std::vector<buffer<std::uint8_t>> m_data_buffers;
+    };
+}
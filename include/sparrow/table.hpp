@@ -0,0 +1,191 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sparrow/chunked_array.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/record_batch.hpp"
+
+namespace sparrow
+{
+    /**
+     * Table-like data structure whose columns are chunked arrays.
+     *
+     * A table is a collection of equal-length chunked arrays mapped to
+     * names. It is typically built from a sequence of record batches with
+     * the same schema: each batch adds one chunk to every column, and the
+     * arrays of the batches are not copied.
+     */
+    class table
+    {
+    public:
+
+        using name_type = std::string;
+        using size_type = std::size_t;
+
+        using name_range = std::ranges::ref_view<const std::vector<name_type>>;
+        using column_range = std::ranges::ref_view<const std::vector<chunked_array>>;
+
+        table() = default;
+
+        /**
+         * Constructs a @ref table from a range of names and a range of chunked
+         * arrays. Each chunked array is mapped to the name at the same position
+         * in the names range.
+         *
+         * @param names An input range of names. The names must be unique.
+         * @param columns An input range of chunked arrays, which must have the same size.
+         */
+        template <std::ranges::input_range NR, std::ranges::input_range CR>
+            requires(std::convertible_to<std::ranges::range_value_t<NR>, std::string> and std::same_as<std::ranges::range_value_t<CR>, chunked_array>)
+        table(NR&& names, CR&& columns);
+
+        /**
+         * Constructs a @ref table from a range of record batches. The columns
+         * of the table have one chunk per batch.
+         *
+         * @param batches An input range of record batches.
+         * @exception std::invalid_argument if the batches do not have the same
+         * column names, in the same order, and the same data types.
+         */
+        template <std::ranges::input_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, record_batch>
+        explicit table(R&& batches);
+
+        /**
+         * @returns the number of columns in the \ref table.
+         */
+        [[nodiscard]] SPARROW_API size_type nb_columns() const;
+
+        /**
+         * @returns the number of rows in the \ref table.
+         */
+        [[nodiscard]] SPARROW_API size_type nb_rows() const;
+
+        /**
+         * Checks if the \ref table contains a column mapped to the specified name.
+         */
+        [[nodiscard]] SPARROW_API bool contains_column(const name_type& key) const;
+
+        /**
+         * @returns the name mapped to the column at the given index. The index
+         * must be less than the number of columns.
+         */
+        [[nodiscard]] SPARROW_API const name_type& get_column_name(size_type index) const;
+
+        /**
+         * @returns the column mapped to the specified name.
+         * @exception std::out_of_range if the column is not found.
+         */
+        [[nodiscard]] SPARROW_API const chunked_array& get_column(const name_type& key) const;
+
+        /**
+         * @returns the column at the specified index. The index must be less
+         * than the number of columns.
+         */
+        [[nodiscard]] SPARROW_API const chunked_array& get_column(size_type index) const;
+
+        /**
+         * @returns a range of the names in the \ref table.
+         */
+        [[nodiscard]] SPARROW_API name_range names() const;
+
+        /**
+         * @returns a range of the columns of the \ref table.
+         */
+        [[nodiscard]] SPARROW_API column_range columns() const;
+
+        /**
+         * Appends \c column to the table, and maps it with \c name.
+         *
+         * @exception std::invalid_argument if the name is already used or
+         * if the size of \c column differs from the number of rows.
+         */
+        SPARROW_API void add_column(name_type name, chunked_array column);
+
+        /**
+         * Appends the rows of \c batch to the table: each column of the batch
+         * becomes the last chunk of the column with the same name. If the
+         * table has no column, the columns are created from the batch.
+         *
+         * @exception std::invalid_argument if the columns of \c batch do not
+         * have the names of the columns of the table, in the same order, and
+         * the same data types.
+         */
+        SPARROW_API void add_batch(const record_batch& batch);
+
+    private:
+
+        SPARROW_API void update_column_map();
+
+        std::vector<name_type> m_name_list;
+        std::vector<chunked_array> m_column_list;
+        std::unordered_map<name_type, size_type> m_column_map;
+
+        friend SPARROW_API table concatenate(std::span<const table> tables);
+    };
+
+    /**
+     * Compares the names and the content of the columns of two \ref table
+     * objects, regardless of the way the columns are split into chunks.
+     */
+    SPARROW_API bool operator==(const table& lhs, const table& rhs);
+
+    /**
+     * Concatenates the rows of tables with the same columns. Each column
+     * of the result holds the chunks of the same column in the \c tables;
+     * the data of the chunks is not copied.
+     *
+     * @exception std::invalid_argument if the tables do not have the same
+     * column names, in the same order, and the same data types.
+     */
+    [[nodiscard]] SPARROW_API table concatenate(std::span<const table> tables);
+
+    /************************
+     * table implementation *
+     ************************/
+
+    template <std::ranges::input_range NR, std::ranges::input_range CR>
+        requires(std::convertible_to<std::ranges::range_value_t<NR>, std::string> and std::same_as<std::ranges::range_value_t<CR>, chunked_array>)
+    table::table(NR&& names, CR&& columns)
+    {
+        for (auto&& name : names)
+        {
+            m_name_list.emplace_back(name);
+        }
+        for (auto&& column : columns)
+        {
+            m_column_list.push_back(std::forward<decltype(column)>(column));
+        }
+        update_column_map();
+    }
+
+    template <std::ranges::input_range R>
+        requires std::same_as<std::ranges::range_value_t<R>, record_batch>
+    table::table(R&& batches)
+    {
+        for (const record_batch& batch : batches)
+        {
+            add_batch(batch);
+        }
+    }
+}
@@ -532,6 +532,10 @@ namespace sparrow
                 return "z";
             case data_type::LARGE_BINARY:
                 return "Z";
+            case data_type::STRING_VIEW:
+                return "vu";
+            case data_type::BINARY_VIEW:
+                return "vz";
             case data_type::DATE_DAYS:
                 return "tdD";
             case data_type::DATE_MILLISECONDS:
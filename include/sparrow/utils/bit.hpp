@@ -18,6 +18,10 @@
 #include <array>
 #include <bit>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#include "sparrow/config/config.hpp"
 
 namespace sparrow
 {
@@ -49,4 +53,17 @@ namespace sparrow
             return value;
         }
     }
+
+    /**
+     * Counts the number of bits set in a contiguous sequence of bytes.
+     *
+     * The implementation is selected at runtime according to the capabilities
+     * of the CPU: AVX-512 VPOPCNTDQ or AVX2 on x86-64, NEON on AArch64, and a
+     * 64-bit word at a time scalar loop otherwise.
+     *
+     * \param data Pointer to the first byte. Can be null if \p size is 0.
+     * \param size The number of bytes to inspect.
+     * \return The number of bits set to 1.
+     */
+    [[nodiscard]] SPARROW_API std::size_t count_set_bits(const std::uint8_t* data, std::size_t size) noexcept;
 }
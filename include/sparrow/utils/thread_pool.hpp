@@ -0,0 +1,115 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sparrow/config/config.hpp"
+
+namespace sparrow
+{
+    /**
+     * Interface of the thread pools used to run the parallel algorithms of
+     * sparrow.
+     *
+     * Implement this interface to run sparrow tasks on the thread pool of
+     * an application instead of the one provided by sparrow.
+     */
+    class thread_pool
+    {
+    public:
+
+        using task_type = std::function<void()>;
+
+        virtual ~thread_pool() = default;
+
+        /**
+         * Schedules \c task for execution. The task must not throw; tasks
+         * scheduled by sparrow catch their own exceptions.
+         */
+        virtual void submit(task_type task) = 0;
+
+        /**
+         * @return The number of tasks the pool can run at the same time.
+         */
+        [[nodiscard]] virtual std::size_t concurrency() const = 0;
+
+    protected:
+
+        thread_pool() = default;
+        thread_pool(const thread_pool&) = default;
+        thread_pool(thread_pool&&) = default;
+        thread_pool& operator=(const thread_pool&) = default;
+        thread_pool& operator=(thread_pool&&) = default;
+    };
+
+    /**
+     * Thread pool where each worker owns a queue of tasks.
+     *
+     * A task submitted by a worker is pushed to the queue of that worker,
+     * other tasks are spread over the queues in a round-robin fashion. A
+     * worker runs the tasks of its own queue, the most recent first, and
+     * steals the oldest tasks of the other queues when its own queue is
+     * empty.
+     *
+     * The pending tasks are run before the destructor returns.
+     */
+    class work_stealing_thread_pool final : public thread_pool
+    {
+    public:
+
+        /**
+         * Starts \c nb_threads workers, or one if \c nb_threads is 0.
+         */
+        SPARROW_API explicit work_stealing_thread_pool(std::size_t nb_threads = std::thread::hardware_concurrency());
+        SPARROW_API ~work_stealing_thread_pool() override;
+
+        work_stealing_thread_pool(const work_stealing_thread_pool&) = delete;
+        work_stealing_thread_pool(work_stealing_thread_pool&&) = delete;
+        work_stealing_thread_pool& operator=(const work_stealing_thread_pool&) = delete;
+        work_stealing_thread_pool& operator=(work_stealing_thread_pool&&) = delete;
+
+        SPARROW_API void submit(task_type task) override;
+        [[nodiscard]] SPARROW_API std::size_t concurrency() const override;
+
+    private:
+
+        struct worker_queue;
+
+        void run(std::size_t index);
+        [[nodiscard]] task_type pop_task(std::size_t index);
+
+        std::vector<std::unique_ptr<worker_queue>> m_queues;
+        std::vector<std::thread> m_threads;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::size_t m_pending = 0;
+        std::size_t m_next_queue = 0;
+        bool m_stop = false;
+    };
+
+    /**
+     * @return The thread pool used by sparrow when none is specified: a
+     * work_stealing_thread_pool with one worker per hardware thread, started
+     * on the first call.
+     */
+    [[nodiscard]] SPARROW_API thread_pool& default_thread_pool();
+}
@@ -29,6 +29,7 @@
 #include "sparrow/layout/temporal/timestamp_array.hpp"
 #include "sparrow/layout/union_array.hpp"
 #include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
 
 namespace sparrow
 {
@@ -119,6 +120,10 @@ namespace sparrow
                     return detail::make_wrapper_ptr<binary_array>(std::move(proxy));
                 case data_type::LARGE_BINARY:
                     return detail::make_wrapper_ptr<big_binary_array>(std::move(proxy));
+                case data_type::STRING_VIEW:
+                    return detail::make_wrapper_ptr<string_view_array>(std::move(proxy));
+                case data_type::BINARY_VIEW:
+                    return detail::make_wrapper_ptr<binary_view_array>(std::move(proxy));
                 case data_type::RUN_ENCODED:
                     return detail::make_wrapper_ptr<run_end_encoded_array>(std::move(proxy));
                 case data_type::DENSE_UNION:
@@ -18,19 +18,68 @@
 
 namespace sparrow
 {
-    std::size_t array_size(const array_wrapper& ar)
+    namespace detail
     {
-        return visit(
-            [](const auto& impl)
+        namespace
+        {
+            template <class T>
+            struct layout_kernels
             {
-                return impl.size();
-            },
-            ar
-        );
+                static std::size_t size(const array_wrapper& ar)
+                {
+                    return unwrap_array<T>(ar).size();
+                }
+
+                static bool has_value(const array_wrapper& ar, std::size_t index)
+                {
+                    return unwrap_array<T>(ar)[index].has_value();
+                }
+
+                static array_traits::const_reference element(const array_wrapper& ar, std::size_t index)
+                {
+                    return array_traits::const_reference(unwrap_array<T>(ar)[index]);
+                }
+
+                static constexpr array_kernels table{&size, &has_value, &element};
+            };
+        }
+
+        const array_kernels* get_array_kernels(data_type dt, bool dictionary)
+        {
+            // Layouts that visit does not support can still be wrapped,
+            // accessing their elements reports the error.
+            if (!is_visitable_layout_type(dt, dictionary))
+            {
+                return nullptr;
+            }
+            return visit_layout_type(
+                []<class T>(std::type_identity<T>) -> const array_kernels*
+                {
+                    return &layout_kernels<T>::table;
+                },
+                dt,
+                dictionary
+            );
+        }
+    }
+
+    std::size_t array_size(const array_wrapper& ar)
+    {
+        if (const auto* kernels = ar.kernels())
+        {
+            return kernels->size(ar);
+        }
+        // The length does not depend on the layout, which lets layouts that
+        // visit does not support (binary views, maps) live in record batches.
+        return ar.get_arrow_proxy().length();
     }
 
     bool array_has_value(const array_wrapper& ar, std::size_t index)
     {
+        if (const auto* kernels = ar.kernels())
+        {
+            return kernels->has_value(ar, index);
+        }
         return visit(
             [index](const auto& impl)
             {
@@ -42,6 +91,10 @@ namespace sparrow
 
     array_traits::const_reference array_element(const array_wrapper& ar, std::size_t index)
     {
+        if (const auto* kernels = ar.kernels())
+        {
+            return kernels->element(ar, index);
+        }
         using return_type = array_traits::const_reference;
         return visit(
             [index](const auto& impl) -> return_type
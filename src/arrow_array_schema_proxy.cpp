@@ -139,6 +139,16 @@ namespace sparrow
     {
     }
 
+    bool arrow_proxy::detach_buffers()
+    {
+        if (!array_created_with_sparrow() || !get_array_private_data()->detach_buffers())
+        {
+            return false;
+        }
+        update_buffers();
+        return true;
+    }
+
     arrow_proxy::arrow_proxy(ArrowArray* array, ArrowSchema* schema)
         : arrow_proxy(array, schema, impl_tag{})
     {
@@ -758,6 +768,8 @@ namespace sparrow
 
         SPARROW_ASSERT_TRUE(is_created_with_sparrow())
         SPARROW_ASSERT_TRUE(has_bitmap(data_type()))
+        // The bitmap is modified in place
+        detach_buffers();
         auto private_data = static_cast<arrow_array_private_data*>(array().private_data);
         auto& bitmap_buffer = private_data->buffers()[bitmap_buffer_index];
         const size_t current_size = length() + offset();
@@ -793,9 +805,9 @@ namespace sparrow
             return index;
         }
         auto bitmap = get_non_owning_dynamic_bitset();
-        auto it = bitmap.insert(sparrow::next(bitmap.cbegin(), index), count, value);
+        bitmap.insert(sparrow::next(bitmap.cbegin(), index), count, value);
         update_buffers();
-        return std::distance(bitmap.begin(), it);
+        return index;
     }
 
     size_t arrow_proxy::erase_bitmap(size_t index, size_t count)
@@ -811,9 +823,9 @@ namespace sparrow
         auto bitmap = get_non_owning_dynamic_bitset();
         const auto it_first = sparrow::next(bitmap.cbegin(), index + offset());
         const auto it_last = sparrow::next(it_first, count);
-        const auto it = bitmap.erase(it_first, it_last);
+        bitmap.erase(it_first, it_last);
         update_buffers();
-        return std::distance(bitmap.begin(), it);
+        return index + offset();
     }
 
     void arrow_proxy::push_back_bitmap(bool value)
@@ -842,6 +854,24 @@ namespace sparrow
         update_buffers();
     }
 
+    void arrow_proxy::allocate_bitmap()
+    {
+        if (!array_created_with_sparrow())
+        {
+            throw arrow_proxy_exception(
+                "Cannot allocate bitmap on a non-sparrow created ArrowArray or ArrowSchema"
+            );
+        }
+        SPARROW_ASSERT_TRUE(has_bitmap(data_type()))
+        if (buffers()[bitmap_buffer_index].data() != nullptr)
+        {
+            return;
+        }
+        auto bitmap = get_non_owning_dynamic_bitset();
+        bitmap.allocate_storage();
+        update_buffers();
+    }
+
     arrow_proxy arrow_proxy::slice(size_t start, size_t end) const
     {
         SPARROW_ASSERT_TRUE(start <= end);
@@ -14,6 +14,9 @@
 
 #include "sparrow/arrow_interface/arrow_array.hpp"
 
+#include <algorithm>
+#include <span>
+
 #include "sparrow/arrow_interface/arrow_array_schema_common_release.hpp"
 #include "sparrow/layout/fixed_width_binary_layout/fixed_width_binary_array_utils.hpp"
 #include "sparrow/types/data_type.hpp"
@@ -174,13 +177,39 @@ namespace sparrow
                 {
                     buffers[i + 2] = make_buffer(i + 2, var_buffer_sizes[i]);
                 }
-                buffers.back() = make_buffer(buffer_count - 1, size * 4);
+                // One int64_t per variadic data buffer
+                buffers.back() = make_buffer(buffer_count - 1, num_extra_data_buffers * sizeof(int64_t));
                 return buffers;
         }
         // To avoid stupid warning "control reaches end of non-void function"
         return {};
     }
 
+    bool is_arrow_aligned(const ArrowArray& array, std::size_t alignment)
+    {
+        const auto buffers = std::span(array.buffers, static_cast<std::size_t>(array.n_buffers));
+        const bool buffers_aligned = std::ranges::all_of(
+            buffers,
+            [alignment](const void* buffer)
+            {
+                return buffer == nullptr || is_aligned(buffer, alignment);
+            }
+        );
+        if (!buffers_aligned)
+        {
+            return false;
+        }
+        const auto children = std::span(array.children, static_cast<std::size_t>(array.n_children));
+        const bool children_aligned = std::ranges::all_of(
+            children,
+            [alignment](const ArrowArray* child)
+            {
+                return child == nullptr || is_arrow_aligned(*child, alignment);
+            }
+        );
+        return children_aligned && (array.dictionary == nullptr || is_arrow_aligned(*array.dictionary, alignment));
+    }
+
     void swap(ArrowArray& lhs, ArrowArray& rhs)
     {
         std::swap(lhs.length, rhs.length);
@@ -229,11 +258,14 @@ namespace sparrow
         target.n_buffers = source_array.n_buffers;
 
         std::vector<buffer<std::uint8_t>> buffers_copy;
-        buffers_copy.reserve(static_cast<std::size_t>(source_array.n_buffers));
-
-        for (const auto& buffer : buffers)
+        const bool share = source_array.release == std::addressof(release_arrow_array);
+        if (!share)
         {
-            buffers_copy.emplace_back(buffer);
+            buffers_copy.reserve(static_cast<std::size_t>(source_array.n_buffers));
+            for (const auto& buffer : buffers)
+            {
+                buffers_copy.emplace_back(buffer);
+            }
         }
         target.private_data = new arrow_array_private_data(
             std::move(buffers_copy),
@@ -241,6 +273,11 @@ namespace sparrow
             true
         );
         const auto private_data = static_cast<arrow_array_private_data*>(target.private_data);
+        if (share)
+        {
+            // The buffers of arrays created by sparrow are copied on write
+            static_cast<const arrow_array_private_data*>(source_array.private_data)->share_buffers(*private_data);
+        }
         target.buffers = private_data->buffers_ptrs<void>();
         target.release = release_arrow_array;
     }
@@ -14,6 +14,8 @@
 
 #include "sparrow/arrow_interface/arrow_schema.hpp"
 
+#include <string_view>
+
 #include "sparrow/arrow_interface/arrow_array_schema_common_release.hpp"
 #include "sparrow/utils/repeat_container.hpp"
 
@@ -89,4 +91,20 @@ namespace sparrow
         target.release = release_arrow_schema;
     }
 
+    bool same_data_type(const ArrowSchema& lhs, const ArrowSchema& rhs)
+    {
+        if (std::string_view(lhs.format) != std::string_view(rhs.format) || lhs.n_children != rhs.n_children
+            || (lhs.dictionary == nullptr) != (rhs.dictionary == nullptr))
+        {
+            return false;
+        }
+        for (int64_t i = 0; i < lhs.n_children; ++i)
+        {
+            if (!same_data_type(*lhs.children[i], *rhs.children[i]))
+            {
+                return false;
+            }
+        }
+        return lhs.dictionary == nullptr || same_data_type(*lhs.dictionary, *rhs.dictionary);
+    }
 }
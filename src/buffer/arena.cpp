@@ -0,0 +1,44 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/buffer/arena.hpp"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Defined in the library so that sparrow and its clients share the same
+        // instance even when the symbols are not exported.
+        std::shared_ptr<arena>& thread_arena() noexcept
+        {
+            thread_local std::shared_ptr<arena> current;
+            return current;
+        }
+    }
+
+    const std::shared_ptr<arena>& current_arena() noexcept
+    {
+        return thread_arena();
+    }
+
+    arena_scope::arena_scope(std::shared_ptr<arena> a)
+        : m_previous(std::exchange(thread_arena(), std::move(a)))
+    {
+    }
+
+    arena_scope::~arena_scope()
+    {
+        thread_arena() = std::move(m_previous);
+    }
+}
@@ -0,0 +1,244 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/chunked_array.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    /*****************************************
+     * chunked_array_iterator implementation *
+     *****************************************/
+
+    chunked_array_iterator::chunked_array_iterator(const chunked_array* ar, size_type index)
+        : p_array(ar)
+        , m_index(index)
+        , m_chunk(index < ar->size() ? ar->locate(index).first : ar->nb_chunks())
+    {
+    }
+
+    array::const_reference chunked_array_iterator::dereference() const
+    {
+        return p_array->m_chunks[m_chunk][m_index - p_array->m_offsets[m_chunk]];
+    }
+
+    void chunked_array_iterator::increment()
+    {
+        ++m_index;
+        // Skips the empty chunks
+        while (m_chunk < p_array->nb_chunks() && m_index >= p_array->m_offsets[m_chunk + 1])
+        {
+            ++m_chunk;
+        }
+    }
+
+    void chunked_array_iterator::decrement()
+    {
+        --m_index;
+        while (m_index < p_array->m_offsets[m_chunk])
+        {
+            --m_chunk;
+        }
+    }
+
+    void chunked_array_iterator::advance(difference_type n)
+    {
+        m_index = static_cast<size_type>(static_cast<difference_type>(m_index) + n);
+        const bool in_chunk = m_chunk < p_array->nb_chunks() && m_index >= p_array->m_offsets[m_chunk]
+                              && m_index < p_array->m_offsets[m_chunk + 1];
+        if (!in_chunk)
+        {
+            m_chunk = m_index < p_array->size() ? p_array->locate(m_index).first : p_array->nb_chunks();
+        }
+    }
+
+    auto chunked_array_iterator::distance_to(const chunked_array_iterator& rhs) const -> difference_type
+    {
+        return static_cast<difference_type>(rhs.m_index) - static_cast<difference_type>(m_index);
+    }
+
+    bool chunked_array_iterator::equal(const chunked_array_iterator& rhs) const
+    {
+        return p_array == rhs.p_array && m_index == rhs.m_index;
+    }
+
+    bool chunked_array_iterator::less_than(const chunked_array_iterator& rhs) const
+    {
+        return m_index < rhs.m_index;
+    }
+
+    /********************************
+     * chunked_array implementation *
+     ********************************/
+
+    auto chunked_array::size() const noexcept -> size_type
+    {
+        return m_offsets.back();
+    }
+
+    bool chunked_array::empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    enum data_type chunked_array::data_type() const
+    {
+        SPARROW_ASSERT_TRUE(!m_chunks.empty());
+        return m_chunks.front().data_type();
+    }
+
+    auto chunked_array::nb_chunks() const noexcept -> size_type
+    {
+        return m_chunks.size();
+    }
+
+    const array& chunked_array::chunk(size_type index) const
+    {
+        SPARROW_ASSERT_TRUE(index < nb_chunks());
+        return m_chunks[index];
+    }
+
+    auto chunked_array::chunks() const -> chunk_range
+    {
+        return std::ranges::ref_view(m_chunks);
+    }
+
+    auto chunked_array::chunk_offsets() const noexcept -> std::span<const size_type>
+    {
+        return m_offsets;
+    }
+
+    auto chunked_array::locate(size_type index) const -> std::pair<size_type, size_type>
+    {
+        SPARROW_ASSERT_TRUE(index < size());
+        // The first chunk starting after index is the one following the
+        // chunk that holds it; empty chunks share their offset with the
+        // next chunk and are skipped.
+        const auto iter = std::upper_bound(m_offsets.begin(), m_offsets.end(), index);
+        const auto chunk_index = static_cast<size_type>(std::distance(m_offsets.begin(), iter)) - 1;
+        return {chunk_index, index - m_offsets[chunk_index]};
+    }
+
+    auto chunked_array::at(size_type index) const -> const_reference
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("chunked_array::at: index out of range");
+        }
+        return (*this)[index];
+    }
+
+    auto chunked_array::operator[](size_type index) const -> const_reference
+    {
+        const auto [chunk_index, local_index] = locate(index);
+        return m_chunks[chunk_index][local_index];
+    }
+
+    auto chunked_array::begin() const -> const_iterator
+    {
+        return cbegin();
+    }
+
+    auto chunked_array::end() const -> const_iterator
+    {
+        return cend();
+    }
+
+    auto chunked_array::cbegin() const -> const_iterator
+    {
+        return const_iterator(this, 0);
+    }
+
+    auto chunked_array::cend() const -> const_iterator
+    {
+        return const_iterator(this, size());
+    }
+
+    namespace
+    {
+        // The formats of the schemas are compared recursively, so that nested
+        // chunks with different children are rejected
+        bool same_data_type(const array& lhs, const array& rhs)
+        {
+            return sparrow::same_data_type(
+                detail::array_access::get_arrow_proxy(lhs).schema(),
+                detail::array_access::get_arrow_proxy(rhs).schema()
+            );
+        }
+    }
+
+    void chunked_array::add_chunk(array chunk)
+    {
+        if (!m_chunks.empty() && !same_data_type(chunk, m_chunks.front()))
+        {
+            throw std::invalid_argument("chunked_array: the chunks must have the same data type");
+        }
+        const size_type new_size = size() + chunk.size();
+        m_chunks.push_back(std::move(chunk));
+        try
+        {
+            m_offsets.push_back(new_size);
+        }
+        catch (...)
+        {
+            m_chunks.pop_back();
+            throw;
+        }
+    }
+
+    void chunked_array::check_and_index_chunks()
+    {
+        m_offsets.clear();
+        m_offsets.reserve(m_chunks.size() + 1);
+        m_offsets.push_back(0);
+        for (const array& chunk : m_chunks)
+        {
+            if (!same_data_type(chunk, m_chunks.front()))
+            {
+                throw std::invalid_argument("chunked_array: the chunks must have the same data type");
+            }
+            m_offsets.push_back(m_offsets.back() + chunk.size());
+        }
+    }
+
+    bool operator==(const chunked_array& lhs, const chunked_array& rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    chunked_array concatenate(std::span<const chunked_array> arrays)
+    {
+        std::size_t nb_chunks = 0;
+        for (const chunked_array& ar : arrays)
+        {
+            nb_chunks += ar.nb_chunks();
+        }
+
+        chunked_array res;
+        res.m_chunks.reserve(nb_chunks);
+        res.m_offsets.reserve(nb_chunks + 1);
+        for (const chunked_array& ar : arrays)
+        {
+            std::ranges::copy(ar.m_chunks, std::back_inserter(res.m_chunks));
+        }
+        res.check_and_index_chunks();
+        return res;
+    }
+}
@@ -0,0 +1,251 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "sparrow/compute/compact.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/types/data_type.hpp"
+
+#include "kernel_utils.hpp"
+
+namespace sparrow::compute
+{
+    namespace
+    {
+        using detail::copy_validity;
+        using detail::first_data_buffer_index;
+        using detail::is_set;
+        using detail::read_int32;
+        using detail::short_view_size;
+        using detail::validity_of;
+        using detail::view_buffer_index_offset;
+        using detail::view_buffer_offset_offset;
+        using detail::view_size;
+        using detail::write_int32;
+
+        constexpr auto data_buffers_begin = static_cast<std::size_t>(first_data_buffer_index);
+
+        // Location of a long value in the data buffers of the result
+        struct value_location
+        {
+            std::int32_t buffer_index;
+            std::int32_t offset;
+        };
+
+        // Bytes referenced by the views of the valid elements in each data
+        // buffer of the array
+        std::vector<std::size_t> referenced_bytes(const arrow_proxy& source, std::size_t data_buffer_count)
+        {
+            const std::uint8_t* validity = validity_of(source);
+            const std::uint8_t* views = source.buffers()[1].data();
+            std::vector<std::size_t> res(data_buffer_count, 0);
+            for (std::size_t i = source.offset(); i < source.offset() + source.length(); ++i)
+            {
+                const std::uint8_t* view = views + i * view_size;
+                const auto size = static_cast<std::size_t>(read_int32(view));
+                if (size > short_view_size && (validity == nullptr || is_set(validity, i)))
+                {
+                    const auto index = static_cast<std::size_t>(read_int32(view + view_buffer_index_offset));
+                    res[index - data_buffers_begin] += size;
+                }
+            }
+            return res;
+        }
+
+        // Copies the long values of the rewritten data buffers into new
+        // data buffers of at most max_size bytes. Each new data buffer is
+        // allocated once, with the size of the values left to copy.
+        class data_buffers_writer
+        {
+        public:
+
+            data_buffers_writer(std::int32_t first_index, std::size_t max_size, std::size_t total_size)
+                : m_first_index(first_index)
+                , m_max_size(max_size)
+                , m_remaining_size(total_size)
+            {
+            }
+
+            value_location write(const std::uint8_t* value, std::size_t size)
+            {
+                if (m_buffers.empty() || m_buffers.back().size() + size > m_max_size)
+                {
+                    m_buffers.emplace_back();
+                    m_buffers.back().reserve(std::max(size, std::min(m_max_size, m_remaining_size)));
+                }
+                buffer<std::uint8_t>& data = m_buffers.back();
+                const std::size_t offset = data.size();
+                data.resize(offset + size);
+                std::memcpy(data.data() + offset, value, size);
+                skip(size);
+                return {
+                    static_cast<std::int32_t>(m_first_index + static_cast<std::int32_t>(m_buffers.size()) - 1),
+                    static_cast<std::int32_t>(offset)
+                };
+            }
+
+            // Values that do not have to be copied, when they are deduplicated
+            void skip(std::size_t size)
+            {
+                m_remaining_size -= size;
+            }
+
+            std::vector<buffer<std::uint8_t>>& buffers()
+            {
+                return m_buffers;
+            }
+
+        private:
+
+            std::int32_t m_first_index;
+            std::size_t m_max_size;
+            std::size_t m_remaining_size;
+            std::vector<buffer<std::uint8_t>> m_buffers;
+        };
+    }
+
+    namespace detail
+    {
+        arrow_proxy compact(const arrow_proxy& source, const compact_options& options)
+        {
+            const data_type type = source.data_type();
+            if (type != data_type::STRING_VIEW && type != data_type::BINARY_VIEW)
+            {
+                throw std::invalid_argument("compact: only string view and binary view arrays can be compacted");
+            }
+            if (options.max_data_buffer_size == 0
+                || options.max_data_buffer_size > variable_size_binary_view_builder::max_data_buffer_size_limit)
+            {
+                throw std::invalid_argument("compact: invalid size cap of the data buffers");
+            }
+
+            // The buffers are the validity bitmap, the views, the data
+            // buffers and the sizes of the data buffers
+            const auto& source_buffers = source.buffers();
+            const std::size_t data_buffer_count = source_buffers.size() - 3;
+            const std::vector<std::size_t> referenced = referenced_bytes(source, data_buffer_count);
+
+            // Index of each data buffer in the result, -1 if it is rewritten
+            std::vector<std::int32_t> new_index(data_buffer_count, -1);
+            std::int32_t kept_count = 0;
+            std::size_t rewritten_size = 0;
+            for (std::size_t k = 0; k < data_buffer_count; ++k)
+            {
+                const auto size = static_cast<double>(source_buffers[k + data_buffers_begin].size());
+                if (referenced[k] != 0 && static_cast<double>(referenced[k]) >= options.min_occupancy * size)
+                {
+                    new_index[k] = first_data_buffer_index + kept_count++;
+                }
+                else
+                {
+                    rewritten_size += referenced[k];
+                }
+            }
+            if (std::cmp_equal(kept_count, data_buffer_count))
+            {
+                return source;
+            }
+
+            // A copy of the array shares its buffers, the data buffers that
+            // are kept are moved from it to the result
+            arrow_proxy shared = source;
+            auto& shared_buffers = shared.get_array_private_data()->buffers();
+
+            const std::size_t offset = source.offset();
+            const std::size_t length = source.length();
+            const std::uint8_t* validity = validity_of(source);
+            const std::uint8_t* views = source_buffers[1].data();
+            buffer<std::uint8_t> new_views(length * view_size, std::uint8_t(0));
+            data_buffers_writer writer(first_data_buffer_index + kept_count, options.max_data_buffer_size, rewritten_size);
+            std::unordered_map<std::string_view, value_location> locations;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                if (validity != nullptr && !is_set(validity, offset + i))
+                {
+                    continue;
+                }
+                const std::uint8_t* view = views + (offset + i) * view_size;
+                std::uint8_t* new_view = new_views.data() + i * view_size;
+                std::memcpy(new_view, view, view_size);
+                const auto size = static_cast<std::size_t>(read_int32(view));
+                if (size <= short_view_size)
+                {
+                    continue;
+                }
+
+                const auto index = static_cast<std::size_t>(read_int32(view + view_buffer_index_offset));
+                const std::int32_t value_offset = read_int32(view + view_buffer_offset_offset);
+                const std::int32_t kept_index = new_index[index - data_buffers_begin];
+                const std::uint8_t* value = source_buffers[index].data() + value_offset;
+                value_location location{kept_index, value_offset};
+                if (options.deduplicate)
+                {
+                    const std::string_view key(reinterpret_cast<const char*>(value), size);
+                    const auto [it, inserted] = locations.try_emplace(key, location);
+                    if (!inserted && kept_index < 0)
+                    {
+                        writer.skip(size);
+                        location = it->second;
+                    }
+                    else if (kept_index < 0)
+                    {
+                        location = it->second = writer.write(value, size);
+                    }
+                }
+                else if (kept_index < 0)
+                {
+                    location = writer.write(value, size);
+                }
+                write_int32(new_view + view_buffer_index_offset, location.buffer_index);
+                write_int32(new_view + view_buffer_offset_offset, location.offset);
+            }
+
+            std::vector<buffer<std::uint8_t>>& written = writer.buffers();
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(static_cast<std::size_t>(kept_count) + written.size() + 3);
+            std::size_t null_count = 0;
+            buffers.push_back(copy_validity(source, null_count));
+            buffers.push_back(std::move(new_views));
+            for (std::size_t k = 0; k < data_buffer_count; ++k)
+            {
+                if (new_index[k] >= 0)
+                {
+                    buffers.push_back(std::move(shared_buffers[k + data_buffers_begin]));
+                }
+            }
+            for (auto& data : written)
+            {
+                buffers.push_back(std::move(data));
+            }
+            u8_buffer<std::int64_t> buffer_sizes(buffers.size() - 2, std::int64_t(0));
+            for (std::size_t k = 2; k < buffers.size(); ++k)
+            {
+                buffer_sizes[k - 2] = static_cast<std::int64_t>(buffers[k].size());
+            }
+            buffers.push_back(std::move(buffer_sizes).extract_storage());
+
+            ArrowArray result = make_result(length, null_count, std::move(buffers));
+            return arrow_proxy(std::move(result), copy_schema(source.schema()));
+        }
+    }
+}
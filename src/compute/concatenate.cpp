@@ -0,0 +1,902 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/compute/concatenate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "sparrow/arrow_interface/arrow_array_schema_info_utils.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/compute/compute_utils.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+#include "kernel_utils.hpp"
+
+namespace sparrow::compute
+{
+    namespace
+    {
+        using detail::checked_size;
+        using detail::first_data_buffer_index;
+        using detail::fixed_sized_list_size;
+        using detail::fixed_width_size;
+        using detail::is_set;
+        using detail::make_result;
+        using detail::read_int32;
+        using detail::short_view_size;
+        using detail::union_type_ids;
+        using detail::validity_of;
+        using detail::view_buffer_index_offset;
+        using detail::view_buffer_offset_offset;
+        using detail::view_size;
+        using detail::write_int32;
+
+        // Elements [offset, offset + length) of an array, in positions of its
+        // buffers: the offset of the array is included.
+        struct segment
+        {
+            const arrow_proxy* proxy;
+            std::size_t offset;
+            std::size_t length;
+        };
+
+        using segment_span = std::span<const segment>;
+
+        ArrowArray concatenate_array(segment_span segments);
+
+        segment whole(const arrow_proxy& proxy)
+        {
+            return {&proxy, proxy.offset(), proxy.length()};
+        }
+
+        std::size_t total_length(segment_span segments)
+        {
+            std::size_t res = 0;
+            for (const segment& s : segments)
+            {
+                res += s.length;
+            }
+            return res;
+        }
+
+        // Sets the bits [bit, bit + count) of a zeroed bitmap
+        void set_bits(std::uint8_t* bitmap, std::size_t bit, std::size_t count)
+        {
+            std::size_t k = 0;
+            for (; k < count && (bit + k) % 8 != 0; ++k)
+            {
+                bitmap[(bit + k) / 8] |= static_cast<std::uint8_t>(1u << ((bit + k) % 8));
+            }
+            const std::size_t full_bytes = (count - k) / 8;
+            std::memset(bitmap + (bit + k) / 8, 0xff, full_bytes);
+            k += full_bytes * 8;
+            for (; k < count; ++k)
+            {
+                bitmap[(bit + k) / 8] |= static_cast<std::uint8_t>(1u << ((bit + k) % 8));
+            }
+        }
+
+        // The bitmaps of the inputs are appended one after the other, each
+        // one shifted to the position of its first element in the result
+        validity_bitmap concatenate_validity(segment_span segments, std::size_t length)
+        {
+            if (std::ranges::all_of(
+                    segments,
+                    [](const segment& s)
+                    {
+                        return validity_of(*s.proxy) == nullptr;
+                    }
+                ))
+            {
+                return sparrow::detail::make_all_valid_bitmap(length);
+            }
+
+            buffer<std::uint8_t> bytes(validity_bitmap::compute_block_count(length), std::uint8_t(0));
+            std::size_t position = 0;
+            for (const segment& s : segments)
+            {
+                const std::uint8_t* validity = validity_of(*s.proxy);
+                if (validity == nullptr)
+                {
+                    set_bits(bytes.data(), position, s.length);
+                }
+                else
+                {
+                    detail::copy_bits(validity, s.offset, bytes.data(), position, s.length);
+                }
+                position += s.length;
+            }
+            return validity_bitmap(std::move(bytes), length);
+        }
+
+        bool is_valid(const segment& s, std::size_t i)
+        {
+            const std::uint8_t* validity = validity_of(*s.proxy);
+            return validity == nullptr || is_set(validity, s.offset + i);
+        }
+
+        /****************
+         * fixed widths *
+         ****************/
+
+        buffer<std::uint8_t> concatenate_values(segment_span segments, std::size_t length, std::size_t width)
+        {
+            buffer<std::uint8_t> values(length * width);
+            std::size_t position = 0;
+            for (const segment& s : segments)
+            {
+                std::memcpy(
+                    values.data() + position * width,
+                    s.proxy->buffers()[1].data() + s.offset * width,
+                    s.length * width
+                );
+                position += s.length;
+            }
+            return values;
+        }
+
+        ArrowArray concatenate_fixed_width_array(segment_span segments, std::size_t width)
+        {
+            const std::size_t length = total_length(segments);
+            validity_bitmap validity = concatenate_validity(segments, length);
+            const std::size_t null_count = validity.null_count();
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(2);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(concatenate_values(segments, length, width));
+            return make_result(length, null_count, std::move(buffers));
+        }
+
+        /**************************
+         * variable-size binaries *
+         **************************/
+
+        // Offsets of the inputs are rebased on the position of their data in
+        // the data of the result
+        template <class O>
+        ArrowArray concatenate_binary_array(segment_span segments)
+        {
+            const std::size_t length = total_length(segments);
+            validity_bitmap validity = concatenate_validity(segments, length);
+            const std::size_t null_count = validity.null_count();
+
+            std::size_t data_size = 0;
+            for (const segment& s : segments)
+            {
+                const O* offsets = s.proxy->buffers()[1].data<const O>() + s.offset;
+                data_size += static_cast<std::size_t>(offsets[s.length] - offsets[0]);
+            }
+            checked_size<O>(data_size, "concatenate");
+
+            u8_buffer<O> new_offsets(length + 1, O(0));
+            buffer<std::uint8_t> new_data(data_size);
+            std::size_t position = 0;
+            O base = 0;
+            for (const segment& s : segments)
+            {
+                const O* offsets = s.proxy->buffers()[1].data<const O>() + s.offset;
+                const O shift = static_cast<O>(base - offsets[0]);
+                O* out = new_offsets.data() + position + 1;
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    out[i] = static_cast<O>(offsets[i + 1] + shift);
+                }
+                const auto size = static_cast<std::size_t>(offsets[s.length] - offsets[0]);
+                std::memcpy(
+                    new_data.data() + base,
+                    s.proxy->buffers()[2].data() + offsets[0],
+                    size
+                );
+                base = static_cast<O>(base + static_cast<O>(size));
+                position += s.length;
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(3);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            buffers.push_back(std::move(new_data));
+            return make_result(length, null_count, std::move(buffers));
+        }
+
+        // The views are copied as a whole, then the long values are copied
+        // into the single data buffer of the result and their views are
+        // redirected to it
+        ArrowArray concatenate_binary_view_array(segment_span segments)
+        {
+            const std::size_t length = total_length(segments);
+            validity_bitmap validity = concatenate_validity(segments, length);
+            const std::size_t null_count = validity.null_count();
+
+            buffer<std::uint8_t> new_views(length * view_size);
+            std::size_t long_size = 0;
+            std::size_t position = 0;
+            for (const segment& s : segments)
+            {
+                std::uint8_t* views = new_views.data() + position * view_size;
+                std::memcpy(views, s.proxy->buffers()[1].data() + s.offset * view_size, s.length * view_size);
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    std::uint8_t* view = views + i * view_size;
+                    if (!is_valid(s, i))
+                    {
+                        // The views of null elements are not read
+                        std::memset(view, 0, view_size);
+                        continue;
+                    }
+                    const auto size = static_cast<std::size_t>(read_int32(view));
+                    long_size += size > short_view_size ? size : 0;
+                }
+                position += s.length;
+            }
+            checked_size<std::int32_t>(long_size, "concatenate");
+
+            buffer<std::uint8_t> long_data(long_size);
+            std::size_t long_offset = 0;
+            position = 0;
+            for (const segment& s : segments)
+            {
+                const auto& source_buffers = s.proxy->buffers();
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    std::uint8_t* view = new_views.data() + (position + i) * view_size;
+                    const auto size = static_cast<std::size_t>(read_int32(view));
+                    if (size > short_view_size)
+                    {
+                        const auto index = static_cast<std::size_t>(read_int32(view + view_buffer_index_offset));
+                        const auto offset = static_cast<std::size_t>(read_int32(view + view_buffer_offset_offset));
+                        std::memcpy(long_data.data() + long_offset, source_buffers[index].data() + offset, size);
+                        write_int32(view + view_buffer_index_offset, first_data_buffer_index);
+                        write_int32(view + view_buffer_offset_offset, static_cast<std::int32_t>(long_offset));
+                        long_offset += size;
+                    }
+                }
+                position += s.length;
+            }
+
+            u8_buffer<std::int64_t> buffer_sizes(std::size_t(1), static_cast<std::int64_t>(long_size));
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(4);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(new_views));
+            buffers.push_back(std::move(long_data));
+            buffers.push_back(std::move(buffer_sizes).extract_storage());
+            return make_result(length, null_count, std::move(buffers));
+        }
+
+        /*********
+         * lists *
+         *********/
+
+        template <class O>
+        ArrowArray concatenate_list_array(segment_span segments)
+        {
+            const std::size_t length = total_length(segments);
+            validity_bitmap validity = concatenate_validity(segments, length);
+            const std::size_t null_count = validity.null_count();
+
+            u8_buffer<O> new_offsets(length + 1, O(0));
+            std::vector<segment> child_segments;
+            child_segments.reserve(segments.size());
+            std::size_t position = 0;
+            std::size_t base = 0;
+            for (const segment& s : segments)
+            {
+                const O* offsets = s.proxy->buffers()[1].data<const O>() + s.offset;
+                const auto size = static_cast<std::size_t>(offsets[s.length] - offsets[0]);
+                const O shift = static_cast<O>(
+                    checked_size<O>(base + size, "concatenate") - static_cast<O>(size) - offsets[0]
+                );
+                O* out = new_offsets.data() + position + 1;
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    out[i] = static_cast<O>(offsets[i + 1] + shift);
+                }
+                const arrow_proxy& child = s.proxy->children()[0];
+                child_segments.push_back({&child, child.offset() + static_cast<std::size_t>(offsets[0]), size});
+                base += size;
+                position += s.length;
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(2);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            std::vector<ArrowArray> children;
+            children.push_back(concatenate_array(child_segments));
+            return make_result(length, null_count, std::move(buffers), std::move(children));
+        }
+
+        // Only the range of the child referenced by the valid non-empty
+        // elements of each input is copied
+        template <class O>
+        ArrowArray concatenate_list_view_array(segment_span segments)
+        {
+            const std::size_t length = total_length(segments);
+            validity_bitmap validity = concatenate_validity(segments, length);
+            const std::size_t null_count = validity.null_count();
+
+            u8_buffer<O> new_offsets(length, O(0));
+            u8_buffer<O> new_sizes(length, O(0));
+            std::vector<segment> child_segments;
+            child_segments.reserve(segments.size());
+            std::size_t position = 0;
+            std::size_t base = 0;
+            for (const segment& s : segments)
+            {
+                const O* offsets = s.proxy->buffers()[1].data<const O>() + s.offset;
+                const O* sizes = s.proxy->buffers()[2].data<const O>() + s.offset;
+                std::size_t first = std::numeric_limits<std::size_t>::max();
+                std::size_t last = 0;
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    if (sizes[i] > 0 && is_valid(s, i))
+                    {
+                        first = std::min(first, static_cast<std::size_t>(offsets[i]));
+                        last = std::max(last, static_cast<std::size_t>(offsets[i] + sizes[i]));
+                    }
+                }
+                first = std::min(first, last);
+                checked_size<O>(base + last - first, "concatenate");
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    const bool used = sizes[i] > 0 && is_valid(s, i);
+                    new_offsets[position + i] = static_cast<O>(
+                        used ? static_cast<std::size_t>(offsets[i]) - first + base : base
+                    );
+                    new_sizes[position + i] = used ? sizes[i] : O(0);
+                }
+                const arrow_proxy& child = s.proxy->children()[0];
+                child_segments.push_back({&child, child.offset() + first, last - first});
+                base += last - first;
+                position += s.length;
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(3);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            buffers.push_back(std::move(new_sizes).extract_storage());
+            std::vector<ArrowArray> children;
+            children.push_back(concatenate_array(child_segments));
+            return make_result(length, null_count, std::move(buffers), std::move(children));
+        }
+
+        ArrowArray concatenate_fixed_sized_list_array(segment_span segments)
+        {
+            const std::size_t list_size = fixed_sized_list_size(segments.front().proxy->format());
+            const std::size_t length = total_length(segments);
+            validity_bitmap validity = concatenate_validity(segments, length);
+            const std::size_t null_count = validity.null_count();
+
+            std::vector<segment> child_segments;
+            child_segments.reserve(segments.size());
+            for (const segment& s : segments)
+            {
+                const arrow_proxy& child = s.proxy->children()[0];
+                child_segments.push_back({&child, child.offset() + s.offset * list_size, s.length * list_size});
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(std::move(validity).extract_storage());
+            std::vector<ArrowArray> children;
+            children.push_back(concatenate_array(child_segments));
+            return make_result(length, null_count, std::move(buffers), std::move(children));
+        }
+
+        /**********************
+         * structs and unions *
+         **********************/
+
+        // The children of structs and sparse unions have the elements of
+        // their parent at the same positions
+        std::vector<ArrowArray> concatenate_aligned_children(segment_span segments)
+        {
+            const std::size_t n_children = segments.front().proxy->children().size();
+            std::vector<ArrowArray> children;
+            children.reserve(n_children);
+            std::vector<segment> child_segments(segments.size());
+            for (std::size_t k = 0; k < n_children; ++k)
+            {
+                for (std::size_t j = 0; j < segments.size(); ++j)
+                {
+                    const segment& s = segments[j];
+                    const arrow_proxy& child = s.proxy->children()[k];
+                    child_segments[j] = {&child, child.offset() + s.offset, s.length};
+                }
+                children.push_back(concatenate_array(child_segments));
+            }
+            return children;
+        }
+
+        ArrowArray concatenate_struct_array(segment_span segments)
+        {
+            const std::size_t length = total_length(segments);
+            validity_bitmap validity = concatenate_validity(segments, length);
+            const std::size_t null_count = validity.null_count();
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(std::move(validity).extract_storage());
+            return make_result(length, null_count, std::move(buffers), concatenate_aligned_children(segments));
+        }
+
+        buffer<std::uint8_t> concatenate_type_ids(segment_span segments, std::size_t length)
+        {
+            buffer<std::uint8_t> type_ids(length);
+            std::size_t position = 0;
+            for (const segment& s : segments)
+            {
+                std::memcpy(type_ids.data() + position, s.proxy->buffers()[0].data() + s.offset, s.length);
+                position += s.length;
+            }
+            return type_ids;
+        }
+
+        ArrowArray concatenate_sparse_union_array(segment_span segments)
+        {
+            const std::size_t length = total_length(segments);
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(concatenate_type_ids(segments, length));
+            return make_result(length, 0, std::move(buffers), concatenate_aligned_children(segments));
+        }
+
+        // The offsets of each child are rebased on the position of the range
+        // of the child used by each input
+        ArrowArray concatenate_dense_union_array(segment_span segments)
+        {
+            const auto type_ids = union_type_ids(segments.front().proxy->format());
+            std::array<std::size_t, 256> child_index{};
+            for (std::size_t k = 0; k < type_ids.size(); ++k)
+            {
+                child_index[type_ids[k]] = k;
+            }
+            const std::size_t n_children = type_ids.size();
+            const std::size_t length = total_length(segments);
+
+            buffer<std::uint8_t> new_type_ids = concatenate_type_ids(segments, length);
+            u8_buffer<std::int32_t> new_offsets(length, 0);
+            std::vector<std::vector<segment>> child_segments(n_children);
+            std::vector<std::size_t> bases(n_children, 0);
+            std::vector<std::size_t> first(n_children);
+            std::vector<std::size_t> last(n_children);
+            std::size_t position = 0;
+            for (const segment& s : segments)
+            {
+                const std::uint8_t* source_type_ids = s.proxy->buffers()[0].data() + s.offset;
+                const std::int32_t* offsets = s.proxy->buffers()[1].data<const std::int32_t>() + s.offset;
+                std::ranges::fill(first, std::numeric_limits<std::size_t>::max());
+                std::ranges::fill(last, std::size_t(0));
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    const std::size_t k = child_index[source_type_ids[i]];
+                    first[k] = std::min(first[k], static_cast<std::size_t>(offsets[i]));
+                    last[k] = std::max(last[k], static_cast<std::size_t>(offsets[i]) + 1);
+                }
+                for (std::size_t k = 0; k < n_children; ++k)
+                {
+                    first[k] = std::min(first[k], last[k]);
+                    checked_size<std::int32_t>(bases[k] + last[k] - first[k], "concatenate");
+                }
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    const std::size_t k = child_index[source_type_ids[i]];
+                    new_offsets[position + i] = static_cast<std::int32_t>(
+                        static_cast<std::size_t>(offsets[i]) - first[k] + bases[k]
+                    );
+                }
+                for (std::size_t k = 0; k < n_children; ++k)
+                {
+                    const arrow_proxy& child = s.proxy->children()[k];
+                    child_segments[k].push_back({&child, child.offset() + first[k], last[k] - first[k]});
+                    bases[k] += last[k] - first[k];
+                }
+                position += s.length;
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(2);
+            buffers.push_back(std::move(new_type_ids));
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            std::vector<ArrowArray> children;
+            children.reserve(n_children);
+            for (const auto& segs : child_segments)
+            {
+                children.push_back(concatenate_array(segs));
+            }
+            return make_result(length, 0, std::move(buffers), std::move(children));
+        }
+
+        /*******************
+         * run-end encoded *
+         *******************/
+
+        // The runs covering each input are clipped to its range and their
+        // ends are rebased on the position of the input in the result
+        template <class R>
+        ArrowArray concatenate_run_end_encoded_array(segment_span segments)
+        {
+            const std::size_t length = total_length(segments);
+            checked_size<R>(length, "concatenate");
+
+            std::vector<R> new_run_ends;
+            std::vector<segment> value_segments;
+            value_segments.reserve(segments.size());
+            std::size_t null_count = 0;
+            std::size_t base = 0;
+            for (const segment& s : segments)
+            {
+                const arrow_proxy& run_ends_proxy = s.proxy->children()[0];
+                const arrow_proxy& values_proxy = s.proxy->children()[1];
+                if (s.length == 0)
+                {
+                    value_segments.push_back({&values_proxy, values_proxy.offset(), 0});
+                    continue;
+                }
+                const R* run_ends = run_ends_proxy.buffers()[1].data<const R>() + run_ends_proxy.offset();
+                const R* run_ends_end = run_ends + run_ends_proxy.length();
+                const auto find_run = [&](std::size_t p)
+                {
+                    const auto it = std::upper_bound(
+                        run_ends,
+                        run_ends_end,
+                        p,
+                        [](std::size_t lhs, R rhs)
+                        {
+                            return std::cmp_less(lhs, rhs);
+                        }
+                    );
+                    return static_cast<std::size_t>(it - run_ends);
+                };
+                const std::size_t first_run = find_run(s.offset);
+                const std::size_t last_run = find_run(s.offset + s.length - 1);
+                const std::uint8_t* values_validity = validity_of(values_proxy);
+                std::size_t run_start = s.offset;
+                for (std::size_t r = first_run; r <= last_run; ++r)
+                {
+                    const std::size_t run_end = std::min(static_cast<std::size_t>(run_ends[r]), s.offset + s.length);
+                    new_run_ends.push_back(static_cast<R>(run_end - s.offset + base));
+                    if (values_validity != nullptr && !is_set(values_validity, values_proxy.offset() + r))
+                    {
+                        null_count += run_end - run_start;
+                    }
+                    run_start = run_end;
+                }
+                value_segments.push_back({&values_proxy, values_proxy.offset() + first_run, last_run - first_run + 1});
+                base += s.length;
+            }
+
+            // The run ends child has no null value
+            const std::size_t run_count = new_run_ends.size();
+            std::vector<buffer<std::uint8_t>> run_ends_buffers;
+            run_ends_buffers.reserve(2);
+            run_ends_buffers.push_back(sparrow::detail::make_all_valid_bitmap(run_count).extract_storage());
+            run_ends_buffers.push_back(u8_buffer<R>(new_run_ends).extract_storage());
+
+            std::vector<ArrowArray> children;
+            children.reserve(2);
+            children.push_back(make_result(run_count, 0, std::move(run_ends_buffers)));
+            children.push_back(concatenate_array(value_segments));
+            return make_result(length, null_count, {}, std::move(children));
+        }
+
+        ArrowArray concatenate_run_end_encoded_array(segment_span segments)
+        {
+            switch (segments.front().proxy->children()[0].data_type())
+            {
+                case data_type::INT16:
+                    return concatenate_run_end_encoded_array<std::int16_t>(segments);
+                case data_type::UINT16:
+                    return concatenate_run_end_encoded_array<std::uint16_t>(segments);
+                case data_type::INT32:
+                    return concatenate_run_end_encoded_array<std::int32_t>(segments);
+                case data_type::UINT32:
+                    return concatenate_run_end_encoded_array<std::uint32_t>(segments);
+                case data_type::INT64:
+                    return concatenate_run_end_encoded_array<std::int64_t>(segments);
+                case data_type::UINT64:
+                    return concatenate_run_end_encoded_array<std::uint64_t>(segments);
+                default:
+                    throw std::invalid_argument("concatenate: unsupported type of run ends");
+            }
+        }
+
+        /**********************
+         * dictionary-encoded *
+         **********************/
+
+        bool same_dictionary(const arrow_proxy& lhs, const arrow_proxy& rhs)
+        {
+            const ArrowArray& l = lhs.array();
+            const ArrowArray& r = rhs.array();
+            return l.length == r.length && l.offset == r.offset && l.n_buffers == r.n_buffers
+                   && std::equal(l.buffers, l.buffers + l.n_buffers, r.buffers);
+        }
+
+        // Bytes of the value of a dictionary element, used to detect the
+        // duplicate values; the dictionaries of other layouts are not
+        // deduplicated.
+        struct dictionary_values
+        {
+            explicit dictionary_values(const arrow_proxy& dict)
+                : proxy(dict)
+                , width(fixed_width_size(dict))
+            {
+                switch (dict.data_type())
+                {
+                    case data_type::STRING:
+                    case data_type::BINARY:
+                    case data_type::LARGE_STRING:
+                    case data_type::LARGE_BINARY:
+                        binary = true;
+                        large = dict.data_type() == data_type::LARGE_STRING
+                                || dict.data_type() == data_type::LARGE_BINARY;
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            [[nodiscard]] bool comparable() const
+            {
+                return width != 0 || binary;
+            }
+
+            [[nodiscard]] std::string_view value(std::size_t i) const
+            {
+                const auto& buffers = proxy.buffers();
+                const char* data = reinterpret_cast<const char*>(buffers[binary ? 2 : 1].data());
+                if (!binary)
+                {
+                    return {data + i * width, width};
+                }
+                if (large)
+                {
+                    const auto* offsets = buffers[1].data<const std::int64_t>();
+                    return {data + offsets[i], static_cast<std::size_t>(offsets[i + 1] - offsets[i])};
+                }
+                const auto* offsets = buffers[1].data<const std::int32_t>();
+                return {data + offsets[i], static_cast<std::size_t>(offsets[i + 1] - offsets[i])};
+            }
+
+            const arrow_proxy& proxy;
+            std::size_t width;
+            bool binary = false;
+            bool large = false;
+        };
+
+        // The dictionaries are concatenated, then the first occurrence of
+        // each value is kept. remap[j] is the index in the unified
+        // dictionary of the element j of the concatenated dictionaries.
+        arrow_proxy unify_dictionaries(segment_span segments, std::vector<std::int64_t>& remap)
+        {
+            std::vector<segment> dictionary_segments;
+            dictionary_segments.reserve(segments.size());
+            for (const segment& s : segments)
+            {
+                dictionary_segments.push_back(whole(*s.proxy->dictionary()));
+            }
+            const arrow_proxy& first_dictionary = *segments.front().proxy->dictionary();
+            arrow_proxy all(concatenate_array(dictionary_segments), copy_schema(first_dictionary.schema()));
+
+            const std::size_t size = all.length();
+            remap.resize(size);
+            const dictionary_values values(all);
+            if (!values.comparable())
+            {
+                std::iota(remap.begin(), remap.end(), std::int64_t(0));
+                return all;
+            }
+
+            selection_vector uniques;
+            std::unordered_map<std::string_view, std::int64_t> indices;
+            indices.reserve(size);
+            std::int64_t null_index = -1;
+            const std::uint8_t* validity = validity_of(all);
+            for (std::size_t j = 0; j < size; ++j)
+            {
+                const auto next = static_cast<std::int64_t>(uniques.size());
+                std::int64_t index = next;
+                if (validity != nullptr && !is_set(validity, j))
+                {
+                    index = null_index < 0 ? (null_index = next) : null_index;
+                }
+                else
+                {
+                    index = indices.try_emplace(values.value(j), next).first->second;
+                }
+                if (index == next)
+                {
+                    uniques.push_back(static_cast<std::int64_t>(j));
+                }
+                remap[j] = index;
+            }
+            return detail::take(all, uniques);
+        }
+
+        template <class K>
+        ArrowArray concatenate_dictionary_encoded_array(segment_span segments)
+        {
+            const arrow_proxy& first_dictionary = *segments.front().proxy->dictionary();
+            const bool shared = std::ranges::all_of(
+                segments,
+                [&first_dictionary](const segment& s)
+                {
+                    return same_dictionary(*s.proxy->dictionary(), first_dictionary);
+                }
+            );
+            if (shared)
+            {
+                // Only the keys are concatenated, the dictionary is shared
+                ArrowArray res = concatenate_fixed_width_array(segments, sizeof(K));
+                res.dictionary = new ArrowArray(copy_array(first_dictionary.array(), first_dictionary.schema()));
+                return res;
+            }
+
+            std::vector<std::int64_t> remap;
+            arrow_proxy dictionary = unify_dictionaries(segments, remap);
+            if (dictionary.length() != 0 && std::cmp_greater(dictionary.length() - 1, std::numeric_limits<K>::max()))
+            {
+                throw std::overflow_error("concatenate: the unified dictionary is too large for the keys");
+            }
+
+            const std::size_t length = total_length(segments);
+            validity_bitmap validity = concatenate_validity(segments, length);
+            const std::size_t null_count = validity.null_count();
+            u8_buffer<K> keys(length, K(0));
+            std::size_t position = 0;
+            std::int64_t dictionary_start = 0;
+            for (const segment& s : segments)
+            {
+                const K* source_keys = s.proxy->buffers()[1].data<const K>() + s.offset;
+                for (std::size_t i = 0; i < s.length; ++i)
+                {
+                    if (is_valid(s, i))
+                    {
+                        const auto j = static_cast<std::size_t>(dictionary_start + static_cast<std::int64_t>(source_keys[i]));
+                        keys[position + i] = static_cast<K>(remap[j]);
+                    }
+                }
+                dictionary_start += static_cast<std::int64_t>(s.proxy->dictionary()->length());
+                position += s.length;
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(2);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(keys).extract_storage());
+            auto* dictionary_array = new ArrowArray(dictionary.extract_array());
+            return make_result(length, null_count, std::move(buffers), {}, dictionary_array);
+        }
+
+        ArrowArray concatenate_dictionary_encoded_array(segment_span segments)
+        {
+            switch (segments.front().proxy->data_type())
+            {
+                case data_type::INT8:
+                    return concatenate_dictionary_encoded_array<std::int8_t>(segments);
+                case data_type::UINT8:
+                    return concatenate_dictionary_encoded_array<std::uint8_t>(segments);
+                case data_type::INT16:
+                    return concatenate_dictionary_encoded_array<std::int16_t>(segments);
+                case data_type::UINT16:
+                    return concatenate_dictionary_encoded_array<std::uint16_t>(segments);
+                case data_type::INT32:
+                    return concatenate_dictionary_encoded_array<std::int32_t>(segments);
+                case data_type::UINT32:
+                    return concatenate_dictionary_encoded_array<std::uint32_t>(segments);
+                case data_type::INT64:
+                    return concatenate_dictionary_encoded_array<std::int64_t>(segments);
+                case data_type::UINT64:
+                    return concatenate_dictionary_encoded_array<std::uint64_t>(segments);
+                default:
+                    throw std::invalid_argument("concatenate: unsupported type of dictionary keys");
+            }
+        }
+
+        ArrowArray concatenate_array(segment_span segments)
+        {
+            const arrow_proxy& first = *segments.front().proxy;
+            if (first.dictionary() != nullptr)
+            {
+                return concatenate_dictionary_encoded_array(segments);
+            }
+
+            switch (first.data_type())
+            {
+                case data_type::NA:
+                {
+                    const std::size_t length = total_length(segments);
+                    return make_result(length, length, {});
+                }
+                case data_type::STRING:
+                case data_type::BINARY:
+                    return concatenate_binary_array<std::int32_t>(segments);
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                    return concatenate_binary_array<std::int64_t>(segments);
+                case data_type::STRING_VIEW:
+                case data_type::BINARY_VIEW:
+                    return concatenate_binary_view_array(segments);
+                case data_type::LIST:
+                case data_type::MAP:
+                    return concatenate_list_array<std::int32_t>(segments);
+                case data_type::LARGE_LIST:
+                    return concatenate_list_array<std::int64_t>(segments);
+                case data_type::LIST_VIEW:
+                    return concatenate_list_view_array<std::int32_t>(segments);
+                case data_type::LARGE_LIST_VIEW:
+                    return concatenate_list_view_array<std::int64_t>(segments);
+                case data_type::FIXED_SIZED_LIST:
+                    return concatenate_fixed_sized_list_array(segments);
+                case data_type::STRUCT:
+                    return concatenate_struct_array(segments);
+                case data_type::SPARSE_UNION:
+                    return concatenate_sparse_union_array(segments);
+                case data_type::DENSE_UNION:
+                    return concatenate_dense_union_array(segments);
+                case data_type::RUN_ENCODED:
+                    return concatenate_run_end_encoded_array(segments);
+                default:
+                    break;
+            }
+
+            const std::size_t width = fixed_width_size(first);
+            SPARROW_ASSERT_TRUE(width != 0);
+            return concatenate_fixed_width_array(segments, width);
+        }
+    }
+
+    namespace detail
+    {
+        arrow_proxy concatenate(std::span<const arrow_proxy* const> sources)
+        {
+            if (sources.empty())
+            {
+                throw std::invalid_argument("concatenate: no array to concatenate");
+            }
+            const arrow_proxy& first = *sources.front();
+            std::vector<segment> segments;
+            segments.reserve(sources.size());
+            for (const arrow_proxy* source : sources)
+            {
+                if (!same_data_type(source->schema(), first.schema()))
+                {
+                    throw std::invalid_argument("concatenate: the arrays must have the same data type");
+                }
+                segments.push_back(whole(*source));
+            }
+            ArrowArray result = concatenate_array(segments);
+            return arrow_proxy(std::move(result), copy_schema(first.schema()));
+        }
+    }
+
+    array concatenate(std::span<const array> arrays)
+    {
+        std::vector<const arrow_proxy*> sources;
+        sources.reserve(arrays.size());
+        for (const array& ar : arrays)
+        {
+            sources.push_back(&sparrow::detail::array_access::get_arrow_proxy(ar));
+        }
+        return detail::make_from_proxy<array>(detail::concatenate(sources));
+    }
+}
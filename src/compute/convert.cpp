@@ -0,0 +1,252 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "sparrow/compute/convert.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/variable_size_binary_view_builder.hpp"
+
+#include "kernel_utils.hpp"
+
+namespace sparrow::compute
+{
+    namespace
+    {
+        using detail::copy_validity;
+        using detail::first_data_buffer_index;
+        using detail::is_set;
+        using detail::make_result;
+        using detail::read_int32;
+        using detail::short_view_size;
+        using detail::validity_of;
+        using detail::view_buffer_index_offset;
+        using detail::view_buffer_offset_offset;
+        using detail::view_size;
+        using detail::write_int32;
+
+        constexpr std::size_t view_data_offset = 4;
+
+        // Schema of the source array with another format, keeping its
+        // name, metadata and flags
+        ArrowSchema copy_schema_with_format(const ArrowSchema& source, data_type type)
+        {
+            ArrowSchema res = copy_schema(source);
+            auto* private_data = static_cast<arrow_schema_private_data*>(res.private_data);
+            private_data->format() = std::string(data_type_to_format(type));
+            res.format = private_data->format_ptr();
+            return res;
+        }
+
+        /*********************
+         * offsets to views *
+         *********************/
+
+        // Views referencing the long values in the data buffer of the
+        // source, which is the first data buffer of the result
+        template <class O>
+        buffer<std::uint8_t> make_views(const O* offsets, const std::uint8_t* data, std::size_t length, bool& has_long_values)
+        {
+            buffer<std::uint8_t> views(length * view_size, std::uint8_t(0));
+            has_long_values = false;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const auto begin = static_cast<std::size_t>(offsets[i]);
+                const auto size = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+                std::uint8_t* view = views.data() + i * view_size;
+                write_int32(view, static_cast<std::int32_t>(size));
+                std::memcpy(view + view_data_offset, data + begin, std::min(size, short_view_size));
+                if (size > short_view_size)
+                {
+                    write_int32(view + view_buffer_index_offset, first_data_buffer_index);
+                    write_int32(view + view_buffer_offset_offset, static_cast<std::int32_t>(begin));
+                    has_long_values = true;
+                }
+            }
+            return views;
+        }
+
+        template <class O>
+        ArrowArray offsets_to_views(const arrow_proxy& source)
+        {
+            const std::size_t length = source.length();
+            const O* offsets = reinterpret_cast<const O*>(source.buffers()[1].data()) + source.offset();
+            const std::uint8_t* data = source.buffers()[2].data();
+
+            std::size_t null_count = 0;
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(copy_validity(source, null_count));
+
+            // The offsets in the views are 32-bit integers, the values of
+            // a larger data buffer are copied in new data buffers
+            const auto end = static_cast<std::size_t>(offsets[length]);
+            if (end > variable_size_binary_view_builder::max_data_buffer_size_limit)
+            {
+                variable_size_binary_view_builder builder;
+                builder.reserve(length);
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    const auto begin = static_cast<std::size_t>(offsets[i]);
+                    const auto size = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+                    builder.push_back(std::as_bytes(std::span(data + begin, size)));
+                }
+                std::ranges::move(builder.finish(), std::back_inserter(buffers));
+                return make_result(length, null_count, std::move(buffers));
+            }
+
+            // All the values are empty
+            if (end == 0)
+            {
+                buffers.emplace_back(length * view_size, std::uint8_t(0));
+                buffers.emplace_back();
+                return make_result(length, null_count, std::move(buffers));
+            }
+
+            bool has_long_values = false;
+            buffers.push_back(make_views(offsets, data, length, has_long_values));
+            if (has_long_values)
+            {
+                // A copy of the array shares its buffers, its data buffer is
+                // moved to the result
+                arrow_proxy shared = source;
+                buffer<std::uint8_t> shared_data = std::move(shared.get_array_private_data()->buffers()[2]);
+                const auto data_size = static_cast<std::int64_t>(shared_data.size());
+                buffers.push_back(std::move(shared_data));
+                buffers.push_back(u8_buffer<std::int64_t>(std::size_t(1), data_size).extract_storage());
+            }
+            else
+            {
+                buffers.emplace_back();
+            }
+            return make_result(length, null_count, std::move(buffers));
+        }
+
+        /*********************
+         * views to offsets *
+         *********************/
+
+        template <class O>
+        ArrowArray views_to_offsets(const arrow_proxy& source)
+        {
+            const std::size_t length = source.length();
+            const std::size_t offset = source.offset();
+            const std::uint8_t* validity = validity_of(source);
+            const auto& source_buffers = source.buffers();
+            const std::uint8_t* views = source_buffers[1].data() + offset * view_size;
+
+            // Prefix sum of the lengths of the valid elements
+            u8_buffer<O> new_offsets(length + 1, O(0));
+            std::size_t total_size = 0;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                if (validity == nullptr || is_set(validity, offset + i))
+                {
+                    total_size += static_cast<std::size_t>(read_int32(views + i * view_size));
+                }
+                new_offsets[i + 1] = static_cast<O>(total_size);
+            }
+            if (total_size > static_cast<std::size_t>(std::numeric_limits<O>::max()))
+            {
+                throw std::length_error(
+                    sizeof(O) == sizeof(std::int32_t) ? "to_offset_array: values too long for 32-bit offsets"
+                                                      : "to_offset_array: values too long for 64-bit offsets"
+                );
+            }
+
+            buffer<std::uint8_t> data(total_size);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const auto begin = static_cast<std::size_t>(new_offsets[i]);
+                const auto size = static_cast<std::size_t>(new_offsets[i + 1]) - begin;
+                if (size == 0)
+                {
+                    continue;
+                }
+                const std::uint8_t* view = views + i * view_size;
+                const std::uint8_t* value = view + view_data_offset;
+                if (size > short_view_size)
+                {
+                    const auto index = static_cast<std::size_t>(read_int32(view + view_buffer_index_offset));
+                    const auto value_offset = static_cast<std::size_t>(read_int32(view + view_buffer_offset_offset));
+                    value = source_buffers[index].data() + value_offset;
+                }
+                std::memcpy(data.data() + begin, value, size);
+            }
+
+            std::size_t null_count = 0;
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(3);
+            buffers.push_back(copy_validity(source, null_count));
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            buffers.push_back(std::move(data));
+            return make_result(length, null_count, std::move(buffers));
+        }
+    }
+
+    namespace detail
+    {
+        arrow_proxy to_view_array(const arrow_proxy& source)
+        {
+            ArrowArray result;
+            data_type result_type = data_type::STRING_VIEW;
+            switch (source.data_type())
+            {
+                case data_type::STRING:
+                    result = offsets_to_views<std::int32_t>(source);
+                    break;
+                case data_type::LARGE_STRING:
+                    result = offsets_to_views<std::int64_t>(source);
+                    break;
+                case data_type::BINARY:
+                    result = offsets_to_views<std::int32_t>(source);
+                    result_type = data_type::BINARY_VIEW;
+                    break;
+                case data_type::LARGE_BINARY:
+                    result = offsets_to_views<std::int64_t>(source);
+                    result_type = data_type::BINARY_VIEW;
+                    break;
+                default:
+                    throw std::invalid_argument("to_view_array: only string and binary arrays can be converted");
+            }
+            return arrow_proxy(std::move(result), copy_schema_with_format(source.schema(), result_type));
+        }
+
+        arrow_proxy to_offset_array(const arrow_proxy& source, data_type type)
+        {
+            const data_type source_type = source.data_type();
+            const bool is_string = type == data_type::STRING || type == data_type::LARGE_STRING;
+            const bool is_binary = type == data_type::BINARY || type == data_type::LARGE_BINARY;
+            if ((source_type != data_type::STRING_VIEW || !is_string)
+                && (source_type != data_type::BINARY_VIEW || !is_binary))
+            {
+                throw std::invalid_argument("to_offset_array: only string view and binary view arrays can be converted");
+            }
+            ArrowArray result = type == data_type::STRING || type == data_type::BINARY
+                                    ? views_to_offsets<std::int32_t>(source)
+                                    : views_to_offsets<std::int64_t>(source);
+            return arrow_proxy(std::move(result), copy_schema_with_format(source.schema(), type));
+        }
+    }
+}
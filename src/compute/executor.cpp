@@ -0,0 +1,177 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/compute/executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow::compute
+{
+    namespace
+    {
+        // State shared by the tasks of a parallel_for. The tasks claim the
+        // indices one at a time, so that the fastest threads take more of
+        // them. The state is owned by the tasks as well as by the caller,
+        // since a task may start after all the indices have been processed.
+        struct parallel_for_state
+        {
+            parallel_for_state(std::size_t size, const std::function<void(std::size_t)>& func)
+                : n(size)
+                , f(&func)
+            {
+            }
+
+            void work()
+            {
+                while (true)
+                {
+                    const std::size_t i = next.fetch_add(1);
+                    if (i >= n)
+                    {
+                        return;
+                    }
+                    if (!failed.load())
+                    {
+                        try
+                        {
+                            (*f)(i);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard lock(mutex);
+                            if (!error)
+                            {
+                                error = std::current_exception();
+                            }
+                            failed.store(true);
+                        }
+                    }
+                    std::lock_guard lock(mutex);
+                    if (++done == n)
+                    {
+                        condition.notify_all();
+                    }
+                }
+            }
+
+            const std::size_t n;
+            const std::function<void(std::size_t)>* f;
+            std::atomic<std::size_t> next = 0;
+            std::atomic<bool> failed = false;
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::size_t done = 0;
+            std::exception_ptr error;
+        };
+    }
+
+    namespace detail
+    {
+        void parallel_for(thread_pool& pool, std::size_t n, const std::function<void(std::size_t)>& f)
+        {
+            if (n == 0)
+            {
+                return;
+            }
+            if (n == 1 || pool.concurrency() <= 1)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    f(i);
+                }
+                return;
+            }
+
+            auto state = std::make_shared<parallel_for_state>(n, f);
+            const std::size_t nb_helpers = std::min(n - 1, pool.concurrency());
+            for (std::size_t i = 0; i < nb_helpers; ++i)
+            {
+                pool.submit(
+                    [state]
+                    {
+                        state->work();
+                    }
+                );
+            }
+            state->work();
+
+            std::unique_lock lock(state->mutex);
+            state->condition.wait(
+                lock,
+                [&state]
+                {
+                    return state->done == state->n;
+                }
+            );
+            if (state->error)
+            {
+                std::rethrow_exception(state->error);
+            }
+        }
+    }
+
+    record_batch_executor::record_batch_executor(thread_pool& pool, std::size_t morsel_size)
+        : p_pool(&pool)
+        , m_morsel_size(morsel_size)
+    {
+        SPARROW_ASSERT_TRUE(morsel_size > 0);
+    }
+
+    thread_pool& record_batch_executor::pool() const noexcept
+    {
+        return *p_pool;
+    }
+
+    std::size_t record_batch_executor::morsel_size() const noexcept
+    {
+        return m_morsel_size;
+    }
+
+    std::vector<row_range> record_batch_executor::split(std::size_t nb_rows) const
+    {
+        std::vector<row_range> res;
+        res.reserve((nb_rows + m_morsel_size - 1) / m_morsel_size);
+        for (std::size_t begin = 0; begin < nb_rows; begin += m_morsel_size)
+        {
+            res.push_back({begin, std::min(begin + m_morsel_size, nb_rows)});
+        }
+        return res;
+    }
+
+    std::vector<array>
+    record_batch_executor::make_views(const record_batch& rb, const std::vector<row_range>& ranges) const
+    {
+        std::vector<array> res;
+        res.reserve(rb.nb_columns() * ranges.size());
+        for (const array& column : rb.columns())
+        {
+            // slice_view takes positions in the buffers of the column, which
+            // may already be a slice
+            const std::size_t offset = sparrow::detail::array_access::get_arrow_proxy(column).offset();
+            for (const row_range& range : ranges)
+            {
+                res.push_back(column.slice_view(offset + range.begin, offset + range.end));
+            }
+        }
+        return res;
+    }
+}
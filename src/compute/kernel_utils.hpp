@@ -0,0 +1,210 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/compute/compute_utils.hpp"
+#include "sparrow/layout/fixed_width_binary_layout/fixed_width_binary_array_utils.hpp"
+#include "sparrow/utils/repeat_container.hpp"
+
+// Helpers shared by the kernels that build new arrays from the buffers of
+// existing ones.
+
+namespace sparrow::compute::detail
+{
+    // Converts a size of the result of a kernel to its offset type, throws
+    // std::overflow_error if it does not fit
+    template <class O>
+    O checked_size(std::size_t size, std::string_view kernel)
+    {
+        if (std::cmp_greater(size, std::numeric_limits<O>::max()))
+        {
+            throw std::overflow_error(std::string(kernel) + ": the result is too large for its offsets");
+        }
+        return static_cast<O>(size);
+    }
+
+    inline bool is_set(const std::uint8_t* bitmap, std::size_t bit)
+    {
+        return (bitmap[bit / 8] >> (bit % 8)) & 1u;
+    }
+
+    // Validity bitmap of the array, or nullptr if all its elements are valid
+    inline const std::uint8_t* validity_of(const arrow_proxy& source)
+    {
+        if (!has_bitmap(source.data_type()) || source.null_count() == 0)
+        {
+            return nullptr;
+        }
+        return source.buffers()[0].data();
+    }
+
+    // Validity bitmap of the elements of the array starting at bit 0, or an
+    // empty buffer if all its elements are valid
+    inline buffer<std::uint8_t> copy_validity(const arrow_proxy& source, std::size_t& null_count)
+    {
+        const std::uint8_t* validity = validity_of(source);
+        const std::size_t length = source.length();
+        if (validity == nullptr)
+        {
+            null_count = 0;
+            return {};
+        }
+        buffer<std::uint8_t> bytes(validity_bitmap::compute_block_count(length), std::uint8_t(0));
+        copy_bits(validity, source.offset(), bytes.data(), 0, length);
+        validity_bitmap bitmap(std::move(bytes), length);
+        null_count = bitmap.null_count();
+        return std::move(bitmap).extract_storage();
+    }
+
+    // ArrowArray with an offset of 0 owning the given buffers and children
+    inline ArrowArray make_result(
+        std::size_t length,
+        std::size_t null_count,
+        std::vector<buffer<std::uint8_t>>&& buffers,
+        std::vector<ArrowArray>&& children = {},
+        ArrowArray* dictionary = nullptr
+    )
+    {
+        const std::size_t n_children = children.size();
+        ArrowArray** child_arrays = nullptr;
+        if (n_children != 0)
+        {
+            child_arrays = new ArrowArray*[n_children];
+            for (std::size_t i = 0; i < n_children; ++i)
+            {
+                child_arrays[i] = new ArrowArray(std::move(children[i]));
+            }
+        }
+        return make_arrow_array(
+            static_cast<std::int64_t>(length),
+            static_cast<std::int64_t>(null_count),
+            0,  // offset
+            std::move(buffers),
+            child_arrays,
+            repeat_view<bool>(true, n_children),
+            dictionary,
+            true
+        );
+    }
+
+    // Size in bytes of the elements of fixed-width layouts, 0 for the other layouts
+    inline std::size_t fixed_width_size(const arrow_proxy& source)
+    {
+        switch (source.data_type())
+        {
+            // primitive_array<bool> stores one byte per value
+            case data_type::BOOL:
+            case data_type::UINT8:
+            case data_type::INT8:
+                return 1;
+            case data_type::UINT16:
+            case data_type::INT16:
+            case data_type::HALF_FLOAT:
+                return 2;
+            case data_type::UINT32:
+            case data_type::INT32:
+            case data_type::FLOAT:
+            case data_type::DATE_DAYS:
+            case data_type::TIME_SECONDS:
+            case data_type::TIME_MILLISECONDS:
+            case data_type::INTERVAL_MONTHS:
+            case data_type::DECIMAL32:
+                return 4;
+            case data_type::UINT64:
+            case data_type::INT64:
+            case data_type::DOUBLE:
+            case data_type::DATE_MILLISECONDS:
+            case data_type::TIMESTAMP_SECONDS:
+            case data_type::TIMESTAMP_MILLISECONDS:
+            case data_type::TIMESTAMP_MICROSECONDS:
+            case data_type::TIMESTAMP_NANOSECONDS:
+            case data_type::TIME_MICROSECONDS:
+            case data_type::TIME_NANOSECONDS:
+            case data_type::DURATION_SECONDS:
+            case data_type::DURATION_MILLISECONDS:
+            case data_type::DURATION_MICROSECONDS:
+            case data_type::DURATION_NANOSECONDS:
+            case data_type::INTERVAL_DAYS_TIME:
+            case data_type::DECIMAL64:
+                return 8;
+            case data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS:
+            case data_type::DECIMAL128:
+                return 16;
+            case data_type::DECIMAL256:
+                return 32;
+            case data_type::FIXED_WIDTH_BINARY:
+                return num_bytes_for_fixed_sized_binary(source.format());
+            default:
+                return 0;
+        }
+    }
+
+    // Views of binary view arrays: the length, then either the inlined
+    // value or a prefix, the index of the data buffer and the offset in it.
+    // As in variable_size_binary_view_array, the buffer index is the index
+    // of the data buffer in the buffers of the array.
+    constexpr std::size_t view_size = 16;
+    constexpr std::size_t short_view_size = 12;
+    constexpr std::size_t view_buffer_index_offset = 8;
+    constexpr std::size_t view_buffer_offset_offset = 12;
+    constexpr std::int32_t first_data_buffer_index = 2;
+
+    inline std::int32_t read_int32(const std::uint8_t* p)
+    {
+        std::int32_t res;
+        std::memcpy(&res, p, sizeof(res));
+        return res;
+    }
+
+    inline void write_int32(std::uint8_t* p, std::int32_t value)
+    {
+        std::memcpy(p, &value, sizeof(value));
+    }
+
+    // Type ids of the children, in the order of the children, parsed
+    // from the "+ud:<id>,<id>..." or "+us:<id>,<id>..." format
+    inline std::vector<std::uint8_t> union_type_ids(std::string_view format)
+    {
+        format.remove_prefix(4);
+        std::vector<std::uint8_t> res;
+        while (!format.empty())
+        {
+            const auto comma = format.find(',');
+            res.push_back(static_cast<std::uint8_t>(std::stoi(std::string(format.substr(0, comma)))));
+            format.remove_prefix(comma == std::string_view::npos ? format.size() : comma + 1);
+        }
+        return res;
+    }
+
+    // Size of the lists of a fixed-sized list array, parsed from the
+    // "+w:<list size>" format
+    inline std::size_t fixed_sized_list_size(std::string_view format)
+    {
+        return static_cast<std::size_t>(std::stoull(std::string(format.substr(3))));
+    }
+}
@@ -0,0 +1,675 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/compute/selection.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#include "sparrow/arrow_interface/arrow_array_schema_info_utils.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+#include "kernel_utils.hpp"
+
+namespace sparrow::compute
+{
+    namespace
+    {
+        using detail::checked_size;
+        using detail::first_data_buffer_index;
+        using detail::fixed_sized_list_size;
+        using detail::fixed_width_size;
+        using detail::is_set;
+        using detail::make_result;
+        using detail::read_int32;
+        using detail::short_view_size;
+        using detail::union_type_ids;
+        using detail::validity_of;
+        using detail::view_buffer_index_offset;
+        using detail::view_buffer_offset_offset;
+        using detail::view_size;
+        using detail::write_int32;
+
+        using selection_span = std::span<const std::int64_t>;
+
+        constexpr std::int64_t null_position = -1;
+
+        ArrowArray take_array(const arrow_proxy& source, selection_span selection);
+
+        // Positions of the selected elements in the buffers of the array
+        std::vector<std::int64_t> to_physical(const arrow_proxy& source, selection_span selection)
+        {
+            const auto offset = static_cast<std::int64_t>(source.offset());
+            std::vector<std::int64_t> res(selection.size());
+            std::ranges::transform(
+                selection,
+                res.begin(),
+                [offset](std::int64_t s)
+                {
+                    return s < 0 ? null_position : s + offset;
+                }
+            );
+            return res;
+        }
+
+        validity_bitmap take_validity(const std::uint8_t* validity, selection_span physical)
+        {
+            const std::size_t length = physical.size();
+            if (validity == nullptr && std::ranges::none_of(physical, [](std::int64_t p) { return p < 0; }))
+            {
+                return sparrow::detail::make_all_valid_bitmap(length);
+            }
+            buffer<std::uint8_t> bytes(validity_bitmap::compute_block_count(length), std::uint8_t(0));
+            for (std::size_t i = 0; i < length; i += 64)
+            {
+                const std::size_t n = std::min(length - i, std::size_t(64));
+                std::uint64_t word = 0;
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    const std::int64_t p = physical[i + k];
+                    const bool valid = p >= 0
+                                       && (validity == nullptr || is_set(validity, static_cast<std::size_t>(p)));
+                    word |= static_cast<std::uint64_t>(valid) << k;
+                }
+                detail::store_bits(bytes.data() + i / 8, word, n);
+            }
+            return validity_bitmap(std::move(bytes), length);
+        }
+
+        /****************
+         * fixed widths *
+         ****************/
+
+        template <class T>
+        void gather_values(const T* values, selection_span physical, T* out)
+        {
+            for (std::size_t i = 0; i < physical.size(); ++i)
+            {
+                const std::int64_t p = physical[i];
+                out[i] = p < 0 ? T{} : values[p];
+            }
+        }
+
+        buffer<std::uint8_t>
+        take_fixed_width(const buffer_view<std::uint8_t>& values, std::size_t width, selection_span physical)
+        {
+            buffer<std::uint8_t> res(physical.size() * width, std::uint8_t(0));
+            switch (width)
+            {
+                case 1:
+                    gather_values(values.data<const std::uint8_t>(), physical, res.data<std::uint8_t>());
+                    break;
+                case 2:
+                    gather_values(values.data<const std::uint16_t>(), physical, res.data<std::uint16_t>());
+                    break;
+                case 4:
+                    gather_values(values.data<const std::uint32_t>(), physical, res.data<std::uint32_t>());
+                    break;
+                case 8:
+                    gather_values(values.data<const std::uint64_t>(), physical, res.data<std::uint64_t>());
+                    break;
+                default:
+                    for (std::size_t i = 0; i < physical.size(); ++i)
+                    {
+                        if (physical[i] >= 0)
+                        {
+                            const auto p = static_cast<std::size_t>(physical[i]);
+                            std::memcpy(res.data() + i * width, values.data() + p * width, width);
+                        }
+                    }
+                    break;
+            }
+            return res;
+        }
+
+        ArrowArray take_fixed_width_array(const arrow_proxy& source, std::size_t width, selection_span selection)
+        {
+            const auto physical = to_physical(source, selection);
+            validity_bitmap validity = take_validity(validity_of(source), physical);
+            const std::size_t null_count = validity.null_count();
+            std::vector<buffer<std::uint8_t>> buffers(2);
+            buffers[1] = take_fixed_width(source.buffers()[1], width, physical);
+            buffers[0] = std::move(validity).extract_storage();
+
+            ArrowArray* dictionary = nullptr;
+            if (source.dictionary() != nullptr)
+            {
+                // Only the keys are gathered, the dictionary is shared
+                const arrow_proxy& dict = *source.dictionary();
+                dictionary = new ArrowArray(copy_array(dict.array(), dict.schema()));
+            }
+            return make_result(selection.size(), null_count, std::move(buffers), {}, dictionary);
+        }
+
+        /**************************
+         * variable-size binaries *
+         **************************/
+
+        template <class O>
+        ArrowArray take_binary_array(const arrow_proxy& source, selection_span selection)
+        {
+            const auto physical = to_physical(source, selection);
+            validity_bitmap validity = take_validity(validity_of(source), physical);
+            const std::size_t null_count = validity.null_count();
+            const O* offsets = source.buffers()[1].data<const O>();
+            const std::uint8_t* data = source.buffers()[2].data();
+
+            // Offsets of the result first, so that its data is allocated once
+            const std::size_t length = physical.size();
+            u8_buffer<O> new_offsets(length + 1, O(0));
+            std::size_t data_size = 0;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::int64_t p = physical[i];
+                data_size += p < 0 ? 0 : static_cast<std::size_t>(offsets[p + 1] - offsets[p]);
+                new_offsets[i + 1] = checked_size<O>(data_size, "take");
+            }
+
+            buffer<std::uint8_t> new_data(data_size);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::int64_t p = physical[i];
+                if (p >= 0)
+                {
+                    std::memcpy(
+                        new_data.data() + new_offsets[i],
+                        data + offsets[p],
+                        static_cast<std::size_t>(new_offsets[i + 1] - new_offsets[i])
+                    );
+                }
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(3);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            buffers.push_back(std::move(new_data));
+            return make_result(length, null_count, std::move(buffers));
+        }
+
+        // The long values of the result are copied in a single data buffer
+        ArrowArray take_binary_view_array(const arrow_proxy& source, selection_span selection)
+        {
+            const auto physical = to_physical(source, selection);
+            validity_bitmap validity = take_validity(validity_of(source), physical);
+            const std::size_t null_count = validity.null_count();
+            const auto& source_buffers = source.buffers();
+            const std::uint8_t* views = source_buffers[1].data();
+
+            const std::size_t length = physical.size();
+            buffer<std::uint8_t> new_views(length * view_size, std::uint8_t(0));
+            std::size_t long_size = 0;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::int64_t p = physical[i];
+                if (p >= 0)
+                {
+                    const std::uint8_t* view = views + static_cast<std::size_t>(p) * view_size;
+                    std::memcpy(new_views.data() + i * view_size, view, view_size);
+                    const auto size = static_cast<std::size_t>(read_int32(view));
+                    long_size += size > short_view_size ? size : 0;
+                }
+            }
+
+            // The offsets of the long values in their data buffer are 32-bit
+            checked_size<std::int32_t>(long_size, "take");
+
+            buffer<std::uint8_t> long_data(long_size);
+            std::size_t long_offset = 0;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                std::uint8_t* view = new_views.data() + i * view_size;
+                const auto size = static_cast<std::size_t>(read_int32(view));
+                if (size > short_view_size)
+                {
+                    const auto index = static_cast<std::size_t>(read_int32(view + view_buffer_index_offset));
+                    const auto offset = static_cast<std::size_t>(read_int32(view + view_buffer_offset_offset));
+                    std::memcpy(long_data.data() + long_offset, source_buffers[index].data() + offset, size);
+                    write_int32(view + view_buffer_index_offset, first_data_buffer_index);
+                    write_int32(view + view_buffer_offset_offset, static_cast<std::int32_t>(long_offset));
+                    long_offset += size;
+                }
+            }
+
+            u8_buffer<std::int64_t> buffer_sizes(std::size_t(1), static_cast<std::int64_t>(long_size));
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(4);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(new_views));
+            buffers.push_back(std::move(long_data));
+            buffers.push_back(std::move(buffer_sizes).extract_storage());
+            return make_result(length, null_count, std::move(buffers));
+        }
+
+        /*********
+         * lists *
+         *********/
+
+        // Appends the positions [first, last) to the selection of a child
+        void append_range(std::vector<std::int64_t>& child_selection, std::int64_t first, std::int64_t last)
+        {
+            for (std::int64_t j = first; j < last; ++j)
+            {
+                child_selection.push_back(j);
+            }
+        }
+
+        template <class O>
+        ArrowArray take_list_array(const arrow_proxy& source, selection_span selection)
+        {
+            const auto physical = to_physical(source, selection);
+            validity_bitmap validity = take_validity(validity_of(source), physical);
+            const std::size_t null_count = validity.null_count();
+            const O* offsets = source.buffers()[1].data<const O>();
+
+            const std::size_t length = physical.size();
+            u8_buffer<O> new_offsets(length + 1, O(0));
+            std::size_t child_length = 0;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::int64_t p = physical[i];
+                child_length += p < 0 ? 0 : static_cast<std::size_t>(offsets[p + 1] - offsets[p]);
+                new_offsets[i + 1] = checked_size<O>(child_length, "take");
+            }
+
+            std::vector<std::int64_t> child_selection;
+            child_selection.reserve(child_length);
+            for (const std::int64_t p : physical)
+            {
+                if (p >= 0)
+                {
+                    append_range(
+                        child_selection,
+                        static_cast<std::int64_t>(offsets[p]),
+                        static_cast<std::int64_t>(offsets[p + 1])
+                    );
+                }
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(2);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            std::vector<ArrowArray> children;
+            children.push_back(take_array(source.children()[0], child_selection));
+            return make_result(length, null_count, std::move(buffers), std::move(children));
+        }
+
+        // The elements of the result are laid out contiguously in its child
+        template <class O>
+        ArrowArray take_list_view_array(const arrow_proxy& source, selection_span selection)
+        {
+            const auto physical = to_physical(source, selection);
+            validity_bitmap validity = take_validity(validity_of(source), physical);
+            const std::size_t null_count = validity.null_count();
+            const O* offsets = source.buffers()[1].data<const O>();
+            const O* sizes = source.buffers()[2].data<const O>();
+
+            const std::size_t length = physical.size();
+            u8_buffer<O> new_offsets(length, O(0));
+            u8_buffer<O> new_sizes(length, O(0));
+            std::vector<std::int64_t> child_selection;
+            std::size_t child_length = 0;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::int64_t p = physical[i];
+                new_offsets[i] = static_cast<O>(child_length);
+                if (p >= 0)
+                {
+                    new_sizes[i] = sizes[p];
+                    child_length += static_cast<std::size_t>(sizes[p]);
+                    checked_size<O>(child_length, "take");
+                    append_range(
+                        child_selection,
+                        static_cast<std::int64_t>(offsets[p]),
+                        static_cast<std::int64_t>(offsets[p] + sizes[p])
+                    );
+                }
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(3);
+            buffers.push_back(std::move(validity).extract_storage());
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            buffers.push_back(std::move(new_sizes).extract_storage());
+            std::vector<ArrowArray> children;
+            children.push_back(take_array(source.children()[0], child_selection));
+            return make_result(length, null_count, std::move(buffers), std::move(children));
+        }
+
+        ArrowArray take_fixed_sized_list_array(const arrow_proxy& source, selection_span selection)
+        {
+            const auto list_size = static_cast<std::int64_t>(fixed_sized_list_size(source.format()));
+            const auto physical = to_physical(source, selection);
+            validity_bitmap validity = take_validity(validity_of(source), physical);
+            const std::size_t null_count = validity.null_count();
+
+            std::vector<std::int64_t> child_selection;
+            child_selection.reserve(physical.size() * static_cast<std::size_t>(list_size));
+            for (const std::int64_t p : physical)
+            {
+                if (p >= 0)
+                {
+                    append_range(child_selection, p * list_size, (p + 1) * list_size);
+                }
+                else
+                {
+                    child_selection.insert(child_selection.end(), static_cast<std::size_t>(list_size), null_position);
+                }
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(std::move(validity).extract_storage());
+            std::vector<ArrowArray> children;
+            children.push_back(take_array(source.children()[0], child_selection));
+            return make_result(physical.size(), null_count, std::move(buffers), std::move(children));
+        }
+
+        /***********
+         * structs *
+         ***********/
+
+        ArrowArray take_struct_array(const arrow_proxy& source, selection_span selection)
+        {
+            const auto physical = to_physical(source, selection);
+            validity_bitmap validity = take_validity(validity_of(source), physical);
+            const std::size_t null_count = validity.null_count();
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(std::move(validity).extract_storage());
+            std::vector<ArrowArray> children;
+            children.reserve(source.children().size());
+            for (const auto& child : source.children())
+            {
+                children.push_back(take_array(child, physical));
+            }
+            return make_result(physical.size(), null_count, std::move(buffers), std::move(children));
+        }
+
+        /**********
+         * unions *
+         **********/
+
+        // Null positions select the first child, where they are null
+        ArrowArray take_sparse_union_array(const arrow_proxy& source, selection_span selection)
+        {
+            const auto physical = to_physical(source, selection);
+            const auto type_ids = union_type_ids(source.format());
+            const std::uint8_t* source_type_ids = source.buffers()[0].data();
+
+            buffer<std::uint8_t> new_type_ids(physical.size(), std::uint8_t(0));
+            for (std::size_t i = 0; i < physical.size(); ++i)
+            {
+                const std::int64_t p = physical[i];
+                new_type_ids[i] = p < 0 ? type_ids.front() : source_type_ids[p];
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(std::move(new_type_ids));
+            std::vector<ArrowArray> children;
+            children.reserve(source.children().size());
+            for (const auto& child : source.children())
+            {
+                children.push_back(take_array(child, physical));
+            }
+            return make_result(physical.size(), 0, std::move(buffers), std::move(children));
+        }
+
+        ArrowArray take_dense_union_array(const arrow_proxy& source, selection_span selection)
+        {
+            const auto physical = to_physical(source, selection);
+            const auto type_ids = union_type_ids(source.format());
+            std::array<std::size_t, 256> child_index{};
+            for (std::size_t k = 0; k < type_ids.size(); ++k)
+            {
+                child_index[type_ids[k]] = k;
+            }
+            const std::uint8_t* source_type_ids = source.buffers()[0].data();
+            const std::int32_t* source_offsets = source.buffers()[1].data<const std::int32_t>();
+
+            const std::size_t length = physical.size();
+            buffer<std::uint8_t> new_type_ids(length, std::uint8_t(0));
+            u8_buffer<std::int32_t> new_offsets(length, 0);
+            std::vector<std::vector<std::int64_t>> child_selections(type_ids.size());
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::int64_t p = physical[i];
+                const std::uint8_t type_id = p < 0 ? type_ids.front() : source_type_ids[p];
+                auto& child_selection = child_selections[child_index[type_id]];
+                new_type_ids[i] = type_id;
+                new_offsets[i] = checked_size<std::int32_t>(child_selection.size(), "take");
+                child_selection.push_back(p < 0 ? null_position : static_cast<std::int64_t>(source_offsets[p]));
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.reserve(2);
+            buffers.push_back(std::move(new_type_ids));
+            buffers.push_back(std::move(new_offsets).extract_storage());
+            std::vector<ArrowArray> children;
+            children.reserve(type_ids.size());
+            for (std::size_t k = 0; k < type_ids.size(); ++k)
+            {
+                children.push_back(take_array(source.children()[k], child_selections[k]));
+            }
+            return make_result(length, 0, std::move(buffers), std::move(children));
+        }
+
+        /*****************
+         * run-end encoded *
+         *****************/
+
+        // Consecutive selected elements of the same run stay in one run of
+        // the result; the values of the runs are gathered from the values
+        // child.
+        template <class R>
+        ArrowArray take_run_end_encoded_array(const arrow_proxy& source, selection_span selection)
+        {
+            const arrow_proxy& run_ends_proxy = source.children()[0];
+            const arrow_proxy& values_proxy = source.children()[1];
+            const R* run_ends = run_ends_proxy.buffers()[1].data<const R>() + run_ends_proxy.offset();
+            const std::size_t run_count = run_ends_proxy.length();
+            const std::uint8_t* values_validity = validity_of(values_proxy);
+            const auto physical = to_physical(source, selection);
+
+            const auto find_run = [&](std::int64_t p, std::int64_t previous) -> std::int64_t
+            {
+                if (previous >= 0 && std::cmp_less(p, run_ends[previous])
+                    && (previous == 0 || std::cmp_greater_equal(p, run_ends[previous - 1])))
+                {
+                    return previous;
+                }
+                const auto it = std::upper_bound(
+                    run_ends,
+                    run_ends + run_count,
+                    p,
+                    [](std::int64_t lhs, R rhs)
+                    {
+                        return std::cmp_less(lhs, rhs);
+                    }
+                );
+                return static_cast<std::int64_t>(it - run_ends);
+            };
+
+            // The last run end of the result is its length
+            checked_size<R>(physical.size(), "take");
+
+            std::vector<R> new_run_ends;
+            std::vector<std::int64_t> runs;
+            std::size_t null_count = 0;
+            std::int64_t run = null_position;
+            for (std::size_t i = 0; i < physical.size(); ++i)
+            {
+                const std::int64_t p = physical[i];
+                const std::int64_t current = p < 0 ? null_position : find_run(p, run);
+                if (i == 0 || current != run)
+                {
+                    new_run_ends.push_back(R(0));
+                    runs.push_back(current);
+                }
+                run = current;
+                new_run_ends.back() = static_cast<R>(i + 1);
+                const bool valid = current >= 0
+                                   && (values_validity == nullptr
+                                       || is_set(values_validity, values_proxy.offset() + static_cast<std::size_t>(current)));
+                null_count += valid ? 0 : 1;
+            }
+
+            // The run ends child has no null value
+            const std::size_t new_run_count = new_run_ends.size();
+            std::vector<buffer<std::uint8_t>> run_ends_buffers;
+            run_ends_buffers.reserve(2);
+            run_ends_buffers.push_back(sparrow::detail::make_all_valid_bitmap(new_run_count).extract_storage());
+            run_ends_buffers.push_back(u8_buffer<R>(new_run_ends).extract_storage());
+
+            std::vector<ArrowArray> children;
+            children.reserve(2);
+            children.push_back(make_result(new_run_count, 0, std::move(run_ends_buffers)));
+            children.push_back(take_array(values_proxy, runs));
+            return make_result(physical.size(), null_count, {}, std::move(children));
+        }
+
+        ArrowArray take_run_end_encoded_array(const arrow_proxy& source, selection_span selection)
+        {
+            switch (source.children()[0].data_type())
+            {
+                case data_type::INT16:
+                    return take_run_end_encoded_array<std::int16_t>(source, selection);
+                case data_type::UINT16:
+                    return take_run_end_encoded_array<std::uint16_t>(source, selection);
+                case data_type::INT32:
+                    return take_run_end_encoded_array<std::int32_t>(source, selection);
+                case data_type::UINT32:
+                    return take_run_end_encoded_array<std::uint32_t>(source, selection);
+                case data_type::INT64:
+                    return take_run_end_encoded_array<std::int64_t>(source, selection);
+                case data_type::UINT64:
+                    return take_run_end_encoded_array<std::uint64_t>(source, selection);
+                default:
+                    throw std::invalid_argument("take: unsupported type of run ends");
+            }
+        }
+
+        ArrowArray take_array(const arrow_proxy& source, selection_span selection)
+        {
+            if (source.dictionary() != nullptr)
+            {
+                return take_fixed_width_array(source, fixed_width_size(source), selection);
+            }
+
+            switch (source.data_type())
+            {
+                case data_type::NA:
+                    return make_result(selection.size(), selection.size(), {});
+                case data_type::STRING:
+                case data_type::BINARY:
+                    return take_binary_array<std::int32_t>(source, selection);
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                    return take_binary_array<std::int64_t>(source, selection);
+                case data_type::STRING_VIEW:
+                case data_type::BINARY_VIEW:
+                    return take_binary_view_array(source, selection);
+                case data_type::LIST:
+                case data_type::MAP:
+                    return take_list_array<std::int32_t>(source, selection);
+                case data_type::LARGE_LIST:
+                    return take_list_array<std::int64_t>(source, selection);
+                case data_type::LIST_VIEW:
+                    return take_list_view_array<std::int32_t>(source, selection);
+                case data_type::LARGE_LIST_VIEW:
+                    return take_list_view_array<std::int64_t>(source, selection);
+                case data_type::FIXED_SIZED_LIST:
+                    return take_fixed_sized_list_array(source, selection);
+                case data_type::STRUCT:
+                    return take_struct_array(source, selection);
+                case data_type::SPARSE_UNION:
+                    return take_sparse_union_array(source, selection);
+                case data_type::DENSE_UNION:
+                    return take_dense_union_array(source, selection);
+                case data_type::RUN_ENCODED:
+                    return take_run_end_encoded_array(source, selection);
+                default:
+                    break;
+            }
+
+            const std::size_t width = fixed_width_size(source);
+            SPARROW_ASSERT_TRUE(width != 0);
+            return take_fixed_width_array(source, width, selection);
+        }
+    }
+
+    selection_vector make_selection(const primitive_array<bool>& mask)
+    {
+        const auto data = detail::make_array_data<bool>(sparrow::detail::array_access::get_arrow_proxy(mask));
+        const bool* values = data.values + data.offset;
+
+        // Selected elements of each block of 64 elements, so that the
+        // result is allocated once and blocks without selected elements
+        // are skipped.
+        std::vector<std::uint64_t> words((data.length + 63) / 64);
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < data.length; i += 64)
+        {
+            const std::size_t n = std::min(data.length - i, std::size_t(64));
+            std::uint64_t word = 0;
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                word |= static_cast<std::uint64_t>(values[i + k]) << k;
+            }
+            if (data.validity != nullptr)
+            {
+                word &= detail::load_bits(data.validity, data.offset + i, n);
+            }
+            words[i / 64] = word;
+            count += static_cast<std::size_t>(std::popcount(word));
+        }
+
+        selection_vector res;
+        res.reserve(count);
+        for (std::size_t w = 0; w < words.size(); ++w)
+        {
+            std::uint64_t word = words[w];
+            while (word != 0)
+            {
+                res.push_back(static_cast<std::int64_t>(w * 64 + static_cast<std::size_t>(std::countr_zero(word))));
+                word &= word - 1;
+            }
+        }
+        return res;
+    }
+
+    namespace detail
+    {
+        arrow_proxy take(const arrow_proxy& source, std::span<const std::int64_t> selection)
+        {
+            const std::size_t length = source.length();
+            if (std::ranges::any_of(
+                    selection,
+                    [length](std::int64_t s)
+                    {
+                        return std::cmp_greater_equal(s, length);
+                    }
+                ))
+            {
+                throw std::out_of_range("take: index out of range");
+            }
+            ArrowArray result = take_array(source, selection);
+            return arrow_proxy(std::move(result), copy_schema(source.schema()));
+        }
+    }
+}
@@ -0,0 +1,384 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/compute/sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "sparrow/types/data_type.hpp"
+
+#include "kernel_utils.hpp"
+
+namespace sparrow::compute
+{
+    namespace
+    {
+        using detail::is_set;
+        using detail::read_int32;
+        using detail::short_view_size;
+        using detail::validity_of;
+        using detail::view_buffer_index_offset;
+        using detail::view_buffer_offset_offset;
+        using detail::view_size;
+
+        using position_span = std::span<std::int64_t>;
+
+        // Moves the positions of the null elements to the start or to the
+        // end, keeping their order, and returns the positions of the valid
+        // elements
+        position_span partition_nulls(const arrow_proxy& source, null_placement nulls, selection_vector& positions)
+        {
+            const std::uint8_t* validity = validity_of(source);
+            if (validity == nullptr)
+            {
+                return positions;
+            }
+            const std::size_t offset = source.offset();
+            const auto is_valid = [validity, offset](std::int64_t p)
+            {
+                return is_set(validity, offset + static_cast<std::size_t>(p));
+            };
+            if (nulls == null_placement::at_end)
+            {
+                const auto valid_end = std::stable_partition(positions.begin(), positions.end(), is_valid);
+                return {positions.begin(), valid_end};
+            }
+            const auto valid_begin = std::stable_partition(
+                positions.begin(),
+                positions.end(),
+                [&is_valid](std::int64_t p)
+                {
+                    return !is_valid(p);
+                }
+            );
+            return {valid_begin, positions.end()};
+        }
+
+        /**************
+         * radix sort *
+         **************/
+
+        // Unsigned keys whose order is the order of the values. NaN values
+        // are sorted after all the other values, and -0 is equal to +0.
+
+        template <std::integral T>
+        auto radix_key(T value)
+        {
+            using key_type = std::make_unsigned_t<T>;
+            if constexpr (std::is_signed_v<T>)
+            {
+                constexpr key_type sign_bit = key_type(1) << (sizeof(T) * 8 - 1);
+                return static_cast<key_type>(static_cast<key_type>(value) ^ sign_bit);
+            }
+            else
+            {
+                return static_cast<key_type>(value);
+            }
+        }
+
+        template <std::floating_point T>
+        auto radix_key(T value)
+        {
+            using key_type = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+            constexpr key_type sign_bit = key_type(1) << (sizeof(T) * 8 - 1);
+            if (std::isnan(value))
+            {
+                value = std::numeric_limits<T>::quiet_NaN();
+            }
+            else if (value == T(0))
+            {
+                value = T(0);
+            }
+            const auto bits = std::bit_cast<key_type>(value);
+            return static_cast<key_type>((bits & sign_bit) != 0 ? ~bits : bits | sign_bit);
+        }
+
+        auto radix_key(float16_t value)
+        {
+            return radix_key(static_cast<float>(value));
+        }
+
+        // LSD radix sort of the positions on their keys, one byte per pass.
+        // The passes on the bytes that are the same for all the keys are
+        // skipped.
+        template <class K>
+        void radix_sort(std::vector<K>& keys, position_span positions)
+        {
+            const std::size_t n = keys.size();
+            std::array<std::array<std::size_t, 256>, sizeof(K)> counts{};
+            for (const K key : keys)
+            {
+                for (std::size_t d = 0; d < sizeof(K); ++d)
+                {
+                    ++counts[d][static_cast<std::size_t>((key >> (8 * d)) & 0xffu)];
+                }
+            }
+
+            std::vector<std::int64_t> current(positions.begin(), positions.end());
+            std::vector<K> next_keys(n);
+            std::vector<std::int64_t> next(n);
+            for (std::size_t d = 0; d < sizeof(K); ++d)
+            {
+                auto& count = counts[d];
+                if (count[static_cast<std::size_t>((keys[0] >> (8 * d)) & 0xffu)] == n)
+                {
+                    continue;
+                }
+                std::size_t start = 0;
+                for (std::size_t& c : count)
+                {
+                    start += std::exchange(c, start);
+                }
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const std::size_t bucket = static_cast<std::size_t>((keys[i] >> (8 * d)) & 0xffu);
+                    const std::size_t j = count[bucket]++;
+                    next_keys[j] = keys[i];
+                    next[j] = current[i];
+                }
+                keys.swap(next_keys);
+                current.swap(next);
+            }
+            std::ranges::copy(current, positions.begin());
+        }
+
+        template <class T>
+        void sort_fixed_width(const arrow_proxy& source, sort_order order, position_span positions)
+        {
+            if (positions.empty())
+            {
+                return;
+            }
+            const T* values = source.buffers()[1].data<const T>() + source.offset();
+            using key_type = decltype(radix_key(std::declval<T>()));
+            // Descending keys are the complement of the ascending ones, so
+            // that the sort stays stable
+            const key_type mask = order == sort_order::descending ? static_cast<key_type>(~key_type(0))
+                                                                  : key_type(0);
+            std::vector<key_type> keys(positions.size());
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                keys[i] = static_cast<key_type>(radix_key(values[positions[i]]) ^ mask);
+            }
+            if constexpr (!std::integral<T>)
+            {
+                // NaN values are sorted after all the other values in both
+                // orders: their complemented key would put them first
+                const T nan = T(std::numeric_limits<float>::quiet_NaN());
+                const key_type nan_key = static_cast<key_type>(radix_key(nan) ^ mask);
+                for (key_type& key : keys)
+                {
+                    if (key == nan_key)
+                    {
+                        key = std::numeric_limits<key_type>::max();
+                    }
+                }
+            }
+            radix_sort(keys, positions);
+        }
+
+        /***********************
+         * strings and binaries *
+         ***********************/
+
+        struct string_entry
+        {
+            std::uint32_t prefix;
+            std::int64_t position;
+            std::string_view value;
+        };
+
+        // First 4 bytes as a big-endian integer, padded with zeros, so that
+        // prefixes compare as the strings they start
+        std::uint32_t load_prefix(const std::uint8_t* data, std::size_t size)
+        {
+            std::uint32_t res = 0;
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                res = (res << 8) | (k < size ? data[k] : 0u);
+            }
+            return res;
+        }
+
+        std::string_view to_string_view(const std::uint8_t* data, std::size_t size)
+        {
+            return {reinterpret_cast<const char*>(data), size};
+        }
+
+        void sort_strings(std::vector<string_entry>& entries, sort_order order, position_span positions)
+        {
+            // The full values are only compared when the prefixes are equal
+            const auto less = [](const string_entry& lhs, const string_entry& rhs)
+            {
+                if (lhs.prefix != rhs.prefix)
+                {
+                    return lhs.prefix < rhs.prefix;
+                }
+                return lhs.value < rhs.value;
+            };
+            if (order == sort_order::ascending)
+            {
+                std::ranges::stable_sort(entries, less);
+            }
+            else
+            {
+                std::ranges::stable_sort(
+                    entries,
+                    [&less](const string_entry& lhs, const string_entry& rhs)
+                    {
+                        return less(rhs, lhs);
+                    }
+                );
+            }
+            for (std::size_t i = 0; i < entries.size(); ++i)
+            {
+                positions[i] = entries[i].position;
+            }
+        }
+
+        template <class O>
+        void sort_binary(const arrow_proxy& source, sort_order order, position_span positions)
+        {
+            const O* offsets = source.buffers()[1].data<const O>() + source.offset();
+            const std::uint8_t* data = source.buffers()[2].data();
+            std::vector<string_entry> entries(positions.size());
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                const auto p = static_cast<std::size_t>(positions[i]);
+                const std::uint8_t* value = data + offsets[p];
+                const auto size = static_cast<std::size_t>(offsets[p + 1] - offsets[p]);
+                entries[i] = {load_prefix(value, size), positions[i], to_string_view(value, size)};
+            }
+            sort_strings(entries, order, positions);
+        }
+
+        // The prefix is read from the view, whether the value is inlined
+        // or not
+        void sort_binary_view(const arrow_proxy& source, sort_order order, position_span positions)
+        {
+            const auto& buffers = source.buffers();
+            const std::uint8_t* views = buffers[1].data() + source.offset() * view_size;
+            std::vector<string_entry> entries(positions.size());
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                const std::uint8_t* view = views + static_cast<std::size_t>(positions[i]) * view_size;
+                const auto size = static_cast<std::size_t>(read_int32(view));
+                const std::uint8_t* prefix = view + 4;
+                const std::uint8_t* value = prefix;
+                if (size > short_view_size)
+                {
+                    const auto index = static_cast<std::size_t>(read_int32(view + view_buffer_index_offset));
+                    const auto offset = static_cast<std::size_t>(read_int32(view + view_buffer_offset_offset));
+                    value = buffers[index].data() + offset;
+                }
+                entries[i] = {load_prefix(prefix, 4), positions[i], to_string_view(value, size)};
+            }
+            sort_strings(entries, order, positions);
+        }
+    }
+
+    namespace detail
+    {
+        void sort_positions(const arrow_proxy& source, const sort_options& options, selection_vector& positions)
+        {
+            if (source.dictionary() != nullptr)
+            {
+                throw std::invalid_argument("sort: dictionary-encoded arrays are not supported");
+            }
+            const position_span valid = partition_nulls(source, options.nulls, positions);
+            const sort_order order = options.order;
+            switch (source.data_type())
+            {
+                case data_type::BOOL:
+                case data_type::UINT8:
+                    return sort_fixed_width<std::uint8_t>(source, order, valid);
+                case data_type::INT8:
+                    return sort_fixed_width<std::int8_t>(source, order, valid);
+                case data_type::UINT16:
+                    return sort_fixed_width<std::uint16_t>(source, order, valid);
+                case data_type::INT16:
+                    return sort_fixed_width<std::int16_t>(source, order, valid);
+                case data_type::UINT32:
+                    return sort_fixed_width<std::uint32_t>(source, order, valid);
+                case data_type::INT32:
+                case data_type::DATE_DAYS:
+                case data_type::TIME_SECONDS:
+                case data_type::TIME_MILLISECONDS:
+                case data_type::DECIMAL32:
+                    return sort_fixed_width<std::int32_t>(source, order, valid);
+                case data_type::UINT64:
+                    return sort_fixed_width<std::uint64_t>(source, order, valid);
+                case data_type::INT64:
+                case data_type::DATE_MILLISECONDS:
+                case data_type::TIMESTAMP_SECONDS:
+                case data_type::TIMESTAMP_MILLISECONDS:
+                case data_type::TIMESTAMP_MICROSECONDS:
+                case data_type::TIMESTAMP_NANOSECONDS:
+                case data_type::TIME_MICROSECONDS:
+                case data_type::TIME_NANOSECONDS:
+                case data_type::DURATION_SECONDS:
+                case data_type::DURATION_MILLISECONDS:
+                case data_type::DURATION_MICROSECONDS:
+                case data_type::DURATION_NANOSECONDS:
+                case data_type::DECIMAL64:
+                    return sort_fixed_width<std::int64_t>(source, order, valid);
+                case data_type::HALF_FLOAT:
+                    return sort_fixed_width<float16_t>(source, order, valid);
+                case data_type::FLOAT:
+                    return sort_fixed_width<float32_t>(source, order, valid);
+                case data_type::DOUBLE:
+                    return sort_fixed_width<float64_t>(source, order, valid);
+                case data_type::STRING:
+                case data_type::BINARY:
+                    return sort_binary<std::int32_t>(source, order, valid);
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                    return sort_binary<std::int64_t>(source, order, valid);
+                case data_type::STRING_VIEW:
+                case data_type::BINARY_VIEW:
+                    return sort_binary_view(source, order, valid);
+                default:
+                    throw std::invalid_argument("sort: unsupported data type");
+            }
+        }
+    }
+
+    selection_vector sort_indices(const record_batch& rb, std::span<const sort_key> keys)
+    {
+        std::vector<const arrow_proxy*> columns;
+        columns.reserve(keys.size());
+        for (const sort_key& key : keys)
+        {
+            columns.push_back(&sparrow::detail::array_access::get_arrow_proxy(rb.get_column(key.name)));
+        }
+
+        selection_vector positions(rb.nb_rows());
+        std::iota(positions.begin(), positions.end(), std::int64_t(0));
+        // Each stable sort keeps the order of the following keys for the
+        // rows with equal values
+        for (std::size_t k = keys.size(); k-- > 0;)
+        {
+            detail::sort_positions(*columns[k], keys[k].options, positions);
+        }
+        return positions;
+    }
+}
@@ -0,0 +1,711 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "encoder.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_interface/arrow_flag_utils.hpp"
+#include "sparrow/ipc/ipc_error.hpp"
+
+#include "metadata.hpp"
+
+namespace sparrow::ipc::detail
+{
+    namespace
+    {
+        // Values of the TimeUnit enum
+        [[nodiscard]] std::int16_t time_unit(char c)
+        {
+            switch (c)
+            {
+                case 's':
+                    return 0;
+                case 'm':
+                    return 1;
+                case 'u':
+                    return 2;
+                case 'n':
+                    return 3;
+                default:
+                    throw ipc_error(std::string("Invalid time unit: ") + c);
+            }
+        }
+
+        [[nodiscard]] std::int32_t parse_int(std::string_view s)
+        {
+            std::int32_t res = 0;
+            const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), res);
+            if (ec != std::errc() || ptr != s.data() + s.size())
+            {
+                throw ipc_error("Invalid format parameter: " + std::string(s));
+            }
+            return res;
+        }
+
+        // Splits the comma-separated parameters following the prefix of a format
+        [[nodiscard]] std::vector<std::int32_t> parse_ints(std::string_view s)
+        {
+            std::vector<std::int32_t> res;
+            while (!s.empty())
+            {
+                const std::size_t comma = std::min(s.find(','), s.size());
+                res.push_back(parse_int(s.substr(0, comma)));
+                s.remove_prefix(std::min(comma + 1, s.size()));
+            }
+            return res;
+        }
+
+        [[nodiscard]] fb_table_builder int_type(std::string_view format)
+        {
+            static constexpr std::string_view formats = "cCsSiIlL";
+            const std::size_t i = format.size() == 1 ? formats.find(format[0]) : std::string_view::npos;
+            if (i == std::string_view::npos)
+            {
+                throw ipc_error("Invalid integer format: " + std::string(format));
+            }
+            fb_table_builder res;
+            res.add_scalar<std::int32_t>(0, static_cast<std::int32_t>(8 << (i / 2)));
+            res.add_scalar<std::uint8_t>(1, i % 2 == 0 ? 1 : 0);
+            return res;
+        }
+
+        /*
+         * Sets the type_type and type fields of a Field from a format string.
+         */
+        void set_type(fb_table_builder& fb_field, std::string_view format, std::int64_t flags)
+        {
+            auto set = [&fb_field](type_id id, fb_table_builder type = {})
+            {
+                fb_field.add_scalar<std::uint8_t>(field::type_type, static_cast<std::uint8_t>(id));
+                fb_field.add_table(field::type, std::move(type));
+            };
+            auto with_unit = [](std::int16_t unit)
+            {
+                fb_table_builder res;
+                res.add_scalar<std::int16_t>(0, unit);
+                return res;
+            };
+            auto with_int = [](std::int32_t value)
+            {
+                fb_table_builder res;
+                res.add_scalar<std::int32_t>(0, value);
+                return res;
+            };
+
+            if (format.size() == 1)
+            {
+                switch (format[0])
+                {
+                    case 'n':
+                        return set(type_id::null);
+                    case 'b':
+                        return set(type_id::bool_);
+                    case 'e':
+                        return set(type_id::floating_point, with_unit(0));
+                    case 'f':
+                        return set(type_id::floating_point, with_unit(1));
+                    case 'g':
+                        return set(type_id::floating_point, with_unit(2));
+                    case 'z':
+                        return set(type_id::binary);
+                    case 'u':
+                        return set(type_id::utf8);
+                    case 'Z':
+                        return set(type_id::large_binary);
+                    case 'U':
+                        return set(type_id::large_utf8);
+                    default:
+                        return set(type_id::int_, int_type(format));
+                }
+            }
+            if (format == "vz")
+            {
+                return set(type_id::binary_view);
+            }
+            if (format == "vu")
+            {
+                return set(type_id::utf8_view);
+            }
+            if (format.starts_with("d:"))
+            {
+                const std::vector<std::int32_t> params = parse_ints(format.substr(2));
+                if (params.size() < 2)
+                {
+                    throw ipc_error("Invalid decimal format: " + std::string(format));
+                }
+                fb_table_builder type;
+                type.add_scalar<std::int32_t>(0, params[0]);
+                type.add_scalar<std::int32_t>(1, params[1]);
+                type.add_scalar<std::int32_t>(2, params.size() > 2 ? params[2] : 128);
+                return set(type_id::decimal, std::move(type));
+            }
+            if (format.starts_with("w:"))
+            {
+                return set(type_id::fixed_size_binary, with_int(parse_int(format.substr(2))));
+            }
+            if (format == "tdD" || format == "tdm")
+            {
+                return set(type_id::date, with_unit(format[2] == 'D' ? 0 : 1));
+            }
+            if (format.size() == 3 && format.starts_with("tt"))
+            {
+                fb_table_builder type = with_unit(time_unit(format[2]));
+                type.add_scalar<std::int32_t>(1, format[2] == 's' || format[2] == 'm' ? 32 : 64);
+                return set(type_id::time, std::move(type));
+            }
+            if (format.size() >= 4 && format.starts_with("ts") && format[3] == ':')
+            {
+                fb_table_builder type = with_unit(time_unit(format[2]));
+                if (format.size() > 4)
+                {
+                    type.add_string(1, format.substr(4));
+                }
+                return set(type_id::timestamp, std::move(type));
+            }
+            if (format.size() == 3 && format.starts_with("tD"))
+            {
+                return set(type_id::duration, with_unit(time_unit(format[2])));
+            }
+            if (format == "tiM" || format == "tiD" || format == "tin")
+            {
+                return set(type_id::interval, with_unit(format[2] == 'M' ? 0 : (format[2] == 'D' ? 1 : 2)));
+            }
+            if (format == "+l")
+            {
+                return set(type_id::list);
+            }
+            if (format == "+L")
+            {
+                return set(type_id::large_list);
+            }
+            if (format == "+vl")
+            {
+                return set(type_id::list_view);
+            }
+            if (format == "+vL")
+            {
+                return set(type_id::large_list_view);
+            }
+            if (format.starts_with("+w:"))
+            {
+                return set(type_id::fixed_size_list, with_int(parse_int(format.substr(3))));
+            }
+            if (format == "+s")
+            {
+                return set(type_id::struct_);
+            }
+            if (format == "+m")
+            {
+                fb_table_builder type;
+                type.add_scalar<std::uint8_t>(0, (flags & static_cast<std::int64_t>(ArrowFlag::MAP_KEYS_SORTED)) != 0 ? 1 : 0);
+                return set(type_id::map, std::move(type));
+            }
+            if (format.starts_with("+ud:") || format.starts_with("+us:"))
+            {
+                const std::vector<std::int32_t> type_ids = parse_ints(format.substr(4));
+                fb_table_builder type = with_unit(format[2] == 'd' ? 1 : 0);
+                type.add_vector<std::int32_t>(1, type_ids);
+                return set(type_id::union_, std::move(type));
+            }
+            if (format == "+r")
+            {
+                return set(type_id::run_end_encoded);
+            }
+            throw ipc_error("Unsupported format: " + std::string(format));
+        }
+
+        /*
+         * Decodes the binary metadata of the C data interface into KeyValue tables.
+         */
+        [[nodiscard]] std::vector<fb_table_builder> encode_metadata(std::string_view metadata)
+        {
+            auto read_int32 = [&metadata]()
+            {
+                std::int32_t res = 0;
+                if (metadata.size() < sizeof(res))
+                {
+                    throw ipc_error("Invalid metadata");
+                }
+                std::memcpy(&res, metadata.data(), sizeof(res));
+                metadata.remove_prefix(sizeof(res));
+                return static_cast<std::size_t>(res);
+            };
+            auto read_string = [&]()
+            {
+                const std::size_t size = read_int32();
+                if (metadata.size() < size)
+                {
+                    throw ipc_error("Invalid metadata");
+                }
+                const std::string_view res = metadata.substr(0, size);
+                metadata.remove_prefix(size);
+                return res;
+            };
+
+            std::vector<fb_table_builder> res;
+            const std::size_t n = read_int32();
+            res.reserve(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                fb_table_builder& kv = res.emplace_back();
+                kv.add_string(key_value_field::key, read_string());
+                kv.add_string(key_value_field::value, read_string());
+            }
+            return res;
+        }
+
+        [[nodiscard]] std::int64_t get_flags(const arrow_proxy& proxy)
+        {
+            return proxy.schema().flags;
+        }
+
+        [[nodiscard]] fb_table_builder
+        encode_field(const arrow_proxy& proxy, std::string_view name, std::vector<const arrow_proxy*>& dictionaries)
+        {
+            fb_table_builder res;
+            const std::int64_t flags = get_flags(proxy);
+            if (!name.empty())
+            {
+                res.add_string(field::name, name);
+            }
+            res.add_scalar<std::uint8_t>(field::nullable, (flags & static_cast<std::int64_t>(ArrowFlag::NULLABLE)) != 0 ? 1 : 0);
+            if (const auto metadata = proxy.metadata(); metadata.has_value() && !metadata->empty())
+            {
+                res.add_tables(field::custom_metadata, encode_metadata(*metadata));
+            }
+
+            // For dictionary-encoded arrays, the type and the children of the
+            // field are the ones of the dictionary.
+            const arrow_proxy& values = proxy.dictionary() ? *proxy.dictionary() : proxy;
+            if (proxy.dictionary())
+            {
+                fb_table_builder encoding;
+                encoding.add_scalar<std::int64_t>(dictionary_encoding_field::id, static_cast<std::int64_t>(dictionaries.size()));
+                encoding.add_table(dictionary_encoding_field::index_type, int_type(proxy.format()));
+                if ((flags & static_cast<std::int64_t>(ArrowFlag::DICTIONARY_ORDERED)) != 0)
+                {
+                    encoding.add_scalar<std::uint8_t>(dictionary_encoding_field::is_ordered, 1);
+                }
+                res.add_table(field::dictionary, std::move(encoding));
+                dictionaries.push_back(proxy.dictionary().get());
+            }
+            set_type(res, values.format(), get_flags(values));
+
+            std::vector<fb_table_builder> children;
+            children.reserve(values.n_children());
+            for (const arrow_proxy& child : values.children())
+            {
+                children.push_back(encode_field(child, child.name().value_or(""), dictionaries));
+            }
+            res.add_tables(field::children, std::move(children));
+            return res;
+        }
+
+        [[nodiscard]] fb_table_builder make_message(message_type type, fb_table_builder header, std::size_t body_size)
+        {
+            fb_table_builder res;
+            res.add_scalar<std::int16_t>(message_field::version, metadata_version_v5);
+            res.add_scalar<std::uint8_t>(message_field::header_type, static_cast<std::uint8_t>(type));
+            res.add_table(message_field::header, std::move(header));
+            res.add_scalar<std::int64_t>(message_field::body_length, static_cast<std::int64_t>(body_size));
+            return res;
+        }
+
+        // Size in bytes of the elements of fixed-width layouts, 0 for other layouts
+        [[nodiscard]] std::size_t fixed_width_size(std::string_view format)
+        {
+            if (format.size() == 1)
+            {
+                switch (format[0])
+                {
+                    case 'c':
+                    case 'C':
+                        return 1;
+                    case 's':
+                    case 'S':
+                    case 'e':
+                        return 2;
+                    case 'i':
+                    case 'I':
+                    case 'f':
+                        return 4;
+                    case 'l':
+                    case 'L':
+                    case 'g':
+                        return 8;
+                    default:
+                        return 0;
+                }
+            }
+            if (format.starts_with("d:"))
+            {
+                const std::vector<std::int32_t> params = parse_ints(format.substr(2));
+                return static_cast<std::size_t>(params.size() > 2 ? params[2] : 128) / 8;
+            }
+            if (format.starts_with("w:"))
+            {
+                return static_cast<std::size_t>(parse_int(format.substr(2)));
+            }
+            if (format == "tdD" || format == "tiM" || format == "tts" || format == "ttm")
+            {
+                return 4;
+            }
+            if (format == "tdm" || format == "tiD" || format == "ttu" || format == "ttn"
+                || format.starts_with("ts") || format.starts_with("tD"))
+            {
+                return 8;
+            }
+            if (format == "tin")
+            {
+                return 16;
+            }
+            return 0;
+        }
+
+        [[nodiscard]] std::size_t count_zeros(const std::uint8_t* bitmap, std::size_t offset, std::size_t length)
+        {
+            std::size_t set_bits = 0;
+            std::size_t i = offset;
+            const std::size_t end = offset + length;
+            for (; i < end && i % 8 != 0; ++i)
+            {
+                set_bits += (bitmap[i / 8] >> (i % 8)) & 1;
+            }
+            for (; i + 64 <= end; i += 64)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, bitmap + i / 8, sizeof(word));
+                set_bits += static_cast<std::size_t>(std::popcount(word));
+            }
+            for (; i < end; ++i)
+            {
+                set_bits += (bitmap[i / 8] >> (i % 8)) & 1;
+            }
+            return length - set_bits;
+        }
+
+        template <class T>
+        [[nodiscard]] T load(const void* buffer, std::size_t index)
+        {
+            T res;
+            std::memcpy(&res, static_cast<const std::uint8_t*>(buffer) + index * sizeof(T), sizeof(T));
+            return res;
+        }
+    }
+
+    void collect_dictionaries(const arrow_proxy& column, std::vector<const arrow_proxy*>& dictionaries)
+    {
+        // Same traversal as encode_field, so that ids match
+        const arrow_proxy& values = column.dictionary() ? *column.dictionary() : column;
+        if (column.dictionary())
+        {
+            dictionaries.push_back(column.dictionary().get());
+        }
+        for (const arrow_proxy& child : values.children())
+        {
+            collect_dictionaries(child, dictionaries);
+        }
+    }
+
+    std::vector<std::uint8_t> encode_schema_message(const record_batch& batch)
+    {
+        std::vector<const arrow_proxy*> dictionaries;
+        std::vector<fb_table_builder> fields;
+        fields.reserve(batch.nb_columns());
+        for (std::size_t i = 0; i < batch.nb_columns(); ++i)
+        {
+            const arrow_proxy& proxy = sparrow::detail::array_access::get_arrow_proxy(batch.get_column(i));
+            fields.push_back(encode_field(proxy, batch.get_column_name(i), dictionaries));
+        }
+        fb_table_builder schema;
+        schema.add_scalar<std::int16_t>(schema_field::endianness, 0);
+        schema.add_tables(schema_field::fields, std::move(fields));
+        return make_message(message_type::schema, std::move(schema), 0).finish();
+    }
+
+    void body_encoder::append(const arrow_proxy& proxy)
+    {
+        append(proxy, proxy.offset(), proxy.length());
+    }
+
+    void body_encoder::add_buffer(const void* data, std::size_t size)
+    {
+        if (data == nullptr)
+        {
+            size = 0;
+        }
+        m_buffers.push_back({static_cast<std::int64_t>(m_body_size), static_cast<std::int64_t>(size)});
+        if (size == 0)
+        {
+            return;
+        }
+        m_segments.emplace_back(static_cast<const std::uint8_t*>(data), size);
+        const std::size_t padding = (8 - size % 8) % 8;
+        if (padding != 0)
+        {
+            m_segments.emplace_back(zero_bytes.data(), padding);
+        }
+        m_body_size += size + padding;
+    }
+
+    void body_encoder::add_bitmap(const void* bitmap, std::size_t offset, std::size_t length)
+    {
+        const auto* bits = static_cast<const std::uint8_t*>(bitmap);
+        const std::size_t size = (length + 7) / 8;
+        if (bits == nullptr || offset % 8 == 0)
+        {
+            add_buffer(bits == nullptr ? nullptr : bits + offset / 8, size);
+            return;
+        }
+        // IPC bitmaps start at bit 0: the bitmap of a slice that does not start
+        // on a byte boundary is the only part of a body that must be copied.
+        std::vector<std::uint8_t>& shifted = m_owned_buffers.emplace_back(size, 0);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            const std::size_t j = offset + i;
+            shifted[i / 8] |= static_cast<std::uint8_t>(((bits[j / 8] >> (j % 8)) & 1) << (i % 8));
+        }
+        add_buffer(shifted.data(), size);
+    }
+
+    void body_encoder::add_validity(const arrow_proxy& proxy, std::size_t offset, std::size_t length)
+    {
+        const ArrowArray& array = proxy.array();
+        const auto* bitmap = array.n_buffers > 0 ? static_cast<const std::uint8_t*>(array.buffers[0]) : nullptr;
+        // The whole array is covered: the null count of the proxy is reliable
+        const bool whole = offset == proxy.offset() && length == proxy.length();
+        std::size_t null_count = 0;
+        if (bitmap != nullptr)
+        {
+            null_count = whole && proxy.null_count() >= 0 ? static_cast<std::size_t>(proxy.null_count())
+                                                          : count_zeros(bitmap, offset, length);
+        }
+        m_nodes.push_back({static_cast<std::int64_t>(length), static_cast<std::int64_t>(null_count)});
+        // Writers may omit the validity bitmap of arrays without nulls
+        add_bitmap(null_count == 0 ? nullptr : bitmap, offset, length);
+    }
+
+    void body_encoder::append(const arrow_proxy& proxy, std::size_t offset, std::size_t length)
+    {
+        const ArrowArray& array = proxy.array();
+        const std::string_view format = proxy.format();
+        const void* const* buffers = array.buffers;
+        auto child_at = [&proxy](std::size_t i) -> const arrow_proxy&
+        {
+            return proxy.children()[i];
+        };
+        auto append_children = [&]()
+        {
+            for (const arrow_proxy& child : proxy.children())
+            {
+                append(child, child.offset(), child.length());
+            }
+        };
+
+        if (format == "n")
+        {
+            m_nodes.push_back({static_cast<std::int64_t>(length), static_cast<std::int64_t>(length)});
+            return;
+        }
+        if (format == "+r")
+        {
+            // The offset of a run-end encoded array is logical, it cannot be
+            // expressed in the IPC format without rewriting the run ends.
+            if (offset != 0)
+            {
+                throw ipc_error("Writing sliced run-end encoded arrays is not supported");
+            }
+            m_nodes.push_back({static_cast<std::int64_t>(length), 0});
+            append_children();
+            return;
+        }
+
+        if (format.starts_with("+u"))
+        {
+            // Unions have no validity bitmap, their first buffer holds the type ids
+            m_nodes.push_back({static_cast<std::int64_t>(length), 0});
+            add_buffer(static_cast<const std::int8_t*>(buffers[0]) + offset, length);
+            if (format.starts_with("+ud:"))
+            {
+                add_buffer(static_cast<const std::int32_t*>(buffers[1]) + offset, length * sizeof(std::int32_t));
+                append_children();
+            }
+            else
+            {
+                for (const arrow_proxy& child : proxy.children())
+                {
+                    append(child, child.offset() + offset, length);
+                }
+            }
+            return;
+        }
+
+        add_validity(proxy, offset, length);
+
+        if (format == "b")
+        {
+            // sparrow stores booleans as bytes, IPC as bits
+            const auto* values = static_cast<const std::uint8_t*>(buffers[1]) + offset;
+            std::vector<std::uint8_t>& packed = m_owned_buffers.emplace_back((length + 7) / 8, 0);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                packed[i / 8] |= static_cast<std::uint8_t>((values[i] != 0 ? 1 : 0) << (i % 8));
+            }
+            add_buffer(packed.data(), packed.size());
+        }
+        else if (const std::size_t width = fixed_width_size(format); width != 0)
+        {
+            add_buffer(static_cast<const std::uint8_t*>(buffers[1]) + offset * width, length * width);
+        }
+        else if (format == "z" || format == "u" || format == "+l" || format == "+m")
+        {
+            // Offsets are not rebased, so the values start at the beginning of
+            // the data buffer or of the child array.
+            add_buffer(static_cast<const std::int32_t*>(buffers[1]) + offset, (length + 1) * sizeof(std::int32_t));
+            if (format == "z" || format == "u")
+            {
+                add_buffer(buffers[2], static_cast<std::size_t>(load<std::int32_t>(buffers[1], offset + length)));
+            }
+            else
+            {
+                append_children();
+            }
+        }
+        else if (format == "Z" || format == "U" || format == "+L")
+        {
+            add_buffer(static_cast<const std::int64_t*>(buffers[1]) + offset, (length + 1) * sizeof(std::int64_t));
+            if (format == "Z" || format == "U")
+            {
+                add_buffer(buffers[2], static_cast<std::size_t>(load<std::int64_t>(buffers[1], offset + length)));
+            }
+            else
+            {
+                append_children();
+            }
+        }
+        else if (format == "+vl" || format == "+vL")
+        {
+            const std::size_t size = format == "+vl" ? sizeof(std::int32_t) : sizeof(std::int64_t);
+            add_buffer(static_cast<const std::uint8_t*>(buffers[1]) + offset * size, length * size);
+            add_buffer(static_cast<const std::uint8_t*>(buffers[2]) + offset * size, length * size);
+            append_children();
+        }
+        else if (format == "vz" || format == "vu")
+        {
+            // sparrow counts the buffer indexes of the views from the whole list
+            // of buffers, Arrow IPC from the first variadic buffer
+            constexpr std::size_t view_size = 16;
+            constexpr std::size_t short_view_size = 12;
+            constexpr std::int32_t first_data_buffer_index = 2;
+            const auto* views = static_cast<const std::uint8_t*>(buffers[1]) + offset * view_size;
+            std::vector<std::uint8_t>& rebased = m_owned_buffers.emplace_back(views, views + length * view_size);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                std::uint8_t* view = rebased.data() + i * view_size;
+                if (static_cast<std::size_t>(load<std::int32_t>(view, 0)) > short_view_size)
+                {
+                    const std::int32_t index = load<std::int32_t>(view, 2) - first_data_buffer_index;
+                    std::memcpy(view + 8, &index, sizeof(index));
+                }
+            }
+            add_buffer(rebased.data(), rebased.size());
+            // The last buffer holds the sizes of the variadic buffers
+            const auto n_variadic = static_cast<std::size_t>(array.n_buffers) - 3;
+            for (std::size_t i = 0; i < n_variadic; ++i)
+            {
+                add_buffer(buffers[2 + i], static_cast<std::size_t>(load<std::int64_t>(buffers[2 + n_variadic], i)));
+            }
+            m_variadic_counts.push_back(static_cast<std::int64_t>(n_variadic));
+        }
+        else if (format.starts_with("+w:"))
+        {
+            const auto list_size = static_cast<std::size_t>(parse_int(format.substr(3)));
+            const arrow_proxy& child = child_at(0);
+            append(child, child.offset() + offset * list_size, length * list_size);
+        }
+        else if (format == "+s")
+        {
+            for (const arrow_proxy& child : proxy.children())
+            {
+                append(child, child.offset() + offset, length);
+            }
+        }
+        else
+        {
+            throw ipc_error("Unsupported format: " + std::string(format));
+        }
+    }
+
+    fb_table_builder body_encoder::record_batch_table(std::int64_t length) const
+    {
+        fb_table_builder res;
+        res.add_scalar<std::int64_t>(record_batch_field::length, length);
+        res.add_vector(
+            record_batch_field::nodes,
+            {reinterpret_cast<const std::uint8_t*>(m_nodes.data()), m_nodes.size() * field_node_size},
+            m_nodes.size(),
+            8
+        );
+        res.add_vector(
+            record_batch_field::buffers,
+            {reinterpret_cast<const std::uint8_t*>(m_buffers.data()), m_buffers.size() * buffer_size},
+            m_buffers.size(),
+            8
+        );
+        if (!m_variadic_counts.empty())
+        {
+            res.add_vector<std::int64_t>(record_batch_field::variadic_buffer_counts, m_variadic_counts);
+        }
+        return res;
+    }
+
+    std::vector<std::uint8_t> body_encoder::record_batch_message(std::int64_t length) const
+    {
+        return make_message(message_type::record_batch, record_batch_table(length), m_body_size).finish();
+    }
+
+    std::vector<std::uint8_t> body_encoder::dictionary_batch_message(std::int64_t id, std::int64_t length) const
+    {
+        fb_table_builder dictionary;
+        dictionary.add_scalar<std::int64_t>(dictionary_batch_field::id, id);
+        dictionary.add_table(dictionary_batch_field::data, record_batch_table(length));
+        return make_message(message_type::dictionary_batch, std::move(dictionary), m_body_size).finish();
+    }
+
+    const std::vector<segment>& body_encoder::segments() const noexcept
+    {
+        return m_segments;
+    }
+
+    std::size_t body_encoder::body_size() const noexcept
+    {
+        return m_body_size;
+    }
+
+    std::array<std::uint8_t, 8> message_prefix(std::size_t metadata_size)
+    {
+        std::array<std::uint8_t, 8> res;
+        const auto size = static_cast<std::int32_t>(metadata_size);
+        std::memcpy(res.data(), &continuation_marker, sizeof(continuation_marker));
+        std::memcpy(res.data() + sizeof(continuation_marker), &size, sizeof(size));
+        return res;
+    }
+}
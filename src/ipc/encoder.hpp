@@ -0,0 +1,106 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/record_batch.hpp"
+
+#include "flatbuffer_builder.hpp"
+
+// Encoding of sparrow structures into Arrow IPC messages, shared by the
+// writers. Message bodies are described as a list of segments pointing to the
+// buffers of the arrays, so that they can be written without being copied.
+
+namespace sparrow::ipc::detail
+{
+    using segment = std::span<const std::uint8_t>;
+
+    /*
+     * Collects the dictionaries of a column, in the order of their ids.
+     */
+    void collect_dictionaries(const arrow_proxy& column, std::vector<const arrow_proxy*>& dictionaries);
+
+    /*
+     * Returns the Schema message of the given record batch. The ids of the
+     * dictionaries are their index in the result of collect_dictionaries
+     * called on each column in order.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> encode_schema_message(const record_batch& batch);
+
+    /*
+     * Builds the body of a RecordBatch or DictionaryBatch message, made of the
+     * buffers of the appended arrays, and its metadata.
+     */
+    class body_encoder
+    {
+    public:
+
+        // Appends an array and its children, in depth-first order
+        void append(const arrow_proxy& proxy);
+
+        [[nodiscard]] std::vector<std::uint8_t> record_batch_message(std::int64_t length) const;
+        [[nodiscard]] std::vector<std::uint8_t>
+        dictionary_batch_message(std::int64_t id, std::int64_t length) const;
+
+        // The segments of the body, each buffer is padded to 8 bytes
+        [[nodiscard]] const std::vector<segment>& segments() const noexcept;
+        [[nodiscard]] std::size_t body_size() const noexcept;
+
+    private:
+
+        struct buffer_location
+        {
+            std::int64_t offset;
+            std::int64_t length;
+        };
+
+        struct field_node
+        {
+            std::int64_t length;
+            std::int64_t null_count;
+        };
+
+        void append(const arrow_proxy& proxy, std::size_t offset, std::size_t length);
+        void add_buffer(const void* data, std::size_t size);
+        void add_bitmap(const void* bitmap, std::size_t offset, std::size_t length);
+        void add_validity(const arrow_proxy& proxy, std::size_t offset, std::size_t length);
+        [[nodiscard]] fb_table_builder record_batch_table(std::int64_t length) const;
+
+        std::vector<field_node> m_nodes;
+        std::vector<buffer_location> m_buffers;
+        std::vector<std::int64_t> m_variadic_counts;
+        std::vector<segment> m_segments;
+        // Buffers that cannot be written as is: bitmaps of slices that do not
+        // start on a byte boundary, boolean values, and binary views
+        std::vector<std::vector<std::uint8_t>> m_owned_buffers;
+        std::size_t m_body_size = 0;
+    };
+
+    /*
+     * Returns the 8-byte prefix of an encapsulated message whose flatbuffer
+     * has the given size.
+     */
+    [[nodiscard]] std::array<std::uint8_t, 8> message_prefix(std::size_t metadata_size);
+
+    // Padding and end-of-stream marker
+    inline constexpr std::array<std::uint8_t, 8> zero_bytes = {};
+    inline constexpr std::array<std::uint8_t, 8> end_of_stream = {0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0};
+}
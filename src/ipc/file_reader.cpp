@@ -0,0 +1,327 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/file_reader.hpp"
+
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "sparrow/buffer/memory_region.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+#include "metadata.hpp"
+
+namespace sparrow::ipc
+{
+    namespace
+    {
+        /*
+         * Private, copy-on-write mapping of a whole file.
+         */
+        class mapped_file : public memory_region
+        {
+        public:
+
+            explicit mapped_file(const std::filesystem::path& path);
+            ~mapped_file() override;
+        };
+
+#if defined(_WIN32)
+        mapped_file::mapped_file(const std::filesystem::path& path)
+        {
+            HANDLE file = ::CreateFileW(
+                path.c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL,
+                nullptr
+            );
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                throw ipc_error("Cannot open " + path.string());
+            }
+            LARGE_INTEGER size;
+            if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0)
+            {
+                ::CloseHandle(file);
+                throw ipc_error("Cannot map " + path.string() + ": empty or unreadable file");
+            }
+            HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            ::CloseHandle(file);
+            if (mapping == nullptr)
+            {
+                throw ipc_error("Cannot map " + path.string());
+            }
+            void* data = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            ::CloseHandle(mapping);
+            if (data == nullptr)
+            {
+                throw ipc_error("Cannot map " + path.string());
+            }
+            reset(static_cast<std::byte*>(data), static_cast<std::size_t>(size.QuadPart));
+        }
+
+        mapped_file::~mapped_file()
+        {
+            ::UnmapViewOfFile(data());
+        }
+#else
+        mapped_file::mapped_file(const std::filesystem::path& path)
+        {
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                throw ipc_error("Cannot open " + path.string() + ": " + std::strerror(errno));
+            }
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || st.st_size == 0)
+            {
+                ::close(fd);
+                throw ipc_error("Cannot map " + path.string() + ": empty or unreadable file");
+            }
+            const auto size = static_cast<std::size_t>(st.st_size);
+            // Private writable mapping: arrays adopting the memory can be modified
+            // in place without modifying the file.
+            void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (data == MAP_FAILED)
+            {
+                throw ipc_error("Cannot map " + path.string() + ": " + std::strerror(errno));
+            }
+            reset(static_cast<std::byte*>(data), size);
+        }
+
+        mapped_file::~mapped_file()
+        {
+            ::munmap(data(), size());
+        }
+#endif
+
+        struct block
+        {
+            std::int64_t offset;
+            std::int32_t metadata_length;
+            std::int64_t body_length;
+        };
+
+        [[nodiscard]] block read_block(const detail::fb_vector& blocks, std::size_t i)
+        {
+            constexpr std::size_t block_size = 24;
+            const std::uint8_t* s = blocks.inline_struct(i, block_size);
+            return {
+                detail::struct_field<std::int64_t>(s, 0),
+                detail::struct_field<std::int32_t>(s, 8),
+                detail::struct_field<std::int64_t>(s, 16)
+            };
+        }
+    }
+
+    struct file_reader::impl
+    {
+        // A message of the file and the location of its body
+        struct located_message
+        {
+            detail::message msg;
+            std::byte* body;
+            std::size_t body_size;
+        };
+
+        explicit impl(const std::filesystem::path& path);
+
+        [[nodiscard]] located_message read_message(const block& b) const;
+        [[nodiscard]] ArrowArray read_dictionary(std::int64_t id) const;
+
+        std::shared_ptr<mapped_file> m_file;
+        std::vector<detail::field_descriptor> m_fields;
+        std::vector<block> m_record_batches;
+        std::unordered_map<std::int64_t, const detail::field_descriptor*> m_dictionary_fields;
+        std::unordered_map<std::int64_t, located_message> m_dictionaries;
+        detail::dictionary_resolver m_resolver;
+    };
+
+    file_reader::impl::impl(const std::filesystem::path& path)
+        : m_file(std::make_shared<mapped_file>(path))
+        , m_resolver(
+              [this](std::int64_t id)
+              {
+                  return read_dictionary(id);
+              }
+          )
+    {
+        // Layout: magic, padding to 8 bytes, stream format, footer, footer size (int32), magic
+        const auto* data = reinterpret_cast<const std::uint8_t*>(m_file->data());
+        const std::size_t size = m_file->size();
+        const std::size_t magic_size = detail::file_magic.size();
+        const std::size_t trailer_size = sizeof(std::int32_t) + magic_size;
+        if (size < 8 + trailer_size
+            || std::memcmp(data, detail::file_magic.data(), magic_size) != 0
+            || std::memcmp(data + size - magic_size, detail::file_magic.data(), magic_size) != 0)
+        {
+            throw ipc_error("Not an Arrow IPC file");
+        }
+        const auto footer_size = detail::read_scalar<std::int32_t>(data, size, size - trailer_size);
+        if (footer_size <= 0 || static_cast<std::size_t>(footer_size) > size - trailer_size - 8)
+        {
+            throw ipc_error("Invalid footer size");
+        }
+        const std::size_t footer_pos = size - trailer_size - static_cast<std::size_t>(footer_size);
+        const auto footer = detail::fb_table::root(data + footer_pos, static_cast<std::size_t>(footer_size));
+
+        const auto version = footer.scalar<std::int16_t>(0, 0);
+        if (version < detail::metadata_version_v4)
+        {
+            throw ipc_error("Unsupported metadata version: " + std::to_string(version));
+        }
+        m_fields = detail::decode_schema(footer.table(1), version);
+        detail::collect_dictionary_fields(m_fields, m_dictionary_fields);
+
+        const detail::fb_vector dictionaries = footer.vector(2);
+        for (std::size_t i = 0; i < dictionaries.size(); ++i)
+        {
+            located_message dictionary = read_message(read_block(dictionaries, i));
+            if (dictionary.msg.type != detail::message_type::dictionary_batch)
+            {
+                throw ipc_error("Expected a dictionary batch");
+            }
+            if (dictionary.msg.header.scalar<std::uint8_t>(detail::dictionary_batch_field::is_delta, 0) != 0)
+            {
+                throw ipc_error("Delta dictionaries are not supported");
+            }
+            const auto id = dictionary.msg.header.scalar<std::int64_t>(detail::dictionary_batch_field::id, 0);
+            if (!m_dictionary_fields.contains(id))
+            {
+                throw ipc_error("Dictionary batch with unknown id " + std::to_string(id));
+            }
+            m_dictionaries.insert_or_assign(id, std::move(dictionary));
+        }
+
+        const detail::fb_vector record_batches = footer.vector(3);
+        m_record_batches.reserve(record_batches.size());
+        for (std::size_t i = 0; i < record_batches.size(); ++i)
+        {
+            m_record_batches.push_back(read_block(record_batches, i));
+        }
+    }
+
+    auto file_reader::impl::read_message(const block& b) const -> located_message
+    {
+        const auto* data = reinterpret_cast<const std::uint8_t*>(m_file->data());
+        const std::size_t size = m_file->size();
+        if (b.offset < 0 || b.metadata_length < 8 || b.body_length < 0
+            || static_cast<std::uint64_t>(b.offset) > size
+            || static_cast<std::uint64_t>(b.metadata_length) + static_cast<std::uint64_t>(b.body_length)
+                   > size - static_cast<std::size_t>(b.offset))
+        {
+            throw ipc_error("Invalid block");
+        }
+        const auto offset = static_cast<std::size_t>(b.offset);
+        const auto metadata_length = static_cast<std::size_t>(b.metadata_length);
+
+        // Encapsulated message: continuation marker (absent before format 0.15),
+        // size of the flatbuffer, flatbuffer, padding, body.
+        std::size_t fb_pos = offset + sizeof(std::uint32_t);
+        auto fb_size = detail::read_scalar<std::uint32_t>(data, size, offset);
+        if (fb_size == detail::continuation_marker)
+        {
+            fb_size = detail::read_scalar<std::uint32_t>(data, size, fb_pos);
+            fb_pos += sizeof(std::uint32_t);
+        }
+        if (fb_size > offset + metadata_length - fb_pos)
+        {
+            throw ipc_error("Invalid message size");
+        }
+        return {
+            detail::decode_message(data + fb_pos, fb_size),
+            m_file->data() + offset + metadata_length,
+            static_cast<std::size_t>(b.body_length)
+        };
+    }
+
+    ArrowArray file_reader::impl::read_dictionary(std::int64_t id) const
+    {
+        const auto it = m_dictionaries.find(id);
+        if (it == m_dictionaries.end())
+        {
+            throw ipc_error("Missing dictionary batch with id " + std::to_string(id));
+        }
+        const located_message& dictionary = it->second;
+        detail::batch_decoder decoder(
+            dictionary.msg.header.table(detail::dictionary_batch_field::data),
+            dictionary.body,
+            dictionary.body_size,
+            m_file,
+            m_resolver
+        );
+        return decoder.decode(*m_dictionary_fields.at(id));
+    }
+
+    file_reader::file_reader(const std::filesystem::path& path)
+        : p_impl(std::make_unique<impl>(path))
+    {
+    }
+
+    file_reader::~file_reader() = default;
+
+    file_reader::file_reader(file_reader&&) noexcept = default;
+    file_reader& file_reader::operator=(file_reader&&) noexcept = default;
+
+    std::size_t file_reader::num_record_batches() const noexcept
+    {
+        return p_impl->m_record_batches.size();
+    }
+
+    record_batch file_reader::read_record_batch(std::size_t index) const
+    {
+        SPARROW_ASSERT_TRUE(index < num_record_batches());
+        const impl::located_message batch = p_impl->read_message(p_impl->m_record_batches[index]);
+        if (batch.msg.type != detail::message_type::record_batch)
+        {
+            throw ipc_error("Expected a record batch");
+        }
+        return detail::decode_record_batch(
+            p_impl->m_fields,
+            batch.msg.header,
+            batch.body,
+            batch.body_size,
+            p_impl->m_file,
+            p_impl->m_resolver
+        );
+    }
+
+    std::vector<record_batch> file_reader::read_all() const
+    {
+        std::vector<record_batch> res;
+        res.reserve(num_record_batches());
+        for (std::size_t i = 0; i < num_record_batches(); ++i)
+        {
+            res.push_back(read_record_batch(i));
+        }
+        return res;
+    }
+}
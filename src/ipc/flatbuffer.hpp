@@ -0,0 +1,263 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "sparrow/ipc/ipc_error.hpp"
+
+// Minimal reader for the flatbuffers wire format, covering what the Arrow IPC
+// metadata (Schema.fbs, Message.fbs, File.fbs) needs:
+// https://flatbuffers.dev/internals/
+// Every access is bounds-checked and throws ipc_error on malformed input. The
+// format is little-endian, as are all the platforms sparrow supports.
+
+namespace sparrow::ipc::detail
+{
+    class fb_vector;
+
+    /*
+     * Reads a little-endian scalar at \c pos in [data, data + size).
+     */
+    template <class T>
+    [[nodiscard]] T read_scalar(const std::uint8_t* data, std::size_t size, std::size_t pos)
+    {
+        if (pos > size || size - pos < sizeof(T))
+        {
+            throw ipc_error("Invalid flatbuffer: out of bounds access");
+        }
+        T res;
+        std::memcpy(&res, data + pos, sizeof(T));
+        return res;
+    }
+
+    /*
+     * Reads the uoffset_t at \c pos and returns the position it points to.
+     */
+    [[nodiscard]] inline std::size_t
+    read_offset(const std::uint8_t* data, std::size_t size, std::size_t pos)
+    {
+        const auto offset = read_scalar<std::uint32_t>(data, size, pos);
+        const std::size_t target = pos + offset;
+        if (target >= size)
+        {
+            throw ipc_error("Invalid flatbuffer: offset out of bounds");
+        }
+        return target;
+    }
+
+    class fb_table
+    {
+    public:
+
+        fb_table() = default;
+
+        fb_table(const std::uint8_t* data, std::size_t size, std::size_t pos)
+            : p_data(data)
+            , m_size(size)
+            , m_pos(pos)
+        {
+            const auto vtable_offset = read_scalar<std::int32_t>(data, size, pos);
+            const auto vtable_pos = static_cast<std::int64_t>(pos) - vtable_offset;
+            if (vtable_pos < 0 || static_cast<std::size_t>(vtable_pos) >= size)
+            {
+                throw ipc_error("Invalid flatbuffer: vtable out of bounds");
+            }
+            m_vtable = static_cast<std::size_t>(vtable_pos);
+            m_vtable_size = read_scalar<std::uint16_t>(data, size, m_vtable);
+        }
+
+        /*
+         * Returns the root table of the flatbuffer in [data, data + size).
+         */
+        [[nodiscard]] static fb_table root(const std::uint8_t* data, std::size_t size)
+        {
+            return fb_table(data, size, read_offset(data, size, 0));
+        }
+
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return p_data != nullptr;
+        }
+
+        [[nodiscard]] bool has_field(std::size_t id) const
+        {
+            return field_pos(id) != 0;
+        }
+
+        template <class T>
+        [[nodiscard]] T scalar(std::size_t id, T default_value) const
+        {
+            const std::size_t pos = field_pos(id);
+            return pos == 0 ? default_value : read_scalar<T>(p_data, m_size, pos);
+        }
+
+        [[nodiscard]] fb_table table(std::size_t id) const
+        {
+            const std::size_t pos = field_pos(id);
+            return pos == 0 ? fb_table() : fb_table(p_data, m_size, read_offset(p_data, m_size, pos));
+        }
+
+        [[nodiscard]] std::string_view string(std::size_t id) const;
+        [[nodiscard]] fb_vector vector(std::size_t id) const;
+
+        /*
+         * Returns a pointer to an inline struct field, or nullptr if the field
+         * is absent.
+         */
+        [[nodiscard]] const std::uint8_t* inline_struct(std::size_t id, std::size_t struct_size) const
+        {
+            const std::size_t pos = field_pos(id);
+            if (pos == 0)
+            {
+                return nullptr;
+            }
+            if (pos + struct_size > m_size)
+            {
+                throw ipc_error("Invalid flatbuffer: struct out of bounds");
+            }
+            return p_data + pos;
+        }
+
+    private:
+
+        [[nodiscard]] std::size_t field_pos(std::size_t id) const
+        {
+            const std::size_t entry = 4 + 2 * id;
+            if (p_data == nullptr || entry + 2 > m_vtable_size)
+            {
+                return 0;
+            }
+            const auto offset = read_scalar<std::uint16_t>(p_data, m_size, m_vtable + entry);
+            return offset == 0 ? 0 : m_pos + offset;
+        }
+
+        const std::uint8_t* p_data = nullptr;
+        std::size_t m_size = 0;
+        std::size_t m_pos = 0;
+        std::size_t m_vtable = 0;
+        std::size_t m_vtable_size = 0;
+    };
+
+    class fb_vector
+    {
+    public:
+
+        fb_vector() = default;
+
+        fb_vector(const std::uint8_t* data, std::size_t size, std::size_t pos)
+            : p_data(data)
+            , m_size(size)
+            , m_pos(pos + sizeof(std::uint32_t))
+            , m_length(read_scalar<std::uint32_t>(data, size, pos))
+        {
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_length;
+        }
+
+        template <class T>
+        [[nodiscard]] T scalar(std::size_t i) const
+        {
+            check_index(i);
+            return read_scalar<T>(p_data, m_size, m_pos + i * sizeof(T));
+        }
+
+        [[nodiscard]] fb_table table(std::size_t i) const
+        {
+            check_index(i);
+            const std::size_t pos = m_pos + i * sizeof(std::uint32_t);
+            return fb_table(p_data, m_size, read_offset(p_data, m_size, pos));
+        }
+
+        [[nodiscard]] std::string_view string(std::size_t i) const;
+
+        /*
+         * Returns a pointer to the i-th element of a vector of structs.
+         */
+        [[nodiscard]] const std::uint8_t* inline_struct(std::size_t i, std::size_t struct_size) const
+        {
+            check_index(i);
+            const std::size_t pos = m_pos + i * struct_size;
+            if (pos + struct_size > m_size)
+            {
+                throw ipc_error("Invalid flatbuffer: struct out of bounds");
+            }
+            return p_data + pos;
+        }
+
+    private:
+
+        void check_index(std::size_t i) const
+        {
+            if (i >= m_length)
+            {
+                throw ipc_error("Invalid flatbuffer: vector index out of bounds");
+            }
+        }
+
+        const std::uint8_t* p_data = nullptr;
+        std::size_t m_size = 0;
+        std::size_t m_pos = 0;
+        std::size_t m_length = 0;
+    };
+
+    [[nodiscard]] inline std::string_view
+    read_string(const std::uint8_t* data, std::size_t size, std::size_t pos)
+    {
+        const auto length = read_scalar<std::uint32_t>(data, size, pos);
+        const std::size_t begin = pos + sizeof(std::uint32_t);
+        if (length > size - begin)
+        {
+            throw ipc_error("Invalid flatbuffer: string out of bounds");
+        }
+        return {reinterpret_cast<const char*>(data + begin), length};
+    }
+
+    inline std::string_view fb_table::string(std::size_t id) const
+    {
+        const std::size_t pos = field_pos(id);
+        return pos == 0 ? std::string_view() : read_string(p_data, m_size, read_offset(p_data, m_size, pos));
+    }
+
+    inline fb_vector fb_table::vector(std::size_t id) const
+    {
+        const std::size_t pos = field_pos(id);
+        return pos == 0 ? fb_vector() : fb_vector(p_data, m_size, read_offset(p_data, m_size, pos));
+    }
+
+    inline std::string_view fb_vector::string(std::size_t i) const
+    {
+        check_index(i);
+        const std::size_t pos = m_pos + i * sizeof(std::uint32_t);
+        return read_string(p_data, m_size, read_offset(p_data, m_size, pos));
+    }
+
+    /*
+     * Reads a little-endian scalar from an inline struct, at byte offset \c pos.
+     */
+    template <class T>
+    [[nodiscard]] T struct_field(const std::uint8_t* s, std::size_t pos)
+    {
+        T res;
+        std::memcpy(&res, s + pos, sizeof(T));
+        return res;
+    }
+}
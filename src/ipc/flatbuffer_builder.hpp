@@ -0,0 +1,277 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Minimal writer for the flatbuffers wire format, the counterpart of
+// flatbuffer.hpp. Tables are described as a tree and serialized front to
+// back: a table is written before the objects it refers to, so that all the
+// uoffset_t are positive as required by the format. Scalars are aligned on
+// their size relative to the start of the buffer, which must therefore be
+// written at an 8-byte aligned position.
+
+namespace sparrow::ipc::detail
+{
+    class fb_table_builder
+    {
+    public:
+
+        template <class T>
+            requires std::is_arithmetic_v<T>
+        fb_table_builder& add_scalar(std::size_t id, T value)
+        {
+            field& f = add_field(id, field_kind::scalar, sizeof(T));
+            std::memcpy(f.scalar, &value, sizeof(T));
+            return *this;
+        }
+
+        fb_table_builder& add_table(std::size_t id, fb_table_builder table)
+        {
+            add_field(id, field_kind::table, sizeof(std::uint32_t)).tables.push_back(std::move(table));
+            return *this;
+        }
+
+        fb_table_builder& add_string(std::size_t id, std::string_view s)
+        {
+            add_field(id, field_kind::string, sizeof(std::uint32_t)).bytes.assign(s.begin(), s.end());
+            return *this;
+        }
+
+        fb_table_builder& add_tables(std::size_t id, std::vector<fb_table_builder> tables)
+        {
+            add_field(id, field_kind::table_vector, sizeof(std::uint32_t)).tables = std::move(tables);
+            return *this;
+        }
+
+        /*
+         * Adds a vector of scalars or of structs, whose elements are aligned on
+         * \c alignment bytes.
+         */
+        fb_table_builder&
+        add_vector(std::size_t id, std::span<const std::uint8_t> bytes, std::size_t count, std::size_t alignment)
+        {
+            field& f = add_field(id, field_kind::vector, sizeof(std::uint32_t));
+            f.bytes.assign(bytes.begin(), bytes.end());
+            f.count = count;
+            f.alignment = alignment;
+            return *this;
+        }
+
+        template <class T>
+            requires std::is_arithmetic_v<T>
+        fb_table_builder& add_vector(std::size_t id, std::span<const T> values)
+        {
+            return add_vector(
+                id,
+                {reinterpret_cast<const std::uint8_t*>(values.data()), values.size_bytes()},
+                values.size(),
+                sizeof(T)
+            );
+        }
+
+        /*
+         * Serializes the table as the root of a flatbuffer. The result is
+         * padded to a multiple of 8 bytes.
+         */
+        [[nodiscard]] std::vector<std::uint8_t> finish() const
+        {
+            std::vector<std::uint8_t> out(sizeof(std::uint32_t), 0);
+            const std::size_t pos = write(out);
+            patch_offset(out, 0, pos);
+            pad(out, 8);
+            return out;
+        }
+
+    private:
+
+        enum class field_kind
+        {
+            scalar,
+            table,
+            string,
+            table_vector,
+            vector
+        };
+
+        struct field
+        {
+            std::size_t id = 0;
+            field_kind kind = field_kind::scalar;
+            std::size_t size = 0;
+            std::uint8_t scalar[8] = {};
+            std::vector<std::uint8_t> bytes;
+            std::vector<fb_table_builder> tables;
+            std::size_t count = 0;
+            std::size_t alignment = 1;
+        };
+
+        field& add_field(std::size_t id, field_kind kind, std::size_t size)
+        {
+            field& f = m_fields.emplace_back();
+            f.id = id;
+            f.kind = kind;
+            f.size = size;
+            return f;
+        }
+
+        static void pad(std::vector<std::uint8_t>& out, std::size_t alignment)
+        {
+            out.resize((out.size() + alignment - 1) / alignment * alignment, 0);
+        }
+
+        template <class T>
+        static void put(std::vector<std::uint8_t>& out, std::size_t pos, T value)
+        {
+            std::memcpy(out.data() + pos, &value, sizeof(T));
+        }
+
+        static void patch_offset(std::vector<std::uint8_t>& out, std::size_t at, std::size_t target)
+        {
+            put(out, at, static_cast<std::uint32_t>(target - at));
+        }
+
+        static std::size_t write_string(std::vector<std::uint8_t>& out, const std::vector<std::uint8_t>& s)
+        {
+            pad(out, 4);
+            const std::size_t pos = out.size();
+            out.resize(pos + sizeof(std::uint32_t));
+            put(out, pos, static_cast<std::uint32_t>(s.size()));
+            out.insert(out.end(), s.begin(), s.end());
+            out.push_back(0);
+            return pos;
+        }
+
+        static std::size_t write_vector(std::vector<std::uint8_t>& out, const field& f)
+        {
+            // The length prefix is 4-byte aligned and immediately precedes the
+            // elements, which must be aligned on their own alignment.
+            const std::size_t alignment = std::max<std::size_t>(f.alignment, 4);
+            pad(out, 4);
+            while ((out.size() + sizeof(std::uint32_t)) % alignment != 0)
+            {
+                out.resize(out.size() + 4, 0);
+            }
+            const std::size_t pos = out.size();
+            out.resize(pos + sizeof(std::uint32_t));
+            put(out, pos, static_cast<std::uint32_t>(f.count));
+            out.insert(out.end(), f.bytes.begin(), f.bytes.end());
+            return pos;
+        }
+
+        static std::size_t write_table_vector(std::vector<std::uint8_t>& out, const std::vector<fb_table_builder>& tables)
+        {
+            pad(out, 4);
+            const std::size_t pos = out.size();
+            out.resize(pos + sizeof(std::uint32_t) * (tables.size() + 1), 0);
+            put(out, pos, static_cast<std::uint32_t>(tables.size()));
+            for (std::size_t i = 0; i < tables.size(); ++i)
+            {
+                const std::size_t at = pos + sizeof(std::uint32_t) * (i + 1);
+                const std::size_t target = tables[i].write(out);
+                patch_offset(out, at, target);
+            }
+            return pos;
+        }
+
+        std::size_t write(std::vector<std::uint8_t>& out) const
+        {
+            std::size_t n_slots = 0;
+            for (const field& f : m_fields)
+            {
+                n_slots = std::max(n_slots, f.id + 1);
+            }
+
+            // vtable: its size, the size of the table, and one offset per field
+            pad(out, 2);
+            const std::size_t vtable_pos = out.size();
+            const std::size_t vtable_size = sizeof(std::uint16_t) * (2 + n_slots);
+            out.resize(vtable_pos + vtable_size, 0);
+
+            pad(out, 4);
+            const std::size_t table_pos = out.size();
+            out.resize(table_pos + sizeof(std::int32_t));
+            put(out, table_pos, static_cast<std::int32_t>(table_pos - vtable_pos));
+
+            // Largest fields first to limit the padding
+            std::vector<const field*> sorted;
+            sorted.reserve(m_fields.size());
+            for (const field& f : m_fields)
+            {
+                sorted.push_back(&f);
+            }
+            std::ranges::stable_sort(
+                sorted,
+                [](const field* lhs, const field* rhs)
+                {
+                    return lhs->size > rhs->size;
+                }
+            );
+
+            std::vector<std::pair<const field*, std::size_t>> deferred;
+            for (const field* f : sorted)
+            {
+                pad(out, f->size);
+                const std::size_t pos = out.size();
+                out.resize(pos + f->size, 0);
+                if (f->kind == field_kind::scalar)
+                {
+                    std::memcpy(out.data() + pos, f->scalar, f->size);
+                }
+                else
+                {
+                    deferred.emplace_back(f, pos);
+                }
+                put(out, vtable_pos + sizeof(std::uint16_t) * (2 + f->id), static_cast<std::uint16_t>(pos - table_pos));
+            }
+            put(out, vtable_pos, static_cast<std::uint16_t>(vtable_size));
+            put(out, vtable_pos + sizeof(std::uint16_t), static_cast<std::uint16_t>(out.size() - table_pos));
+
+            for (const auto& [f, at] : deferred)
+            {
+                std::size_t target = 0;
+                switch (f->kind)
+                {
+                    case field_kind::table:
+                        target = f->tables.front().write(out);
+                        break;
+                    case field_kind::string:
+                        target = write_string(out, f->bytes);
+                        break;
+                    case field_kind::table_vector:
+                        target = write_table_vector(out, f->tables);
+                        break;
+                    case field_kind::vector:
+                        target = write_vector(out, *f);
+                        break;
+                    case field_kind::scalar:
+                        break;
+                }
+                patch_offset(out, at, target);
+            }
+            return table_pos;
+        }
+
+        std::vector<field> m_fields;
+    };
+}
@@ -0,0 +1,166 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#    include <fcntl.h>
+#    include <io.h>
+#    include <sys/stat.h>
+#else
+#    include <fcntl.h>
+#    include <limits.h>
+#    include <sys/uio.h>
+#    include <unistd.h>
+#endif
+
+#include "sparrow/ipc/ipc_error.hpp"
+
+namespace sparrow::ipc::detail
+{
+    namespace
+    {
+        [[noreturn]] void throw_io_error(const std::string& what)
+        {
+            throw ipc_error(what + ": " + std::strerror(errno));
+        }
+    }
+
+#if defined(_WIN32)
+    int open_file(const std::filesystem::path& path, open_mode mode)
+    {
+        int fd = -1;
+        const int flags = mode == open_mode::read ? _O_RDONLY | _O_BINARY
+                                                  : _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY;
+        if (::_wsopen_s(&fd, path.c_str(), flags, _SH_DENYWR, _S_IREAD | _S_IWRITE) != 0)
+        {
+            throw_io_error("Cannot open " + path.string());
+        }
+        return fd;
+    }
+
+    void close_file(int fd) noexcept
+    {
+        ::_close(fd);
+    }
+
+    std::size_t read_some(int fd, std::span<std::uint8_t> dest)
+    {
+        const auto n = std::min<std::size_t>(dest.size(), 1u << 30);
+        const int res = ::_read(fd, dest.data(), static_cast<unsigned int>(n));
+        if (res < 0)
+        {
+            throw_io_error("Read failed");
+        }
+        return static_cast<std::size_t>(res);
+    }
+
+    void write_all(int fd, std::span<const std::span<const std::uint8_t>> segments)
+    {
+        // No gather write for CRT file descriptors
+        for (const auto& s : segments)
+        {
+            std::size_t done = 0;
+            while (done < s.size())
+            {
+                const auto n = std::min<std::size_t>(s.size() - done, 1u << 30);
+                const int written = ::_write(fd, s.data() + done, static_cast<unsigned int>(n));
+                if (written < 0)
+                {
+                    throw_io_error("Write failed");
+                }
+                done += static_cast<std::size_t>(written);
+            }
+        }
+    }
+#else
+    int open_file(const std::filesystem::path& path, open_mode mode)
+    {
+        const int flags = mode == open_mode::read ? O_RDONLY : O_WRONLY | O_CREAT | O_TRUNC;
+        const int fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if (fd < 0)
+        {
+            throw_io_error("Cannot open " + path.string());
+        }
+        return fd;
+    }
+
+    void close_file(int fd) noexcept
+    {
+        ::close(fd);
+    }
+
+    std::size_t read_some(int fd, std::span<std::uint8_t> dest)
+    {
+        while (true)
+        {
+            const ssize_t res = ::read(fd, dest.data(), dest.size());
+            if (res >= 0)
+            {
+                return static_cast<std::size_t>(res);
+            }
+            if (errno != EINTR)
+            {
+                throw_io_error("Read failed");
+            }
+        }
+    }
+
+    void write_all(int fd, std::span<const std::span<const std::uint8_t>> segments)
+    {
+#    if defined(IOV_MAX)
+        constexpr std::size_t max_iov = IOV_MAX;
+#    else
+        constexpr std::size_t max_iov = 1024;
+#    endif
+        std::vector<iovec> iov;
+        iov.reserve(std::min(segments.size(), max_iov));
+        std::size_t first = 0;
+        // Offset in the first segment, after a partial write
+        std::size_t skip = 0;
+        while (first < segments.size())
+        {
+            iov.clear();
+            for (std::size_t i = first; i < segments.size() && iov.size() < max_iov; ++i)
+            {
+                const std::size_t start = i == first ? skip : 0;
+                iov.push_back({const_cast<std::uint8_t*>(segments[i].data()) + start, segments[i].size() - start});
+            }
+            const ssize_t written = ::writev(fd, iov.data(), static_cast<int>(iov.size()));
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw_io_error("Write failed");
+            }
+            auto remaining = static_cast<std::size_t>(written);
+            while (first < segments.size() && remaining >= segments[first].size() - skip)
+            {
+                remaining -= segments[first].size() - skip;
+                skip = 0;
+                ++first;
+            }
+            skip += remaining;
+        }
+    }
+#endif
+}
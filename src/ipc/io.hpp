@@ -0,0 +1,47 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+// Thin wrappers over the file descriptor API of the platform, throwing
+// ipc_error on failure.
+
+namespace sparrow::ipc::detail
+{
+    enum class open_mode
+    {
+        read,
+        write
+    };
+
+    [[nodiscard]] int open_file(const std::filesystem::path& path, open_mode mode);
+
+    void close_file(int fd) noexcept;
+
+    /*
+     * Reads at most dest.size() bytes, returns the number of bytes read, 0 at
+     * the end of the file.
+     */
+    [[nodiscard]] std::size_t read_some(int fd, std::span<std::uint8_t> dest);
+
+    /*
+     * Writes all the segments in order, with as few system calls as possible.
+     */
+    void write_all(int fd, std::span<const std::span<const std::uint8_t>> segments);
+}
@@ -0,0 +1,998 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "metadata.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/layout/fixed_width_binary_layout/fixed_width_binary_array_utils.hpp"
+#include "sparrow/types/data_type.hpp"
+#include "sparrow/utils/repeat_container.hpp"
+
+namespace sparrow::ipc::detail
+{
+    namespace
+    {
+        [[nodiscard]] char time_unit_char(std::int16_t unit)
+        {
+            switch (unit)
+            {
+                case 0:
+                    return 's';
+                case 1:
+                    return 'm';
+                case 2:
+                    return 'u';
+                case 3:
+                    return 'n';
+                default:
+                    throw ipc_error("Invalid time unit: " + std::to_string(unit));
+            }
+        }
+
+        [[nodiscard]] std::string_view int_format(std::int32_t bit_width, bool is_signed)
+        {
+            switch (bit_width)
+            {
+                case 8:
+                    return is_signed ? "c" : "C";
+                case 16:
+                    return is_signed ? "s" : "S";
+                case 32:
+                    return is_signed ? "i" : "I";
+                case 64:
+                    return is_signed ? "l" : "L";
+                default:
+                    throw ipc_error("Invalid integer bit width: " + std::to_string(bit_width));
+            }
+        }
+
+        [[nodiscard]] std::string int_format(const fb_table& int_type)
+        {
+            return std::string(int_format(int_type.scalar<std::int32_t>(0, 0), int_type.scalar<std::uint8_t>(1, 0) != 0));
+        }
+
+        /*
+         * Binary encoding of the metadata specified by the C data interface:
+         * https://arrow.apache.org/docs/format/CDataInterface.html#c.ArrowSchema.metadata
+         */
+        [[nodiscard]] std::optional<std::string> encode_metadata(const fb_vector& key_values)
+        {
+            if (key_values.size() == 0)
+            {
+                return std::nullopt;
+            }
+            std::string res;
+            auto append_int32 = [&res](std::size_t value)
+            {
+                const auto v = static_cast<std::int32_t>(value);
+                res.append(reinterpret_cast<const char*>(&v), sizeof(v));
+            };
+            append_int32(key_values.size());
+            for (std::size_t i = 0; i < key_values.size(); ++i)
+            {
+                const fb_table kv = key_values.table(i);
+                for (const std::string_view s : {kv.string(key_value_field::key), kv.string(key_value_field::value)})
+                {
+                    append_int32(s.size());
+                    res.append(s);
+                }
+            }
+            return res;
+        }
+
+        /*
+         * Sets the format and the buffer layout of a field from its Type.
+         */
+        void set_type(field_descriptor& res, type_id id, const fb_table& type, std::int16_t version)
+        {
+            res.n_buffers = 2;
+            switch (id)
+            {
+                case type_id::null:
+                    res.format = "n";
+                    res.n_buffers = 0;
+                    break;
+                case type_id::int_:
+                    res.format = int_format(type);
+                    break;
+                case type_id::floating_point:
+                    switch (type.scalar<std::int16_t>(0, 0))
+                    {
+                        case 0:
+                            res.format = "e";
+                            break;
+                        case 1:
+                            res.format = "f";
+                            break;
+                        case 2:
+                            res.format = "g";
+                            break;
+                        default:
+                            throw ipc_error("Invalid floating point precision");
+                    }
+                    break;
+                case type_id::binary:
+                    res.format = "z";
+                    res.n_buffers = 3;
+                    break;
+                case type_id::utf8:
+                    res.format = "u";
+                    res.n_buffers = 3;
+                    break;
+                case type_id::large_binary:
+                    res.format = "Z";
+                    res.n_buffers = 3;
+                    break;
+                case type_id::large_utf8:
+                    res.format = "U";
+                    res.n_buffers = 3;
+                    break;
+                case type_id::binary_view:
+                    res.format = "vz";
+                    res.has_variadic_buffers = true;
+                    break;
+                case type_id::utf8_view:
+                    res.format = "vu";
+                    res.has_variadic_buffers = true;
+                    break;
+                case type_id::bool_:
+                    res.format = "b";
+                    break;
+                case type_id::decimal:
+                {
+                    const auto bit_width = type.scalar<std::int32_t>(2, 128);
+                    res.format = "d:" + std::to_string(type.scalar<std::int32_t>(0, 0)) + ","
+                                 + std::to_string(type.scalar<std::int32_t>(1, 0));
+                    if (bit_width != 128)
+                    {
+                        res.format += "," + std::to_string(bit_width);
+                    }
+                    break;
+                }
+                case type_id::date:
+                    res.format = type.scalar<std::int16_t>(0, 1) == 0 ? "tdD" : "tdm";
+                    break;
+                case type_id::time:
+                    res.format = std::string("tt") + time_unit_char(type.scalar<std::int16_t>(0, 1));
+                    break;
+                case type_id::timestamp:
+                    res.format = std::string("ts") + time_unit_char(type.scalar<std::int16_t>(0, 0)) + ":";
+                    res.format += type.string(1);
+                    break;
+                case type_id::duration:
+                    res.format = std::string("tD") + time_unit_char(type.scalar<std::int16_t>(0, 1));
+                    break;
+                case type_id::interval:
+                    switch (type.scalar<std::int16_t>(0, 0))
+                    {
+                        case 0:
+                            res.format = "tiM";
+                            break;
+                        case 1:
+                            res.format = "tiD";
+                            break;
+                        case 2:
+                            res.format = "tin";
+                            break;
+                        default:
+                            throw ipc_error("Invalid interval unit");
+                    }
+                    break;
+                case type_id::fixed_size_binary:
+                    res.format = "w:" + std::to_string(type.scalar<std::int32_t>(0, 0));
+                    break;
+                case type_id::list:
+                    res.format = "+l";
+                    break;
+                case type_id::large_list:
+                    res.format = "+L";
+                    break;
+                case type_id::list_view:
+                    res.format = "+vl";
+                    res.n_buffers = 3;
+                    break;
+                case type_id::large_list_view:
+                    res.format = "+vL";
+                    res.n_buffers = 3;
+                    break;
+                case type_id::fixed_size_list:
+                    res.format = "+w:" + std::to_string(type.scalar<std::int32_t>(0, 0));
+                    res.n_buffers = 1;
+                    break;
+                case type_id::struct_:
+                    res.format = "+s";
+                    res.n_buffers = 1;
+                    break;
+                case type_id::map:
+                    res.format = "+m";
+                    if (type.scalar<std::uint8_t>(0, 0) != 0)
+                    {
+                        res.flags |= static_cast<std::int64_t>(ArrowFlag::MAP_KEYS_SORTED);
+                    }
+                    break;
+                case type_id::union_:
+                {
+                    if (version < metadata_version_v5)
+                    {
+                        throw ipc_error("Union arrays require metadata version V5");
+                    }
+                    const bool dense = type.scalar<std::int16_t>(0, 0) == 1;
+                    res.format = dense ? "+ud:" : "+us:";
+                    res.n_buffers = dense ? 2 : 1;
+                    const fb_vector type_ids = type.vector(1);
+                    const std::size_t n = type_ids.size() == 0 ? res.children.size() : type_ids.size();
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        if (i != 0)
+                        {
+                            res.format += ",";
+                        }
+                        res.format += std::to_string(type_ids.size() == 0 ? static_cast<std::int32_t>(i) : type_ids.scalar<std::int32_t>(i));
+                    }
+                    break;
+                }
+                case type_id::run_end_encoded:
+                    res.format = "+r";
+                    res.n_buffers = 0;
+                    break;
+                default:
+                    throw ipc_error("Unsupported field type: " + std::to_string(static_cast<int>(id)));
+            }
+        }
+
+        [[nodiscard]] field_descriptor decode_field(const fb_table& fb_field, std::int16_t version)
+        {
+            field_descriptor res;
+            res.name = fb_field.string(field::name);
+            res.metadata = encode_metadata(fb_field.vector(field::custom_metadata));
+            const bool nullable = fb_field.scalar<std::uint8_t>(field::nullable, 0) != 0;
+            if (nullable)
+            {
+                res.flags |= static_cast<std::int64_t>(ArrowFlag::NULLABLE);
+            }
+
+            const fb_vector children = fb_field.vector(field::children);
+            res.children.reserve(children.size());
+            for (std::size_t i = 0; i < children.size(); ++i)
+            {
+                res.children.push_back(decode_field(children.table(i), version));
+            }
+            const auto id = static_cast<type_id>(fb_field.scalar<std::uint8_t>(field::type_type, 0));
+            set_type(res, id, fb_field.table(field::type), version);
+
+            const fb_table dictionary = fb_field.table(field::dictionary);
+            if (dictionary.valid())
+            {
+                // The field describes the values of the dictionary, and the
+                // ArrowSchema of the field describes the indices.
+                auto values = std::make_shared<field_descriptor>(std::move(res));
+                values->name.clear();
+                values->metadata.reset();
+                values->flags |= static_cast<std::int64_t>(ArrowFlag::NULLABLE);
+
+                res = field_descriptor();
+                res.name = fb_field.string(field::name);
+                res.metadata = encode_metadata(fb_field.vector(field::custom_metadata));
+                res.flags = nullable ? static_cast<std::int64_t>(ArrowFlag::NULLABLE) : 0;
+                if (dictionary.scalar<std::uint8_t>(dictionary_encoding_field::is_ordered, 0) != 0)
+                {
+                    res.flags |= static_cast<std::int64_t>(ArrowFlag::DICTIONARY_ORDERED);
+                }
+                const fb_table index_type = dictionary.table(dictionary_encoding_field::index_type);
+                res.format = index_type.valid() ? int_format(index_type) : "i";
+                res.n_buffers = 2;
+                res.dictionary_id = dictionary.scalar<std::int64_t>(dictionary_encoding_field::id, 0);
+                res.dictionary = std::move(values);
+            }
+            return res;
+        }
+
+        [[nodiscard]] buffer<std::uint8_t> unpack_bits(const buffer<std::uint8_t>& bits, std::size_t length)
+        {
+            if (bits.size() * 8 < length)
+            {
+                throw ipc_error("Invalid buffer: too small for the boolean values");
+            }
+            buffer<std::uint8_t> res(length);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                res[i] = static_cast<std::uint8_t>((bits[i / 8] >> (i % 8)) & 1u);
+            }
+            return res;
+        }
+
+        /*
+         * Validation of the decoded buffers: the buffers and the children of an
+         * array must hold its length elements, and its offsets, views, run ends
+         * and dictionary keys must stay within its values, so that a malformed
+         * message cannot make the array read out of bounds.
+         */
+
+        template <class T>
+        [[nodiscard]] T read_at(const buffer<std::uint8_t>& buf, std::size_t index)
+        {
+            T res;
+            std::memcpy(&res, buf.data() + index * sizeof(T), sizeof(T));
+            return res;
+        }
+
+        [[nodiscard]] bool holds(std::size_t size, std::size_t count, std::size_t value_size)
+        {
+            return size / value_size >= count;
+        }
+
+        // Size in bytes of the values of the fixed-width layouts, 0 for the other ones
+        [[nodiscard]] std::size_t fixed_width_size(data_type dt, std::string_view format)
+        {
+            switch (dt)
+            {
+                case data_type::UINT8:
+                case data_type::INT8:
+                    return 1;
+                case data_type::UINT16:
+                case data_type::INT16:
+                case data_type::HALF_FLOAT:
+                    return 2;
+                case data_type::UINT32:
+                case data_type::INT32:
+                case data_type::FLOAT:
+                case data_type::DATE_DAYS:
+                case data_type::TIME_SECONDS:
+                case data_type::TIME_MILLISECONDS:
+                case data_type::INTERVAL_MONTHS:
+                case data_type::DECIMAL32:
+                    return 4;
+                case data_type::UINT64:
+                case data_type::INT64:
+                case data_type::DOUBLE:
+                case data_type::DATE_MILLISECONDS:
+                case data_type::TIMESTAMP_SECONDS:
+                case data_type::TIMESTAMP_MILLISECONDS:
+                case data_type::TIMESTAMP_MICROSECONDS:
+                case data_type::TIMESTAMP_NANOSECONDS:
+                case data_type::TIME_MICROSECONDS:
+                case data_type::TIME_NANOSECONDS:
+                case data_type::DURATION_SECONDS:
+                case data_type::DURATION_MILLISECONDS:
+                case data_type::DURATION_MICROSECONDS:
+                case data_type::DURATION_NANOSECONDS:
+                case data_type::INTERVAL_DAYS_TIME:
+                case data_type::DECIMAL64:
+                    return 8;
+                case data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS:
+                case data_type::DECIMAL128:
+                    return 16;
+                case data_type::DECIMAL256:
+                    return 32;
+                case data_type::FIXED_WIDTH_BINARY:
+                    return num_bytes_for_fixed_sized_binary(format);
+                default:
+                    return 0;
+            }
+        }
+
+        // The offsets must not decrease, and must stay within [0, end]
+        template <class O>
+        void check_offsets(const buffer<std::uint8_t>& offsets, std::size_t length, std::size_t end)
+        {
+            // Writers may omit the offsets of empty arrays
+            if (length == 0 && offsets.empty())
+            {
+                return;
+            }
+            if (!holds(offsets.size(), length + 1, sizeof(O)))
+            {
+                throw ipc_error("Invalid buffer: too small for the offsets");
+            }
+            O previous = read_at<O>(offsets, 0);
+            if (previous < 0)
+            {
+                throw ipc_error("Invalid offsets: negative offset");
+            }
+            for (std::size_t i = 1; i <= length; ++i)
+            {
+                const O current = read_at<O>(offsets, i);
+                if (current < previous)
+                {
+                    throw ipc_error("Invalid offsets: decreasing offsets");
+                }
+                previous = current;
+            }
+            if (std::cmp_greater(previous, end))
+            {
+                throw ipc_error("Invalid offsets: out of the values");
+            }
+        }
+
+        template <class O>
+        void check_list_views(
+            const buffer<std::uint8_t>& offsets,
+            const buffer<std::uint8_t>& sizes,
+            std::size_t length,
+            std::size_t end
+        )
+        {
+            if (!holds(offsets.size(), length, sizeof(O)) || !holds(sizes.size(), length, sizeof(O)))
+            {
+                throw ipc_error("Invalid buffer: too small for the list views");
+            }
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const O offset = read_at<O>(offsets, i);
+                const O size = read_at<O>(sizes, i);
+                if (offset < 0 || size < 0 || std::cmp_greater(offset, end)
+                    || std::cmp_greater(size, end - static_cast<std::size_t>(offset)))
+                {
+                    throw ipc_error("Invalid list view: out of the values");
+                }
+            }
+        }
+
+        // The views are followed by the variadic data buffers and their sizes
+        void check_binary_views(const std::vector<buffer<std::uint8_t>>& buffers, std::size_t length)
+        {
+            constexpr std::size_t view_size = 16;
+            constexpr std::int32_t short_view_size = 12;
+            const buffer<std::uint8_t>& views = buffers[1];
+            const std::size_t n_data_buffers = buffers.size() - 3;
+            if (!holds(views.size(), length, view_size))
+            {
+                throw ipc_error("Invalid buffer: too small for the views");
+            }
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const auto size = read_at<std::int32_t>(views, i * 4);
+                if (size < 0)
+                {
+                    throw ipc_error("Invalid binary view: negative size");
+                }
+                if (size <= short_view_size)
+                {
+                    continue;
+                }
+                const auto index = read_at<std::int32_t>(views, i * 4 + 2);
+                const auto offset = read_at<std::int32_t>(views, i * 4 + 3);
+                if (index < 0 || std::cmp_greater_equal(index, n_data_buffers) || offset < 0
+                    || std::cmp_greater(offset, buffers[2 + static_cast<std::size_t>(index)].size())
+                    || std::cmp_greater(
+                        size,
+                        buffers[2 + static_cast<std::size_t>(index)].size() - static_cast<std::size_t>(offset)
+                    ))
+                {
+                    throw ipc_error("Invalid binary view: out of the data buffers");
+                }
+            }
+        }
+
+        // Arrow IPC counts the buffer indexes of the views from the first
+        // variadic buffer, sparrow from the whole list of buffers
+        [[nodiscard]] buffer<std::uint8_t> rebase_binary_views(const buffer<std::uint8_t>& views, std::size_t length)
+        {
+            constexpr std::size_t view_size = 16;
+            constexpr std::int32_t short_view_size = 12;
+            constexpr std::int32_t first_data_buffer_index = 2;
+            buffer<std::uint8_t> res(views.cbegin(), views.cbegin() + static_cast<std::ptrdiff_t>(length * view_size));
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                if (read_at<std::int32_t>(res, i * 4) > short_view_size)
+                {
+                    const std::int32_t index = read_at<std::int32_t>(res, i * 4 + 2) + first_data_buffer_index;
+                    std::memcpy(res.data() + i * view_size + 8, &index, sizeof(index));
+                }
+            }
+            return res;
+        }
+
+        // The run ends must be positive, strictly increasing, and cover the
+        // length of the array
+        template <class R>
+        void check_run_ends(const ArrowArray& run_ends, std::size_t length)
+        {
+            const auto n_runs = static_cast<std::size_t>(run_ends.length);
+            const auto* data = static_cast<const std::uint8_t*>(run_ends.buffers[1]);
+            R previous = 0;
+            for (std::size_t i = 0; i < n_runs; ++i)
+            {
+                R current;
+                std::memcpy(&current, data + i * sizeof(R), sizeof(R));
+                if (current <= previous)
+                {
+                    throw ipc_error("Invalid run ends: not strictly increasing");
+                }
+                previous = current;
+            }
+            if (std::cmp_less(previous, length))
+            {
+                throw ipc_error("Invalid run ends: shorter than the array");
+            }
+        }
+
+        void check_run_end_encoded(
+            const field_descriptor& field,
+            std::size_t length,
+            std::span<const ArrowArray> children
+        )
+        {
+            if (children[0].length != children[1].length)
+            {
+                throw ipc_error("Invalid run-end encoded array: run ends and values of different lengths");
+            }
+            switch (format_to_data_type(field.children[0].format))
+            {
+                case data_type::INT16:
+                    return check_run_ends<std::int16_t>(children[0], length);
+                case data_type::INT32:
+                    return check_run_ends<std::int32_t>(children[0], length);
+                case data_type::INT64:
+                    return check_run_ends<std::int64_t>(children[0], length);
+                case data_type::UINT16:
+                    return check_run_ends<std::uint16_t>(children[0], length);
+                case data_type::UINT32:
+                    return check_run_ends<std::uint32_t>(children[0], length);
+                case data_type::UINT64:
+                    return check_run_ends<std::uint64_t>(children[0], length);
+                default:
+                    throw ipc_error("Invalid run-end encoded array: run ends must be integers");
+            }
+        }
+
+        // The valid keys must be indexes of the dictionary
+        template <class K>
+        void check_keys(const std::vector<buffer<std::uint8_t>>& buffers, std::size_t length, std::size_t dictionary_length)
+        {
+            const buffer<std::uint8_t>& validity = buffers[0];
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                if (!validity.empty() && ((validity[i / 8] >> (i % 8)) & 1u) == 0)
+                {
+                    continue;
+                }
+                const K key = read_at<K>(buffers[1], i);
+                if (key < 0 || std::cmp_greater_equal(key, dictionary_length))
+                {
+                    throw ipc_error("Invalid dictionary key: out of the dictionary");
+                }
+            }
+        }
+
+        void check_dictionary_keys(
+            const field_descriptor& field,
+            const std::vector<buffer<std::uint8_t>>& buffers,
+            std::size_t length,
+            const ArrowArray& dictionary
+        )
+        {
+            const auto dictionary_length = static_cast<std::size_t>(dictionary.length);
+            switch (format_to_data_type(field.format))
+            {
+                case data_type::INT8:
+                    return check_keys<std::int8_t>(buffers, length, dictionary_length);
+                case data_type::INT16:
+                    return check_keys<std::int16_t>(buffers, length, dictionary_length);
+                case data_type::INT32:
+                    return check_keys<std::int32_t>(buffers, length, dictionary_length);
+                case data_type::INT64:
+                    return check_keys<std::int64_t>(buffers, length, dictionary_length);
+                case data_type::UINT8:
+                    return check_keys<std::uint8_t>(buffers, length, dictionary_length);
+                case data_type::UINT16:
+                    return check_keys<std::uint16_t>(buffers, length, dictionary_length);
+                case data_type::UINT32:
+                    return check_keys<std::uint32_t>(buffers, length, dictionary_length);
+                case data_type::UINT64:
+                    return check_keys<std::uint64_t>(buffers, length, dictionary_length);
+                default:
+                    throw ipc_error("Invalid dictionary: keys must be integers");
+            }
+        }
+
+        [[nodiscard]] std::vector<std::int32_t> union_type_ids(std::string_view format)
+        {
+            std::vector<std::int32_t> res;
+            format.remove_prefix(4);
+            while (!format.empty())
+            {
+                const std::size_t comma = std::min(format.find(','), format.size());
+                res.push_back(static_cast<std::int32_t>(std::stoi(std::string(format.substr(0, comma)))));
+                format.remove_prefix(std::min(comma + 1, format.size()));
+            }
+            return res;
+        }
+
+        void check_union(
+            const field_descriptor& field,
+            bool dense,
+            const std::vector<buffer<std::uint8_t>>& buffers,
+            std::size_t length,
+            std::span<const ArrowArray> children
+        )
+        {
+            const std::vector<std::int32_t> type_ids = union_type_ids(field.format);
+            if (!holds(buffers[0].size(), length, 1) || (dense && !holds(buffers[1].size(), length, 4)))
+            {
+                throw ipc_error("Invalid buffer: too small for the union");
+            }
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const auto type_id = static_cast<std::int32_t>(static_cast<std::int8_t>(buffers[0][i]));
+                const auto it = std::ranges::find(type_ids, type_id);
+                if (it == type_ids.end())
+                {
+                    throw ipc_error("Invalid union: unknown type id");
+                }
+                const ArrowArray& child = children[static_cast<std::size_t>(it - type_ids.begin())];
+                const std::int64_t index = dense ? read_at<std::int32_t>(buffers[1], i) : static_cast<std::int64_t>(i);
+                if (index < 0 || index >= child.length)
+                {
+                    throw ipc_error("Invalid union: out of the child");
+                }
+            }
+        }
+
+        void validate_array(
+            const field_descriptor& field,
+            std::size_t length,
+            std::size_t null_count,
+            const std::vector<buffer<std::uint8_t>>& buffers,
+            std::span<const ArrowArray> children
+        )
+        {
+            const data_type dt = format_to_data_type(field.format);
+            const bool is_union = dt == data_type::DENSE_UNION || dt == data_type::SPARSE_UNION;
+            if (field.n_buffers != 0 && !is_union)
+            {
+                // The validity bitmap may be omitted when there is no null value
+                const buffer<std::uint8_t>& validity = buffers[0];
+                if (validity.empty() ? null_count != 0 : !holds(validity.size() * 8, length, 1))
+                {
+                    throw ipc_error("Invalid buffer: too small for the validity bitmap");
+                }
+            }
+
+            const auto child_length = [&children](std::size_t i)
+            {
+                return static_cast<std::size_t>(children[i].length);
+            };
+            switch (dt)
+            {
+                case data_type::NA:
+                case data_type::BOOL:
+                    // The boolean values are checked when they are unpacked
+                    break;
+                case data_type::RUN_ENCODED:
+                    check_run_end_encoded(field, length, children);
+                    break;
+                case data_type::STRING:
+                case data_type::BINARY:
+                    check_offsets<std::int32_t>(buffers[1], length, buffers[2].size());
+                    break;
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                    check_offsets<std::int64_t>(buffers[1], length, buffers[2].size());
+                    break;
+                case data_type::STRING_VIEW:
+                case data_type::BINARY_VIEW:
+                    check_binary_views(buffers, length);
+                    break;
+                case data_type::LIST:
+                case data_type::MAP:
+                    check_offsets<std::int32_t>(buffers[1], length, child_length(0));
+                    break;
+                case data_type::LARGE_LIST:
+                    check_offsets<std::int64_t>(buffers[1], length, child_length(0));
+                    break;
+                case data_type::LIST_VIEW:
+                    check_list_views<std::int32_t>(buffers[1], buffers[2], length, child_length(0));
+                    break;
+                case data_type::LARGE_LIST_VIEW:
+                    check_list_views<std::int64_t>(buffers[1], buffers[2], length, child_length(0));
+                    break;
+                case data_type::FIXED_SIZED_LIST:
+                {
+                    const auto list_size = static_cast<std::size_t>(std::stoull(field.format.substr(3)));
+                    if (list_size != 0 && !holds(child_length(0), length, list_size))
+                    {
+                        throw ipc_error("Invalid child: too short for the fixed-size lists");
+                    }
+                    break;
+                }
+                case data_type::STRUCT:
+                    for (std::size_t i = 0; i < children.size(); ++i)
+                    {
+                        if (child_length(i) < length)
+                        {
+                            throw ipc_error("Invalid child: too short for the struct");
+                        }
+                    }
+                    break;
+                case data_type::DENSE_UNION:
+                case data_type::SPARSE_UNION:
+                    check_union(field, dt == data_type::DENSE_UNION, buffers, length, children);
+                    break;
+                default:
+                {
+                    const std::size_t size = fixed_width_size(dt, field.format);
+                    if (size != 0 && !holds(buffers[1].size(), length, size))
+                    {
+                        throw ipc_error("Invalid buffer: too small for the array length");
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<field_descriptor> decode_schema(const fb_table& schema, std::int16_t version)
+    {
+        if (!schema.valid())
+        {
+            throw ipc_error("Missing schema");
+        }
+        if (schema.scalar<std::int16_t>(schema_field::endianness, 0) != 0)
+        {
+            throw ipc_error("Big-endian data is not supported");
+        }
+        const fb_vector fields = schema.vector(schema_field::fields);
+        std::vector<field_descriptor> res;
+        res.reserve(fields.size());
+        for (std::size_t i = 0; i < fields.size(); ++i)
+        {
+            res.push_back(decode_field(fields.table(i), version));
+        }
+        return res;
+    }
+
+    void collect_dictionary_fields(
+        const std::vector<field_descriptor>& fields,
+        std::unordered_map<std::int64_t, const field_descriptor*>& res
+    )
+    {
+        for (const field_descriptor& field : fields)
+        {
+            collect_dictionary_fields(field.children, res);
+            if (field.dictionary)
+            {
+                res[field.dictionary_id] = field.dictionary.get();
+                collect_dictionary_fields(field.dictionary->children, res);
+            }
+        }
+    }
+
+    ArrowSchema make_schema(const field_descriptor& field)
+    {
+        const std::size_t n_children = field.children.size();
+        ArrowSchema** children = nullptr;
+        if (n_children != 0)
+        {
+            children = new ArrowSchema*[n_children];
+            for (std::size_t i = 0; i < n_children; ++i)
+            {
+                children[i] = new ArrowSchema(make_schema(field.children[i]));
+            }
+        }
+        ArrowSchema* dictionary = field.dictionary ? new ArrowSchema(make_schema(*field.dictionary)) : nullptr;
+        ArrowSchema res = make_arrow_schema(
+            field.format,
+            field.name,
+            field.metadata,
+            std::nullopt,
+            children,
+            repeat_view<bool>(true, n_children),
+            dictionary,
+            true
+        );
+        res.flags = field.flags;
+        return res;
+    }
+
+    message decode_message(const std::uint8_t* data, std::size_t size)
+    {
+        const fb_table root = fb_table::root(data, size);
+        message res;
+        res.version = root.scalar<std::int16_t>(message_field::version, 0);
+        if (res.version < metadata_version_v4)
+        {
+            throw ipc_error("Unsupported metadata version: " + std::to_string(res.version));
+        }
+        res.type = static_cast<message_type>(root.scalar<std::uint8_t>(message_field::header_type, 0));
+        res.header = root.table(message_field::header);
+        res.body_length = root.scalar<std::int64_t>(message_field::body_length, 0);
+        if (res.body_length < 0)
+        {
+            throw ipc_error("Invalid message body length");
+        }
+        return res;
+    }
+
+    batch_decoder::batch_decoder(
+        const fb_table& record_batch,
+        std::byte* body,
+        std::size_t body_size,
+        std::shared_ptr<memory_region> region,
+        const dictionary_resolver& resolver
+    )
+        : m_record_batch(record_batch)
+        , m_nodes(record_batch.vector(record_batch_field::nodes))
+        , m_buffers(record_batch.vector(record_batch_field::buffers))
+        , m_variadic_counts(record_batch.vector(record_batch_field::variadic_buffer_counts))
+        , p_body(body)
+        , m_body_size(body_size)
+        , m_region(std::move(region))
+        , m_resolver(resolver)
+    {
+        if (record_batch.has_field(record_batch_field::compression))
+        {
+            throw ipc_error("Compressed record batches are not supported");
+        }
+    }
+
+    std::int64_t batch_decoder::length() const noexcept
+    {
+        return m_record_batch.scalar<std::int64_t>(record_batch_field::length, 0);
+    }
+
+    buffer<std::uint8_t> batch_decoder::next_buffer()
+    {
+        const std::uint8_t* b = m_buffers.inline_struct(m_buffer_index++, buffer_size);
+        const auto offset = struct_field<std::int64_t>(b, 0);
+        const auto length = struct_field<std::int64_t>(b, 8);
+        if (offset < 0 || length < 0 || static_cast<std::uint64_t>(offset) > m_body_size
+            || static_cast<std::uint64_t>(length) > m_body_size - static_cast<std::size_t>(offset))
+        {
+            throw ipc_error("Invalid buffer: out of the message body");
+        }
+        if (length == 0)
+        {
+            return {};
+        }
+        auto* data = reinterpret_cast<std::uint8_t*>(p_body + offset);
+        return {data, static_cast<std::size_t>(length), region_allocator<std::uint8_t>(m_region)};
+    }
+
+    ArrowArray batch_decoder::decode(const field_descriptor& field)
+    {
+        const std::uint8_t* node = m_nodes.inline_struct(m_node_index++, field_node_size);
+        const auto length = struct_field<std::int64_t>(node, 0);
+        const auto null_count = struct_field<std::int64_t>(node, 8);
+        if (length < 0 || null_count < 0 || null_count > length)
+        {
+            throw ipc_error("Invalid field node");
+        }
+
+        std::vector<buffer<std::uint8_t>> buffers;
+        buffers.reserve(field.n_buffers + (field.has_variadic_buffers ? 2 : 0));
+        for (std::size_t i = 0; i < field.n_buffers; ++i)
+        {
+            buffers.push_back(next_buffer());
+        }
+        if (field.has_variadic_buffers)
+        {
+            // The C data interface expects an additional buffer holding the
+            // sizes of the variadic buffers.
+            const auto count = m_variadic_counts.scalar<std::int64_t>(m_variadic_index++);
+            if (count < 0)
+            {
+                throw ipc_error("Invalid variadic buffer count");
+            }
+            const auto n = static_cast<std::size_t>(count);
+            buffer<std::uint8_t> sizes(n * sizeof(std::int64_t));
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                buffers.push_back(next_buffer());
+                const auto size = static_cast<std::int64_t>(buffers.back().size());
+                std::memcpy(sizes.data() + i * sizeof(std::int64_t), &size, sizeof(size));
+            }
+            buffers.push_back(std::move(sizes));
+        }
+        if (field.format == "b")
+        {
+            // Arrow IPC packs boolean values as bits, sparrow stores them as bytes
+            buffers[1] = unpack_bits(buffers[1], static_cast<std::size_t>(length));
+        }
+
+        // The children are checked along with the buffers, and released if
+        // the array is invalid
+        const std::size_t n_children = field.children.size();
+        std::vector<ArrowArray> child_arrays;
+        child_arrays.reserve(n_children);
+        ArrowArray dictionary_values{};
+        try
+        {
+            for (const field_descriptor& child : field.children)
+            {
+                child_arrays.push_back(decode(child));
+            }
+            validate_array(
+                field,
+                static_cast<std::size_t>(length),
+                static_cast<std::size_t>(null_count),
+                buffers,
+                child_arrays
+            );
+            if (field.has_variadic_buffers)
+            {
+                buffers[1] = rebase_binary_views(buffers[1], static_cast<std::size_t>(length));
+            }
+            if (field.dictionary)
+            {
+                dictionary_values = m_resolver(field.dictionary_id);
+                check_dictionary_keys(field, buffers, static_cast<std::size_t>(length), dictionary_values);
+            }
+        }
+        catch (...)
+        {
+            for (ArrowArray& child : child_arrays)
+            {
+                child.release(&child);
+            }
+            if (dictionary_values.release != nullptr)
+            {
+                dictionary_values.release(&dictionary_values);
+            }
+            throw;
+        }
+
+        ArrowArray** children = nullptr;
+        if (n_children != 0)
+        {
+            children = new ArrowArray*[n_children];
+            for (std::size_t i = 0; i < n_children; ++i)
+            {
+                children[i] = new ArrowArray(child_arrays[i]);
+            }
+        }
+        ArrowArray* dictionary = field.dictionary ? new ArrowArray(dictionary_values) : nullptr;
+
+        return make_arrow_array(
+            length,
+            null_count,
+            0,
+            std::move(buffers),
+            children,
+            repeat_view<bool>(true, n_children),
+            dictionary,
+            true
+        );
+    }
+
+    record_batch decode_record_batch(
+        const std::vector<field_descriptor>& fields,
+        const fb_table& batch,
+        std::byte* body,
+        std::size_t body_size,
+        std::shared_ptr<memory_region> region,
+        const dictionary_resolver& resolver
+    )
+    {
+        batch_decoder decoder(batch, body, body_size, std::move(region), resolver);
+        std::vector<std::string> names;
+        std::vector<array> columns;
+        names.reserve(fields.size());
+        columns.reserve(fields.size());
+        for (const field_descriptor& field : fields)
+        {
+            names.push_back(field.name);
+            columns.emplace_back(decoder.decode(field), make_schema(field));
+        }
+        return record_batch(std::move(names), std::move(columns));
+    }
+}
@@ -0,0 +1,256 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/buffer/memory_region.hpp"
+#include "sparrow/c_interface.hpp"
+#include "sparrow/record_batch.hpp"
+
+#include "flatbuffer.hpp"
+
+// Decoding of the Arrow IPC metadata (Schema.fbs, Message.fbs, File.fbs) into
+// sparrow structures, shared by the file and stream readers. The constants
+// describing the format are shared with the writers.
+
+namespace sparrow::ipc::detail
+{
+    inline constexpr std::uint32_t continuation_marker = 0xFFFFFFFF;
+    inline constexpr std::string_view file_magic = "ARROW1";
+
+    // Values of the MetadataVersion enum
+    inline constexpr std::int16_t metadata_version_v4 = 3;
+    inline constexpr std::int16_t metadata_version_v5 = 4;
+
+    // Values of the MessageHeader union
+    enum class message_type : std::uint8_t
+    {
+        none = 0,
+        schema = 1,
+        dictionary_batch = 2,
+        record_batch = 3,
+        tensor = 4,
+        sparse_tensor = 5
+    };
+
+    // Values of the Type union
+    enum class type_id : std::uint8_t
+    {
+        none = 0,
+        null = 1,
+        int_ = 2,
+        floating_point = 3,
+        binary = 4,
+        utf8 = 5,
+        bool_ = 6,
+        decimal = 7,
+        date = 8,
+        time = 9,
+        timestamp = 10,
+        interval = 11,
+        list = 12,
+        struct_ = 13,
+        union_ = 14,
+        fixed_size_binary = 15,
+        fixed_size_list = 16,
+        map = 17,
+        duration = 18,
+        large_binary = 19,
+        large_utf8 = 20,
+        large_list = 21,
+        run_end_encoded = 22,
+        binary_view = 23,
+        utf8_view = 24,
+        list_view = 25,
+        large_list_view = 26
+    };
+
+    // Field ids of the tables, in declaration order of the .fbs files
+    namespace field
+    {
+        inline constexpr std::size_t name = 0;
+        inline constexpr std::size_t nullable = 1;
+        inline constexpr std::size_t type_type = 2;
+        inline constexpr std::size_t type = 3;
+        inline constexpr std::size_t dictionary = 4;
+        inline constexpr std::size_t children = 5;
+        inline constexpr std::size_t custom_metadata = 6;
+    }
+
+    namespace record_batch_field
+    {
+        inline constexpr std::size_t length = 0;
+        inline constexpr std::size_t nodes = 1;
+        inline constexpr std::size_t buffers = 2;
+        inline constexpr std::size_t compression = 3;
+        inline constexpr std::size_t variadic_buffer_counts = 4;
+    }
+
+    namespace message_field
+    {
+        inline constexpr std::size_t version = 0;
+        inline constexpr std::size_t header_type = 1;
+        inline constexpr std::size_t header = 2;
+        inline constexpr std::size_t body_length = 3;
+    }
+
+    namespace schema_field
+    {
+        inline constexpr std::size_t endianness = 0;
+        inline constexpr std::size_t fields = 1;
+    }
+
+    namespace dictionary_batch_field
+    {
+        inline constexpr std::size_t id = 0;
+        inline constexpr std::size_t data = 1;
+        inline constexpr std::size_t is_delta = 2;
+    }
+
+    namespace dictionary_encoding_field
+    {
+        inline constexpr std::size_t id = 0;
+        inline constexpr std::size_t index_type = 1;
+        inline constexpr std::size_t is_ordered = 2;
+    }
+
+    namespace key_value_field
+    {
+        inline constexpr std::size_t key = 0;
+        inline constexpr std::size_t value = 1;
+    }
+
+    // Sizes of the FieldNode and Buffer structs
+    inline constexpr std::size_t field_node_size = 16;
+    inline constexpr std::size_t buffer_size = 16;
+
+    /*
+     * Description of a field of the schema, from which the ArrowSchema of the
+     * arrays of each record batch are created, and which drives the decoding
+     * of the buffers of a record batch body.
+     */
+    struct field_descriptor
+    {
+        std::string format;
+        std::string name;
+        std::optional<std::string> metadata;
+        std::int64_t flags = 0;
+        // Number of buffers of the field in a record batch body
+        std::size_t n_buffers = 0;
+        // Binary and string views have additional variadic data buffers
+        bool has_variadic_buffers = false;
+        std::vector<field_descriptor> children;
+        // For dictionary-encoded fields, the id of the dictionary and the
+        // description of its values. The field itself describes the indices.
+        std::int64_t dictionary_id = -1;
+        std::shared_ptr<field_descriptor> dictionary;
+    };
+
+    /*
+     * Decodes a Schema table into the descriptors of its fields.
+     */
+    [[nodiscard]] std::vector<field_descriptor> decode_schema(const fb_table& schema, std::int16_t version);
+
+    /*
+     * Maps the ids of the dictionaries of \c fields, including nested ones, to
+     * the descriptors of their values.
+     */
+    void collect_dictionary_fields(
+        const std::vector<field_descriptor>& fields,
+        std::unordered_map<std::int64_t, const field_descriptor*>& res
+    );
+
+    /*
+     * Returns a new ArrowSchema described by \c field.
+     */
+    [[nodiscard]] ArrowSchema make_schema(const field_descriptor& field);
+
+    /*
+     * Message header decoded from an encapsulated message.
+     */
+    struct message
+    {
+        std::int16_t version = 0;
+        message_type type = message_type::none;
+        fb_table header;
+        std::int64_t body_length = 0;
+    };
+
+    [[nodiscard]] message decode_message(const std::uint8_t* data, std::size_t size);
+
+    // Returns the ArrowArray holding the values of the dictionary with the given id
+    using dictionary_resolver = std::function<ArrowArray(std::int64_t)>;
+
+    /*
+     * Decodes the arrays of a RecordBatch message whose body is in
+     * [body, body + body_size). The buffers of the arrays adopt the memory of
+     * the body without copying it, and keep \c region alive.
+     */
+    class batch_decoder
+    {
+    public:
+
+        batch_decoder(
+            const fb_table& record_batch,
+            std::byte* body,
+            std::size_t body_size,
+            std::shared_ptr<memory_region> region,
+            const dictionary_resolver& resolver
+        );
+
+        [[nodiscard]] std::int64_t length() const noexcept;
+
+        // Decodes the next field of the batch; fields must be decoded in schema order.
+        [[nodiscard]] ArrowArray decode(const field_descriptor& field);
+
+    private:
+
+        [[nodiscard]] buffer<std::uint8_t> next_buffer();
+
+        fb_table m_record_batch;
+        fb_vector m_nodes;
+        fb_vector m_buffers;
+        fb_vector m_variadic_counts;
+        std::byte* p_body;
+        std::size_t m_body_size;
+        std::shared_ptr<memory_region> m_region;
+        const dictionary_resolver& m_resolver;
+        std::size_t m_node_index = 0;
+        std::size_t m_buffer_index = 0;
+        std::size_t m_variadic_index = 0;
+    };
+
+    /*
+     * Decodes the record batch made of the given fields.
+     */
+    [[nodiscard]] record_batch decode_record_batch(
+        const std::vector<field_descriptor>& fields,
+        const fb_table& batch,
+        std::byte* body,
+        std::size_t body_size,
+        std::shared_ptr<memory_region> region,
+        const dictionary_resolver& resolver
+    );
+}
@@ -0,0 +1,362 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/stream_reader.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "sparrow/buffer/aligned_allocator.hpp"
+#include "sparrow/buffer/memory_region.hpp"
+
+#include "io.hpp"
+#include "metadata.hpp"
+
+namespace sparrow::ipc
+{
+    namespace
+    {
+        /*
+         * Memory holding the body of a message, adopted by the arrays decoded
+         * from it.
+         */
+        class body_block : public memory_region
+        {
+        public:
+
+            explicit body_block(std::size_t capacity)
+            {
+                reset(aligned_allocator<std::byte>().allocate(capacity), capacity);
+            }
+
+            ~body_block() override
+            {
+                aligned_allocator<std::byte>().deallocate(data(), size());
+            }
+        };
+
+        // Number of blocks kept for reuse
+        constexpr std::size_t max_pooled_blocks = 4;
+
+        stream_reader::source_type fd_source(int fd)
+        {
+            return [fd](std::span<std::uint8_t> dest)
+            {
+                return detail::read_some(fd, dest);
+            };
+        }
+    }
+
+    struct stream_reader::impl
+    {
+        // A dictionary batch, kept to decode the dictionary of each record batch
+        struct stored_dictionary
+        {
+            std::vector<std::uint8_t> metadata;
+            detail::message msg;
+            std::shared_ptr<body_block> body;
+            std::size_t body_size = 0;
+        };
+
+        explicit impl(source_type source);
+        ~impl();
+
+        impl(const impl&) = delete;
+        impl(impl&&) = delete;
+        impl& operator=(const impl&) = delete;
+        impl& operator=(impl&&) = delete;
+
+        void read_schema();
+
+        // Reads the next message into m_metadata, m_message and m_body,
+        // returns false at the end of the stream.
+        [[nodiscard]] bool read_message();
+
+        // Fills dest, returns false if the stream ends before the first byte
+        // when allow_end is true.
+        bool read_exact(std::span<std::uint8_t> dest, bool allow_end = false);
+
+        [[nodiscard]] std::shared_ptr<body_block> acquire_block(std::size_t size);
+
+        void store_dictionary();
+        [[nodiscard]] ArrowArray read_dictionary(std::int64_t id) const;
+
+        source_type m_source;
+        int m_owned_fd = -1;
+        bool m_done = false;
+        std::vector<detail::field_descriptor> m_fields;
+        std::unordered_map<std::int64_t, const detail::field_descriptor*> m_dictionary_fields;
+        std::unordered_map<std::int64_t, stored_dictionary> m_dictionaries;
+        detail::dictionary_resolver m_resolver;
+
+        // Current message, the metadata buffer is reused across messages
+        std::vector<std::uint8_t> m_metadata;
+        detail::message m_message;
+        std::shared_ptr<body_block> m_body;
+        std::size_t m_body_size = 0;
+
+        std::vector<std::shared_ptr<body_block>> m_blocks;
+        std::size_t m_next_evicted = 0;
+    };
+
+    stream_reader::impl::impl(source_type source)
+        : m_source(std::move(source))
+        , m_resolver(
+              [this](std::int64_t id)
+              {
+                  return read_dictionary(id);
+              }
+          )
+    {
+    }
+
+    stream_reader::impl::~impl()
+    {
+        if (m_owned_fd >= 0)
+        {
+            detail::close_file(m_owned_fd);
+        }
+    }
+
+    void stream_reader::impl::read_schema()
+    {
+        if (!read_message())
+        {
+            // Stream without record batches
+            m_done = true;
+            return;
+        }
+        if (m_message.type != detail::message_type::schema)
+        {
+            throw ipc_error("Expected a schema message");
+        }
+        m_fields = detail::decode_schema(m_message.header, m_message.version);
+        detail::collect_dictionary_fields(m_fields, m_dictionary_fields);
+    }
+
+    bool stream_reader::impl::read_exact(std::span<std::uint8_t> dest, bool allow_end)
+    {
+        std::size_t done = 0;
+        while (done < dest.size())
+        {
+            const std::size_t n = m_source(dest.subspan(done));
+            if (n == 0)
+            {
+                if (allow_end && done == 0)
+                {
+                    return false;
+                }
+                throw ipc_error("Unexpected end of stream");
+            }
+            done += n;
+        }
+        return true;
+    }
+
+    bool stream_reader::impl::read_message()
+    {
+        // Encapsulated message: continuation marker (absent before format 0.15),
+        // size of the flatbuffer, flatbuffer, padding, body. The end of the
+        // stream is marked by a size of 0, or by the end of the input.
+        std::uint32_t word = 0;
+        auto word_bytes = std::span(reinterpret_cast<std::uint8_t*>(&word), sizeof(word));
+        if (!read_exact(word_bytes, true))
+        {
+            return false;
+        }
+        // A continuation marker must be followed by the size of the message
+        if (word == detail::continuation_marker)
+        {
+            read_exact(word_bytes);
+        }
+        if (word == 0)
+        {
+            return false;
+        }
+        if (word > static_cast<std::uint32_t>(std::numeric_limits<std::int32_t>::max()))
+        {
+            throw ipc_error("Invalid message size");
+        }
+        m_metadata.resize(word);
+        read_exact(m_metadata);
+        m_message = detail::decode_message(m_metadata.data(), m_metadata.size());
+
+        if (static_cast<std::uint64_t>(m_message.body_length) > std::numeric_limits<std::size_t>::max())
+        {
+            throw ipc_error("Invalid message body length");
+        }
+        m_body_size = static_cast<std::size_t>(m_message.body_length);
+        // The block of the previous message can be reused
+        m_body.reset();
+        m_body = acquire_block(m_body_size);
+        read_exact({reinterpret_cast<std::uint8_t*>(m_body->data()), m_body_size});
+        return true;
+    }
+
+    std::shared_ptr<body_block> stream_reader::impl::acquire_block(std::size_t size)
+    {
+        // A block referenced only by the pool is not adopted by any array
+        // anymore. The fence orders the reuse after the release of the last
+        // reference, which may happen in another thread.
+        const auto unused = [](const std::shared_ptr<body_block>& block)
+        {
+            return block.use_count() == 1;
+        };
+        for (const std::shared_ptr<body_block>& block : m_blocks)
+        {
+            if (unused(block) && block->size() >= size)
+            {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return block;
+            }
+        }
+
+        auto block = std::make_shared<body_block>(padded_size(std::max<std::size_t>(size, 1)));
+        // Replace an unused block too small for the message, or else a block
+        // still in use, which is released with its arrays.
+        const auto it = std::ranges::find_if(m_blocks, unused);
+        if (it != m_blocks.end())
+        {
+            *it = block;
+        }
+        else if (m_blocks.size() < max_pooled_blocks)
+        {
+            m_blocks.push_back(block);
+        }
+        else
+        {
+            m_blocks[m_next_evicted++ % max_pooled_blocks] = block;
+        }
+        return block;
+    }
+
+    void stream_reader::impl::store_dictionary()
+    {
+        if (m_message.header.scalar<std::uint8_t>(detail::dictionary_batch_field::is_delta, 0) != 0)
+        {
+            throw ipc_error("Delta dictionaries are not supported");
+        }
+        const auto id = m_message.header.scalar<std::int64_t>(detail::dictionary_batch_field::id, 0);
+        if (!m_dictionary_fields.contains(id))
+        {
+            throw ipc_error("Dictionary batch with unknown id " + std::to_string(id));
+        }
+        // The header points to the metadata, which is moved with it
+        stored_dictionary dictionary{std::move(m_metadata), m_message, std::move(m_body), m_body_size};
+        m_dictionaries.insert_or_assign(id, std::move(dictionary));
+        m_metadata.clear();
+    }
+
+    ArrowArray stream_reader::impl::read_dictionary(std::int64_t id) const
+    {
+        const auto it = m_dictionaries.find(id);
+        if (it == m_dictionaries.end())
+        {
+            throw ipc_error("Missing dictionary batch with id " + std::to_string(id));
+        }
+        const stored_dictionary& dictionary = it->second;
+        detail::batch_decoder decoder(
+            dictionary.msg.header.table(detail::dictionary_batch_field::data),
+            dictionary.body->data(),
+            dictionary.body_size,
+            dictionary.body,
+            m_resolver
+        );
+        return decoder.decode(*m_dictionary_fields.at(id));
+    }
+
+    stream_reader::stream_reader(const std::filesystem::path& path)
+    {
+        const int fd = detail::open_file(path, detail::open_mode::read);
+        try
+        {
+            p_impl = std::make_unique<impl>(fd_source(fd));
+        }
+        catch (...)
+        {
+            detail::close_file(fd);
+            throw;
+        }
+        p_impl->m_owned_fd = fd;
+        p_impl->read_schema();
+    }
+
+    stream_reader::stream_reader(int fd)
+        : stream_reader(fd_source(fd))
+    {
+    }
+
+    stream_reader::stream_reader(source_type source)
+        : p_impl(std::make_unique<impl>(std::move(source)))
+    {
+        p_impl->read_schema();
+    }
+
+    stream_reader::~stream_reader() = default;
+
+    stream_reader::stream_reader(stream_reader&&) noexcept = default;
+    stream_reader& stream_reader::operator=(stream_reader&&) noexcept = default;
+
+    std::optional<record_batch> stream_reader::next()
+    {
+        while (!p_impl->m_done)
+        {
+            if (!p_impl->read_message())
+            {
+                p_impl->m_done = true;
+                break;
+            }
+            switch (p_impl->m_message.type)
+            {
+                case detail::message_type::dictionary_batch:
+                    p_impl->store_dictionary();
+                    break;
+                case detail::message_type::record_batch:
+                {
+                    // The batch holds the only reference to its block besides the pool
+                    std::shared_ptr<body_block> body = std::move(p_impl->m_body);
+                    return detail::decode_record_batch(
+                        p_impl->m_fields,
+                        p_impl->m_message.header,
+                        body->data(),
+                        p_impl->m_body_size,
+                        body,
+                        p_impl->m_resolver
+                    );
+                }
+                default:
+                    throw ipc_error(
+                        "Unexpected message of type "
+                        + std::to_string(static_cast<int>(p_impl->m_message.type))
+                    );
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::vector<record_batch> stream_reader::read_all()
+    {
+        std::vector<record_batch> res;
+        while (std::optional<record_batch> batch = next())
+        {
+            res.push_back(std::move(*batch));
+        }
+        return res;
+    }
+}
@@ -0,0 +1,183 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/stream_writer.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "encoder.hpp"
+#include "io.hpp"
+
+namespace sparrow::ipc
+{
+    struct stream_writer::impl
+    {
+        explicit impl(sink_type sink)
+            : m_sink(std::move(sink))
+        {
+        }
+
+        void write_message(const std::vector<std::uint8_t>& metadata, const detail::body_encoder* body);
+
+        sink_type m_sink;
+        int m_owned_fd = -1;
+        bool m_closed = false;
+        std::vector<std::uint8_t> m_schema;
+        // Reused across messages to avoid an allocation per message
+        std::vector<detail::segment> m_segments;
+    };
+
+    void stream_writer::impl::write_message(const std::vector<std::uint8_t>& metadata, const detail::body_encoder* body)
+    {
+        // Encapsulated message: prefix, flatbuffer padded to 8 bytes, body
+        const std::array<std::uint8_t, 8> prefix = detail::message_prefix(metadata.size());
+        m_segments.clear();
+        m_segments.emplace_back(prefix);
+        m_segments.emplace_back(metadata);
+        if (body != nullptr)
+        {
+            m_segments.insert(m_segments.end(), body->segments().begin(), body->segments().end());
+        }
+        m_sink(m_segments);
+    }
+
+    namespace
+    {
+        stream_writer::sink_type fd_sink(int fd)
+        {
+            return [fd](std::span<const std::span<const std::uint8_t>> segments)
+            {
+                detail::write_all(fd, segments);
+            };
+        }
+    }
+
+    stream_writer::stream_writer(const std::filesystem::path& path)
+    {
+        const int fd = detail::open_file(path, detail::open_mode::write);
+        try
+        {
+            p_impl = std::make_unique<impl>(fd_sink(fd));
+        }
+        catch (...)
+        {
+            detail::close_file(fd);
+            throw;
+        }
+        p_impl->m_owned_fd = fd;
+    }
+
+    stream_writer::stream_writer(int fd)
+        : p_impl(std::make_unique<impl>(fd_sink(fd)))
+    {
+    }
+
+    stream_writer::stream_writer(sink_type sink)
+        : p_impl(std::make_unique<impl>(std::move(sink)))
+    {
+    }
+
+    stream_writer::~stream_writer()
+    {
+        if (p_impl != nullptr && !p_impl->m_closed)
+        {
+            try
+            {
+                close();
+            }
+            catch (...)
+            {
+            }
+        }
+    }
+
+    stream_writer::stream_writer(stream_writer&&) noexcept = default;
+
+    stream_writer& stream_writer::operator=(stream_writer&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            // Closes the current output when going out of scope
+            stream_writer old(std::move(*this));
+            p_impl = std::move(rhs.p_impl);
+        }
+        return *this;
+    }
+
+    void stream_writer::write(const record_batch& batch)
+    {
+        if (p_impl->m_closed)
+        {
+            throw ipc_error("Cannot write to a closed stream");
+        }
+        std::vector<std::uint8_t> schema = detail::encode_schema_message(batch);
+        if (p_impl->m_schema.empty())
+        {
+            p_impl->write_message(schema, nullptr);
+            p_impl->m_schema = std::move(schema);
+        }
+        else if (schema != p_impl->m_schema)
+        {
+            throw ipc_error("The schema of the record batch differs from the schema of the stream");
+        }
+
+        std::vector<const arrow_proxy*> dictionaries;
+        for (const array& column : batch.columns())
+        {
+            detail::collect_dictionaries(sparrow::detail::array_access::get_arrow_proxy(column), dictionaries);
+        }
+        for (std::size_t id = 0; id < dictionaries.size(); ++id)
+        {
+            detail::body_encoder body;
+            body.append(*dictionaries[id]);
+            const auto length = static_cast<std::int64_t>(dictionaries[id]->length());
+            p_impl->write_message(body.dictionary_batch_message(static_cast<std::int64_t>(id), length), &body);
+        }
+
+        detail::body_encoder body;
+        for (const array& column : batch.columns())
+        {
+            body.append(sparrow::detail::array_access::get_arrow_proxy(column));
+        }
+        p_impl->write_message(body.record_batch_message(static_cast<std::int64_t>(batch.nb_rows())), &body);
+    }
+
+    void stream_writer::close()
+    {
+        if (p_impl->m_closed)
+        {
+            return;
+        }
+        p_impl->m_closed = true;
+        const int fd = std::exchange(p_impl->m_owned_fd, -1);
+        const std::span<const std::uint8_t> eos(detail::end_of_stream);
+        try
+        {
+            p_impl->m_sink({&eos, 1});
+        }
+        catch (...)
+        {
+            if (fd >= 0)
+            {
+                detail::close_file(fd);
+            }
+            throw;
+        }
+        if (fd >= 0)
+        {
+            detail::close_file(fd);
+        }
+    }
+}
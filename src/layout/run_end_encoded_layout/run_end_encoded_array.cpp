@@ -60,6 +60,16 @@ namespace sparrow
         return size() == 0;
     }
 
+    auto run_end_encoded_array::run_count() const -> size_type
+    {
+        return static_cast<size_type>(m_encoded_length);
+    }
+
+    run_end_encoded_cursor run_end_encoded_array::cursor() const
+    {
+        return run_end_encoded_cursor(*this);
+    }
+
     std::optional<std::string_view> run_end_encoded_array::name() const
     {
         return m_proxy.name();
@@ -91,6 +101,45 @@ namespace sparrow
         return ret;
     }
 
+    auto run_end_encoded_array::get_run_end(std::uint64_t run_index) const -> std::uint64_t
+    {
+        return std::visit(
+            [run_index](const auto* acc_lengths_ptr) -> std::uint64_t
+            {
+                return static_cast<std::uint64_t>(acc_lengths_ptr[run_index]);
+            },
+            m_acc_lengths
+        );
+    }
+
+    auto run_end_encoded_array::find_run(std::uint64_t i, std::uint64_t first) const -> std::uint64_t
+    {
+        return std::visit(
+            [i, first, this](const auto* acc_lengths_ptr) -> std::uint64_t
+            {
+                // Galloping: doubles the step until a run ending after i is
+                // found, then binary searches the last step.
+                const std::uint64_t n = m_encoded_length;
+                std::uint64_t lo = first;
+                std::uint64_t hi = first;
+                std::uint64_t step = 1;
+                while (hi < n && static_cast<std::uint64_t>(acc_lengths_ptr[hi]) <= i)
+                {
+                    lo = hi + 1;
+                    hi = lo + step;
+                    step *= 2;
+                }
+                const auto it = std::upper_bound(
+                    acc_lengths_ptr + lo,
+                    acc_lengths_ptr + std::min(hi + 1, n),
+                    i
+                );
+                return static_cast<std::uint64_t>(std::distance(acc_lengths_ptr, it));
+            },
+            m_acc_lengths
+        );
+    }
+
     arrow_proxy& run_end_encoded_array::get_arrow_proxy()
     {
         return m_proxy;
@@ -191,6 +240,31 @@ namespace sparrow
         );
     }
 
+    run_end_encoded_cursor::run_end_encoded_cursor(const run_end_encoded_array& array)
+        : p_array(&array)
+        , m_run_end(array.run_count() == 0 ? 0 : array.get_run_end(0))
+    {
+    }
+
+    auto run_end_encoded_cursor::operator[](std::uint64_t i) -> array_traits::const_reference
+    {
+        return array_element(*p_array->p_encoded_values_array, static_cast<std::size_t>(seek(i)));
+    }
+
+    std::uint64_t run_end_encoded_cursor::seek(std::uint64_t i)
+    {
+        SPARROW_ASSERT_TRUE(i < p_array->size());
+        if (i >= m_run_begin && i < m_run_end)
+        {
+            return m_run;
+        }
+        // Backward moves restart from the first run
+        m_run = p_array->find_run(i, i >= m_run_end ? m_run + 1 : 0);
+        m_run_begin = m_run == 0 ? 0 : p_array->get_run_end(m_run - 1);
+        m_run_end = p_array->get_run_end(m_run);
+        return m_run;
+    }
+
     std::pair<std::int64_t, std::int64_t>
     run_end_encoded_array::extract_length_and_null_count(const array& acc_lengths_arr, const array& encoded_values_arr)
     {
@@ -0,0 +1,138 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/layout/variable_size_binary_view_builder.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace sparrow
+{
+    namespace
+    {
+        // Views: the length, then either the inlined value or a prefix, the
+        // index of the data buffer in the buffers of the array and the offset
+        // in it.
+        constexpr std::size_t view_size = 16;
+        constexpr std::size_t short_view_size = 12;
+        constexpr std::size_t prefix_size = 4;
+        constexpr std::size_t view_data_offset = 4;
+        constexpr std::size_t view_buffer_index_offset = 8;
+        constexpr std::size_t view_buffer_offset_offset = 12;
+        constexpr std::size_t first_data_buffer_index = 2;
+
+        // First capacity of the data buffers, before they grow up to the cap
+        constexpr std::size_t initial_data_buffer_capacity = 32 * 1024;
+
+        void write_int32(std::uint8_t* p, std::size_t value)
+        {
+            const auto v = static_cast<std::int32_t>(value);
+            std::memcpy(p, &v, sizeof(v));
+        }
+
+        // buffer::resize only reserves the requested size, the growth
+        // is made geometric here
+        void grow(buffer<std::uint8_t>& buf, std::size_t new_size, std::size_t max_capacity)
+        {
+            if (new_size > buf.capacity())
+            {
+                buf.reserve(std::max(new_size, std::min(2 * buf.capacity(), max_capacity)));
+            }
+            buf.resize(new_size);
+        }
+    }
+
+    variable_size_binary_view_builder::variable_size_binary_view_builder(std::size_t max_data_buffer_size)
+        : m_max_data_buffer_size(max_data_buffer_size)
+    {
+        if (max_data_buffer_size == 0 || max_data_buffer_size > max_data_buffer_size_limit)
+        {
+            throw std::invalid_argument("Invalid size cap of the data buffers of a binary view array");
+        }
+    }
+
+    void variable_size_binary_view_builder::reserve(std::size_t count)
+    {
+        m_views.reserve(count * view_size);
+    }
+
+    void variable_size_binary_view_builder::push_back(std::span<const std::byte> value)
+    {
+        const std::size_t length = value.size();
+        if (length > max_data_buffer_size_limit)
+        {
+            throw std::length_error("Value too long for a binary view array");
+        }
+
+        const std::size_t view_position = m_views.size();
+        grow(m_views, view_position + view_size, std::numeric_limits<std::size_t>::max());
+        std::uint8_t* view = m_views.data() + view_position;
+        // The bytes of the view following a short value must be zero
+        std::memset(view, 0, view_size);
+        write_int32(view, length);
+        if (length <= short_view_size)
+        {
+            if (length != 0)
+            {
+                std::memcpy(view + view_data_offset, value.data(), length);
+            }
+            return;
+        }
+
+        std::memcpy(view + view_data_offset, value.data(), prefix_size);
+        buffer<std::uint8_t>& data = data_buffer_for(length);
+        const std::size_t offset = data.size();
+        grow(data, offset + length, std::max(m_max_data_buffer_size, length));
+        std::memcpy(data.data() + offset, value.data(), length);
+        write_int32(view + view_buffer_index_offset, first_data_buffer_index + m_data_buffers.size() - 1);
+        write_int32(view + view_buffer_offset_offset, offset);
+    }
+
+    std::size_t variable_size_binary_view_builder::size() const noexcept
+    {
+        return m_views.size() / view_size;
+    }
+
+    std::vector<buffer<std::uint8_t>> variable_size_binary_view_builder::finish()
+    {
+        // For binary or utf-8 view arrays, an extra buffer is appended which stores
+        // the lengths of each variadic data buffer as int64_t.
+        buffer<std::uint8_t> buffer_sizes(m_data_buffers.size() * sizeof(std::int64_t));
+
+        std::vector<buffer<std::uint8_t>> res;
+        res.reserve(m_data_buffers.size() + 2);
+        res.push_back(std::exchange(m_views, buffer<std::uint8_t>()));
+        for (std::size_t i = 0; i < m_data_buffers.size(); ++i)
+        {
+            const auto data_size = static_cast<std::int64_t>(m_data_buffers[i].size());
+            std::memcpy(buffer_sizes.data() + i * sizeof(std::int64_t), &data_size, sizeof(data_size));
+            res.push_back(std::move(m_data_buffers[i]));
+        }
+        res.push_back(std::move(buffer_sizes));
+        m_data_buffers.clear();
+        return res;
+    }
+
+    buffer<std::uint8_t>& variable_size_binary_view_builder::data_buffer_for(std::size_t size)
+    {
+        if (m_data_buffers.empty() || m_data_buffers.back().size() + size > m_max_data_buffer_size)
+        {
+            m_data_buffers.emplace_back();
+            m_data_buffers.back().reserve(std::max(size, std::min(initial_data_buffer_capacity, m_max_data_buffer_size)));
+        }
+        return m_data_buffers.back();
+    }
+}
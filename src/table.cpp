@@ -0,0 +1,196 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/table.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    auto table::nb_columns() const -> size_type
+    {
+        return m_column_list.size();
+    }
+
+    auto table::nb_rows() const -> size_type
+    {
+        return m_column_list.empty() ? size_type(0) : m_column_list.front().size();
+    }
+
+    bool table::contains_column(const name_type& key) const
+    {
+        return m_column_map.contains(key);
+    }
+
+    auto table::get_column_name(size_type index) const -> const name_type&
+    {
+        SPARROW_ASSERT_TRUE(index < nb_columns());
+        return m_name_list[index];
+    }
+
+    const chunked_array& table::get_column(const name_type& key) const
+    {
+        const auto iter = m_column_map.find(key);
+        if (iter == m_column_map.end())
+        {
+            throw std::out_of_range("Column's name not found in table");
+        }
+        return m_column_list[iter->second];
+    }
+
+    const chunked_array& table::get_column(size_type index) const
+    {
+        SPARROW_ASSERT_TRUE(index < nb_columns());
+        return m_column_list[index];
+    }
+
+    auto table::names() const -> name_range
+    {
+        return std::ranges::ref_view(m_name_list);
+    }
+
+    auto table::columns() const -> column_range
+    {
+        return std::ranges::ref_view(m_column_list);
+    }
+
+    void table::add_column(name_type name, chunked_array column)
+    {
+        m_name_list.push_back(std::move(name));
+        m_column_list.push_back(std::move(column));
+        try
+        {
+            update_column_map();
+        }
+        catch (...)
+        {
+            m_name_list.pop_back();
+            m_column_list.pop_back();
+            update_column_map();
+            throw;
+        }
+    }
+
+    void table::add_batch(const record_batch& batch)
+    {
+        if (m_column_list.empty())
+        {
+            for (std::size_t i = 0; i < batch.nb_columns(); ++i)
+            {
+                m_name_list.push_back(batch.get_column_name(i));
+                m_column_list.emplace_back(std::vector<array>{batch.get_column(i)});
+            }
+            update_column_map();
+            return;
+        }
+
+        if (!std::ranges::equal(batch.names(), m_name_list))
+        {
+            throw std::invalid_argument("table: the batch must have the columns of the table");
+        }
+        for (std::size_t i = 0; i < m_column_list.size(); ++i)
+        {
+            const chunked_array& column = m_column_list[i];
+            if (column.nb_chunks() != 0 && batch.get_column(i).data_type() != column.data_type())
+            {
+                throw std::invalid_argument("table: the columns of the batch must have the data types of the table");
+            }
+        }
+        for (std::size_t i = 0; i < m_column_list.size(); ++i)
+        {
+            m_column_list[i].add_chunk(batch.get_column(i));
+        }
+    }
+
+    void table::update_column_map()
+    {
+        if (m_name_list.size() != m_column_list.size())
+        {
+            throw std::invalid_argument("table: the number of names and of columns must be the same");
+        }
+        m_column_map.clear();
+        for (std::size_t i = 0; i < m_name_list.size(); ++i)
+        {
+            if (m_name_list[i].empty())
+            {
+                throw std::invalid_argument("table: a column can not have an empty name");
+            }
+            if (!m_column_map.try_emplace(m_name_list[i], i).second)
+            {
+                throw std::invalid_argument("table: the names of the columns must be unique");
+            }
+            if (m_column_list[i].size() != m_column_list.front().size())
+            {
+                throw std::invalid_argument("table: the columns of a table must have the same size");
+            }
+        }
+    }
+
+    bool operator==(const table& lhs, const table& rhs)
+    {
+        return std::ranges::equal(lhs.names(), rhs.names()) && std::ranges::equal(lhs.columns(), rhs.columns());
+    }
+
+    table concatenate(std::span<const table> tables)
+    {
+        // Tables without columns do not constrain the schema of the result
+        const auto first = std::ranges::find_if(
+            tables,
+            [](const table& t)
+            {
+                return t.nb_columns() != 0;
+            }
+        );
+        if (first == tables.end())
+        {
+            return table{};
+        }
+
+        for (const table& t : tables)
+        {
+            if (t.nb_columns() != 0 && !std::ranges::equal(t.names(), first->names()))
+            {
+                throw std::invalid_argument("concatenate: the tables must have the same columns");
+            }
+        }
+
+        table res;
+        res.m_name_list = first->m_name_list;
+        res.m_column_list.reserve(first->nb_columns());
+        for (std::size_t i = 0; i < first->nb_columns(); ++i)
+        {
+            std::size_t nb_chunks = 0;
+            for (const table& t : tables)
+            {
+                nb_chunks += t.nb_columns() != 0 ? t.get_column(i).nb_chunks() : 0;
+            }
+            std::vector<array> chunks;
+            chunks.reserve(nb_chunks);
+            for (const table& t : tables)
+            {
+                if (t.nb_columns() != 0)
+                {
+                    std::ranges::copy(t.get_column(i).chunks(), std::back_inserter(chunks));
+                }
+            }
+            res.m_column_list.emplace_back(std::move(chunks));
+        }
+        res.update_column_map();
+        return res;
+    }
+}
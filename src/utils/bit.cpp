@@ -0,0 +1,161 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/utils/bit.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#    define SPARROW_X86_POPCOUNT_DISPATCH 1
+#    include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#    define SPARROW_NEON_POPCOUNT 1
+#    include <arm_neon.h>
+#endif
+
+namespace sparrow
+{
+    namespace
+    {
+        using count_set_bits_function = std::size_t (*)(const std::uint8_t*, std::size_t) noexcept;
+
+        std::size_t count_set_bits_scalar(const std::uint8_t* data, std::size_t size) noexcept
+        {
+            std::size_t res = 0;
+            std::size_t i = 0;
+            for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                res += static_cast<std::size_t>(std::popcount(word));
+            }
+            for (; i < size; ++i)
+            {
+                res += static_cast<std::size_t>(std::popcount(data[i]));
+            }
+            return res;
+        }
+
+#if defined(SPARROW_X86_POPCOUNT_DISPATCH)
+
+        // Nibble lookup table popcount (Mula et al.), the per-byte counts are
+        // accumulated into 64-bit lanes with a sum of absolute differences.
+        __attribute__((target("avx2"))) std::size_t
+        count_set_bits_avx2(const std::uint8_t* data, std::size_t size) noexcept
+        {
+            constexpr std::size_t stride = sizeof(__m256i);
+            const __m256i lookup = _mm256_setr_epi8(
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+            );
+            const __m256i low_mask = _mm256_set1_epi8(0x0f);
+            const __m256i zero = _mm256_setzero_si256();
+            __m256i acc = zero;
+            std::size_t i = 0;
+            for (; i + stride <= size; i += stride)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i lo = _mm256_and_si256(v, low_mask);
+                const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+                const __m256i counts = _mm256_add_epi8(
+                    _mm256_shuffle_epi8(lookup, lo),
+                    _mm256_shuffle_epi8(lookup, hi)
+                );
+                acc = _mm256_add_epi64(acc, _mm256_sad_epu8(counts, zero));
+            }
+            alignas(32) std::uint64_t lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            const std::size_t res = static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+            return res + count_set_bits_scalar(data + i, size - i);
+        }
+
+        __attribute__((target("avx512f,avx512vpopcntdq"))) std::size_t
+        count_set_bits_avx512(const std::uint8_t* data, std::size_t size) noexcept
+        {
+            constexpr std::size_t stride = sizeof(__m512i);
+            __m512i acc = _mm512_setzero_si512();
+            std::size_t i = 0;
+            for (; i + stride <= size; i += stride)
+            {
+                const __m512i v = _mm512_loadu_si512(data + i);
+                acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+            }
+            alignas(64) std::uint64_t lanes[8];
+            _mm512_store_si512(lanes, acc);
+            std::size_t res = 0;
+            for (const std::uint64_t lane : lanes)
+            {
+                res += static_cast<std::size_t>(lane);
+            }
+            return res + count_set_bits_scalar(data + i, size - i);
+        }
+
+        count_set_bits_function select_count_set_bits() noexcept
+        {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512vpopcntdq"))
+            {
+                return &count_set_bits_avx512;
+            }
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return &count_set_bits_avx2;
+            }
+            return &count_set_bits_scalar;
+        }
+
+#elif defined(SPARROW_NEON_POPCOUNT)
+
+        std::size_t count_set_bits_neon(const std::uint8_t* data, std::size_t size) noexcept
+        {
+            constexpr std::size_t stride = sizeof(uint8x16_t);
+            uint64x2_t acc = vdupq_n_u64(0);
+            std::size_t i = 0;
+            for (; i + stride <= size; i += stride)
+            {
+                const uint8x16_t counts = vcntq_u8(vld1q_u8(data + i));
+                acc = vpadalq_u32(acc, vpaddlq_u16(vpaddlq_u8(counts)));
+            }
+            const std::size_t res = static_cast<std::size_t>(vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1));
+            return res + count_set_bits_scalar(data + i, size - i);
+        }
+
+        count_set_bits_function select_count_set_bits() noexcept
+        {
+            // NEON is part of the base AArch64 instruction set.
+            return &count_set_bits_neon;
+        }
+
+#else
+
+        count_set_bits_function select_count_set_bits() noexcept
+        {
+            return &count_set_bits_scalar;
+        }
+
+#endif
+    }
+
+    std::size_t count_set_bits(const std::uint8_t* data, std::size_t size) noexcept
+    {
+        // Below this size, the scalar loop is as fast as the vectorized ones.
+        constexpr std::size_t vectorization_threshold = 64;
+        if (size < vectorization_threshold)
+        {
+            return count_set_bits_scalar(data, size);
+        }
+        static const count_set_bits_function impl = select_count_set_bits();
+        return impl(data, size);
+    }
+}
@@ -0,0 +1,162 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/utils/thread_pool.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+
+namespace sparrow
+{
+    namespace
+    {
+        // Pool and queue of the worker running on the current thread, if any
+        thread_local const work_stealing_thread_pool* current_pool = nullptr;
+        thread_local std::size_t current_queue = 0;
+    }
+
+    struct work_stealing_thread_pool::worker_queue
+    {
+        std::mutex mutex;
+        std::deque<task_type> tasks;
+    };
+
+    work_stealing_thread_pool::work_stealing_thread_pool(std::size_t nb_threads)
+    {
+        nb_threads = std::max(nb_threads, std::size_t(1));
+        m_queues.reserve(nb_threads);
+        for (std::size_t i = 0; i < nb_threads; ++i)
+        {
+            m_queues.push_back(std::make_unique<worker_queue>());
+        }
+        m_threads.reserve(nb_threads);
+        for (std::size_t i = 0; i < nb_threads; ++i)
+        {
+            m_threads.emplace_back(
+                [this, i]
+                {
+                    run(i);
+                }
+            );
+        }
+    }
+
+    work_stealing_thread_pool::~work_stealing_thread_pool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    void work_stealing_thread_pool::submit(task_type task)
+    {
+        std::size_t index = 0;
+        if (current_pool == this)
+        {
+            index = current_queue;
+        }
+        else
+        {
+            std::lock_guard lock(m_mutex);
+            index = m_next_queue;
+            m_next_queue = (m_next_queue + 1) % m_queues.size();
+        }
+        {
+            std::lock_guard lock(m_queues[index]->mutex);
+            m_queues[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard lock(m_mutex);
+            ++m_pending;
+        }
+        m_condition.notify_one();
+    }
+
+    std::size_t work_stealing_thread_pool::concurrency() const
+    {
+        return m_threads.size();
+    }
+
+    void work_stealing_thread_pool::run(std::size_t index)
+    {
+        current_pool = this;
+        current_queue = index;
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(
+                    lock,
+                    [this]
+                    {
+                        return m_stop || m_pending != 0;
+                    }
+                );
+                if (m_pending == 0)
+                {
+                    return;
+                }
+                // Reserves one of the queued tasks for this worker
+                --m_pending;
+            }
+            task_type task = pop_task(index);
+            task();
+        }
+    }
+
+    auto work_stealing_thread_pool::pop_task(std::size_t index) -> task_type
+    {
+        // A task is pushed before it is counted as pending, and each worker
+        // reserves a pending task before popping one, hence this loop only
+        // spins while a concurrent submit is between these two steps.
+        while (true)
+        {
+            {
+                worker_queue& own = *m_queues[index];
+                std::lock_guard lock(own.mutex);
+                if (!own.tasks.empty())
+                {
+                    task_type task = std::move(own.tasks.back());
+                    own.tasks.pop_back();
+                    return task;
+                }
+            }
+            for (std::size_t i = 1; i < m_queues.size(); ++i)
+            {
+                worker_queue& victim = *m_queues[(index + i) % m_queues.size()];
+                std::lock_guard lock(victim.mutex);
+                if (!victim.tasks.empty())
+                {
+                    task_type task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    return task;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    thread_pool& default_thread_pool()
+    {
+        static work_stealing_thread_pool pool;
+        return pool;
+    }
+}
@@ -0,0 +1,109 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/buffer/aligned_allocator.hpp"
+#include "sparrow/buffer/allocator.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    TEST_SUITE("aligned_allocator")
+    {
+        TEST_CASE("padded_size")
+        {
+            CHECK_EQ(padded_size(0), 0u);
+            CHECK_EQ(padded_size(1), 64u);
+            CHECK_EQ(padded_size(64), 64u);
+            CHECK_EQ(padded_size(65), 128u);
+            CHECK_EQ(padded_size(5, 4), 8u);
+        }
+
+        TEST_CASE("allocate")
+        {
+            aligned_allocator<std::int32_t> alloc;
+            for (std::size_t n : {1u, 15u, 16u, 17u, 100u})
+            {
+                std::int32_t* p = alloc.allocate(n);
+                CHECK(is_aligned(p));
+                std::iota(p, p + n, 0);
+                const auto* bytes = reinterpret_cast<const std::uint8_t*>(p);
+                for (std::size_t i = n * sizeof(std::int32_t); i < padded_size(n * sizeof(std::int32_t)); ++i)
+                {
+                    CHECK_EQ(bytes[i], 0u);
+                }
+                alloc.deallocate(p, n);
+            }
+
+            aligned_allocator<std::uint8_t> other(alloc);
+            CHECK(alloc == other);
+        }
+
+        TEST_CASE("buffer")
+        {
+            buffer<std::int32_t> b(std::size_t(10), 3, aligned_allocator<std::int32_t>());
+            CHECK(is_aligned(b.data()));
+            b.resize(1000, 2);
+            CHECK(is_aligned(b.data()));
+            CHECK_EQ(b[999], 2);
+
+            buffer<std::int32_t> copy(b);
+            CHECK(is_aligned(copy.data()));
+
+            u8_buffer<double> u8b(7, 1.5, aligned_allocator<std::uint8_t>());
+            CHECK(is_aligned(u8b.data()));
+            CHECK_EQ(u8b[6], 1.5);
+        }
+
+        TEST_CASE("any_allocator")
+        {
+            any_allocator<std::int32_t> a(aligned_allocator<std::int32_t>{});
+            any_allocator<std::int32_t> b(aligned_allocator<std::int32_t>{});
+            CHECK(a == b);
+            CHECK_FALSE(a == any_allocator<std::int32_t>(std::allocator<std::int32_t>()));
+
+            std::int32_t* p = a.allocate(3);
+            CHECK(is_aligned(p));
+            b.deallocate(p, 3);
+        }
+
+        TEST_CASE("is_arrow_aligned")
+        {
+            alignas(64) std::uint8_t storage[256] = {};
+            const void* buffers[] = {nullptr, storage, storage + 128};
+            ArrowArray child{};
+            child.n_buffers = 3;
+            child.buffers = buffers;
+
+            ArrowArray* children[] = {&child};
+            ArrowArray parent{};
+            parent.n_buffers = 1;
+            parent.buffers = buffers;
+            parent.n_children = 1;
+            parent.children = children;
+            CHECK(is_arrow_aligned(parent));
+
+            buffers[2] = storage + 8;
+            CHECK_FALSE(is_arrow_aligned(parent));
+            CHECK(is_arrow_aligned(parent, 8));
+        }
+    }
+}
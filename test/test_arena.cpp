@@ -0,0 +1,200 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/buffer/arena.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    TEST_SUITE("arena")
+    {
+        TEST_CASE("allocate")
+        {
+            arena a(128);
+            CHECK_EQ(a.allocated_bytes(), 0u);
+            CHECK_EQ(a.reserved_bytes(), 0u);
+
+            void* p1 = a.allocate(3, 1);
+            void* p2 = a.allocate(8, 8);
+            CHECK_NE(p1, p2);
+            CHECK_EQ(reinterpret_cast<std::uintptr_t>(p2) % 8, 0u);
+            CHECK_GE(a.allocated_bytes(), 11u);
+            CHECK_EQ(a.reserved_bytes(), 128u);
+
+            SUBCASE("larger than a chunk")
+            {
+                void* p3 = a.allocate(1000, 64);
+                CHECK_EQ(reinterpret_cast<std::uintptr_t>(p3) % 64, 0u);
+                CHECK_GE(a.reserved_bytes(), 1128u);
+            }
+        }
+
+        TEST_CASE("deallocate")
+        {
+            arena a(128);
+            void* p1 = a.allocate(16, 8);
+            void* p2 = a.allocate(16, 8);
+            const std::size_t allocated = a.allocated_bytes();
+
+            // Only the last block allocated is reclaimed
+            a.deallocate(p1, 16);
+            CHECK_EQ(a.allocated_bytes(), allocated);
+            a.deallocate(p2, 16);
+            CHECK_EQ(a.allocated_bytes(), allocated - 16);
+            CHECK_EQ(a.allocate(16, 8), p2);
+        }
+
+        TEST_CASE("concurrent allocations")
+        {
+            arena a(256);
+            constexpr std::size_t thread_count = 4;
+            constexpr std::size_t block_count = 1000;
+            std::vector<std::vector<void*>> blocks(thread_count);
+            {
+                std::vector<std::thread> threads;
+                for (std::size_t t = 0; t < thread_count; ++t)
+                {
+                    threads.emplace_back(
+                        [&a, &blocks, t]()
+                        {
+                            for (std::size_t i = 0; i < block_count; ++i)
+                            {
+                                blocks[t].push_back(a.allocate(8, 8));
+                            }
+                        }
+                    );
+                }
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+            }
+            CHECK_EQ(a.allocated_bytes(), thread_count * block_count * 8);
+            std::vector<void*> all_blocks;
+            for (const auto& b : blocks)
+            {
+                all_blocks.insert(all_blocks.end(), b.begin(), b.end());
+            }
+            std::ranges::sort(all_blocks);
+            CHECK_EQ(std::ranges::adjacent_find(all_blocks), all_blocks.end());
+        }
+
+        TEST_CASE("arena_allocator")
+        {
+            auto a = std::make_shared<arena>();
+            arena_allocator<int> alloc(a);
+            arena_allocator<double> other(alloc);
+            CHECK(alloc == other);
+            CHECK_FALSE(alloc == arena_allocator<int>(std::make_shared<arena>()));
+
+            int* p = alloc.allocate(10);
+            std::iota(p, p + 10, 0);
+            CHECK_EQ(p[9], 9);
+            alloc.deallocate(p, 10);
+        }
+
+        TEST_CASE("buffer")
+        {
+            auto a = std::make_shared<arena>();
+            std::weak_ptr<arena> observer = a;
+            {
+                buffer<std::int32_t> b(std::size_t(16), 4, arena_allocator<std::int32_t>(a));
+                CHECK_EQ(b[15], 4);
+                CHECK_GE(a->allocated_bytes(), 16 * sizeof(std::int32_t));
+
+                // Copies are not allocated in the arena
+                std::size_t allocated = a->allocated_bytes();
+                buffer<std::int32_t> copy(b);
+                CHECK_EQ(a->allocated_bytes(), allocated);
+                CHECK_EQ(copy[15], 4);
+
+                allocated = a->allocated_bytes();
+                u8_buffer<std::int64_t> u8b(8, 2, arena_allocator<std::uint8_t>(a));
+                CHECK_EQ(u8b[7], 2);
+                CHECK_GE(a->allocated_bytes(), allocated + 8 * sizeof(std::int64_t));
+
+                a.reset();
+                CHECK_FALSE(observer.expired());
+            }
+            CHECK(observer.expired());
+        }
+
+        TEST_CASE("arena_scope")
+        {
+            auto a = std::make_shared<arena>();
+            std::weak_ptr<arena> observer = a;
+            CHECK_EQ(current_arena(), nullptr);
+            {
+                arena_scope scope(a);
+                CHECK_EQ(current_arena(), a);
+                {
+                    auto b = std::make_shared<arena>();
+                    arena_scope nested(b);
+                    CHECK_EQ(current_arena(), b);
+                }
+                CHECK_EQ(current_arena(), a);
+
+                const std::size_t allocated = a->allocated_bytes();
+                buffer<std::int32_t> b(std::size_t(4), 1);
+                CHECK_GE(a->allocated_bytes(), allocated + 4 * sizeof(std::int32_t));
+                CHECK(any_allocator<std::int32_t>() == any_allocator<std::int32_t>(arena_allocator<std::int32_t>(a)));
+            }
+            CHECK_EQ(current_arena(), nullptr);
+            CHECK(any_allocator<std::int32_t>() == any_allocator<std::int32_t>(std::allocator<std::int32_t>()));
+            a.reset();
+            CHECK(observer.expired());
+        }
+
+        TEST_CASE("array built in an arena")
+        {
+            auto a = std::make_shared<arena>();
+            std::weak_ptr<arena> observer = a;
+            std::vector<std::int32_t> values(100);
+            std::iota(values.begin(), values.end(), 0);
+
+            ArrowArray arrow_array{};
+            ArrowSchema arrow_schema{};
+            {
+                arena_scope scope(a);
+                primitive_array<std::int32_t> pa(values);
+                std::tie(arrow_array, arrow_schema) = extract_arrow_structures(std::move(pa));
+            }
+            const std::size_t allocated = a->allocated_bytes();
+            CHECK_GE(allocated, values.size() * sizeof(std::int32_t));
+            a.reset();
+            CHECK_FALSE(observer.expired());
+
+            {
+                const primitive_array<std::int32_t> pa(arrow_proxy(&arrow_array, &arrow_schema));
+                CHECK_EQ(pa[99].value(), 99);
+            }
+            arrow_array.release(&arrow_array);
+            CHECK_FALSE(observer.expired());
+            arrow_schema.release(&arrow_schema);
+            CHECK(observer.expired());
+        }
+    }
+}
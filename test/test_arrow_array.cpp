@@ -33,10 +33,8 @@ void check_equal(const ArrowArray& lhs, const ArrowArray& rhs)
     CHECK_EQ(lhs.n_children, rhs.n_children);
     CHECK_NE(lhs.buffers, rhs.buffers);
     CHECK_NE(lhs.private_data, rhs.private_data);
-    for (size_t i = 0; i < static_cast<size_t>(lhs.n_buffers); ++i)
-    {
-        CHECK_NE(lhs.buffers[i], rhs.buffers[i]);
-    }
+    // The buffers of arrays created by sparrow are shared by the copies
+    // until one of them is modified, so only their content is compared
     auto lhs_buffers = reinterpret_cast<const int8_t**>(lhs.buffers);
     auto rhs_buffers = reinterpret_cast<const int8_t**>(rhs.buffers);
 
@@ -13,7 +13,11 @@
 // limitations under the License.
 
 
+#include <algorithm>
+#include <cstdint>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "sparrow/arrow_array_schema_proxy.hpp"
 #include "sparrow/buffer/dynamic_bitset.hpp"
@@ -535,6 +539,44 @@ TEST_SUITE("ArrowArrowSchemaProxy")
         CHECK_EQ(proxy_ext.private_data(), nullptr);
     }
 
+    TEST_CASE("copy on write")
+    {
+        auto [array, schema] = test::make_arrow_schema_and_array(false);
+        sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+        std::vector<const std::uint8_t*> data_pointers;
+        for (const auto& buffer : proxy.buffers())
+        {
+            data_pointers.push_back(buffer.data());
+        }
+        const sparrow::arrow_proxy copy(std::as_const(proxy));
+        sparrow::arrow_proxy slice = proxy.slice(1, 3);
+        REQUIRE_EQ(copy.buffers().size(), proxy.buffers().size());
+        for (std::size_t i = 0; i < proxy.buffers().size(); ++i)
+        {
+            CHECK_EQ(copy.buffers()[i].data(), proxy.buffers()[i].data());
+            CHECK_EQ(slice.buffers()[i].data(), proxy.buffers()[i].data());
+            // Copying does not modify the buffers of the source
+            CHECK_EQ(proxy.buffers()[i].data(), data_pointers[i]);
+        }
+
+        const std::vector<std::uint8_t> values(proxy.buffers()[1].begin(), proxy.buffers()[1].end());
+        CHECK(slice.detach_buffers());
+        CHECK_FALSE(slice.detach_buffers());
+        CHECK_NE(slice.buffers()[1].data(), proxy.buffers()[1].data());
+        const auto slice_values = slice.buffers()[1];
+        CHECK(std::equal(slice_values.begin(), slice_values.end(), values.begin()));
+
+        // Modifying the bitmap of the array leaves the copy unchanged
+        const std::vector<std::uint8_t> bitmap(copy.buffers()[0].begin(), copy.buffers()[0].end());
+        proxy.resize_bitmap(20, false);
+        CHECK_NE(proxy.buffers()[0].data(), copy.buffers()[0].data());
+        CHECK(std::ranges::equal(copy.buffers()[0], bitmap));
+
+        auto [array_ext, schema_ext] = make_external_arrow_schema_and_array();
+        sparrow::arrow_proxy proxy_ext(std::move(array_ext), std::move(schema_ext));
+        CHECK_FALSE(proxy_ext.detach_buffers());
+    }
+
     TEST_CASE("resize_bitmap")
     {
         SUBCASE("on sparrow c structure")
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cstdint>
+#include <vector>
 
 #include "sparrow/utils/bit.hpp"
 
@@ -103,5 +104,44 @@ namespace sparrow
                 }
             }
         }
+
+        TEST_CASE("count_set_bits")
+        {
+            SUBCASE("empty")
+            {
+                CHECK_EQ(count_set_bits(nullptr, 0), 0u);
+            }
+
+            SUBCASE("various sizes")
+            {
+                // Sizes around the word and vector widths to exercise the
+                // vectorized loops as well as their scalar tails.
+                std::vector<std::uint8_t> data(523);
+                for (std::size_t i = 0; i < data.size(); ++i)
+                {
+                    data[i] = static_cast<std::uint8_t>(i * 37u + 11u);
+                }
+                for (const std::size_t size : {1u, 7u, 8u, 31u, 63u, 64u, 65u, 128u, 200u, 523u})
+                {
+                    std::size_t expected = 0;
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        expected += static_cast<std::size_t>(std::popcount(data[i]));
+                    }
+                    CHECK_EQ(count_set_bits(data.data(), size), expected);
+                    if (size > 1)
+                    {
+                        std::size_t expected_unaligned = expected - static_cast<std::size_t>(std::popcount(data[0]));
+                        CHECK_EQ(count_set_bits(data.data() + 1, size - 1), expected_unaligned);
+                    }
+                }
+            }
+
+            SUBCASE("all set")
+            {
+                const std::vector<std::uint8_t> data(1000, 0xFF);
+                CHECK_EQ(count_set_bits(data.data(), data.size()), 8000u);
+            }
+        }
     }
-}
\ No newline at end of file
+}
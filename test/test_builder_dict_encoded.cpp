@@ -13,11 +13,14 @@
 // limitations under the License.
 
 #include <array>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 #include <variant>
 #include <vector>
 
 #include "sparrow/builder/builder.hpp"
+#include "sparrow/builder/dictionary_builder.hpp"
 
 #include "test_utils.hpp"
 
@@ -357,5 +360,80 @@ namespace sparrow
                 }
             }
         }
+
+        TEST_CASE("dict-encoded high cardinality")
+        {
+            // 1000 distinct strings, each appearing 3 times
+            std::vector<std::string> input;
+            for (int round = 0; round < 3; ++round)
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    input.push_back("value-" + std::to_string(i));
+                }
+            }
+            dict_encode<std::vector<std::string>> v{input};
+            auto arr = sparrow::build(v);
+            REQUIRE_EQ(arr.size(), input.size());
+            for (std::size_t i = 0; i < input.size(); i += 97)
+            {
+                CHECK_NULLABLE_VARIANT_EQ(arr[i], std::string_view(input[i]));
+            }
+            const auto* key_data = static_cast<const std::uint64_t*>(
+                detail::array_access::get_arrow_proxy(arr).array().buffers[1]
+            );
+            CHECK_EQ(key_data[0], 0);
+            CHECK_EQ(key_data[999], 999);
+            CHECK_EQ(key_data[1000], 0);
+            CHECK_EQ(key_data[2999], 999);
+        }
+
+        TEST_CASE("dictionary_builder")
+        {
+            SUBCASE("batches")
+            {
+                dictionary_builder<nullable<std::string>> builder;
+                builder.append(std::vector<nullable<std::string>>{"red", "green", nullval});
+                builder.push_back("green");
+                builder.append(std::vector<nullable<std::string>>{"blue", nullval, "red"});
+                CHECK_EQ(builder.size(), 7);
+                CHECK_EQ(builder.dictionary_size(), 4);
+
+                auto arr = builder.finish();
+                test::generic_consistency_test(arr);
+                REQUIRE_EQ(arr.size(), 7);
+                CHECK_NULLABLE_VARIANT_EQ(arr[0], std::string_view("red"));
+                CHECK_NULLABLE_VARIANT_EQ(arr[1], std::string_view("green"));
+                CHECK(!arr[2].has_value());
+                CHECK_NULLABLE_VARIANT_EQ(arr[3], std::string_view("green"));
+                CHECK_NULLABLE_VARIANT_EQ(arr[4], std::string_view("blue"));
+                CHECK(!arr[5].has_value());
+                CHECK_NULLABLE_VARIANT_EQ(arr[6], std::string_view("red"));
+
+                // finish resets the builder
+                CHECK_EQ(builder.size(), 0);
+                CHECK_EQ(builder.dictionary_size(), 0);
+                builder.push_back("blue");
+                auto arr2 = builder.finish();
+                REQUIRE_EQ(arr2.size(), 1);
+                CHECK_NULLABLE_VARIANT_EQ(arr2[0], std::string_view("blue"));
+            }
+
+            SUBCASE("key type")
+            {
+                dictionary_builder<int, std::uint8_t> builder;
+                for (int i = 0; i < 256; ++i)
+                {
+                    builder.push_back(i);
+                }
+                builder.push_back(255);
+                CHECK_THROWS_AS(builder.push_back(256), std::overflow_error);
+
+                auto arr = builder.finish();
+                static_assert(std::is_same_v<decltype(arr), dictionary_encoded_array<std::uint8_t>>);
+                REQUIRE_EQ(arr.size(), 257);
+                CHECK_NULLABLE_VARIANT_EQ(arr[256], 255);
+            }
+        }
     }
 }
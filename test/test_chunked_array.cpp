@@ -0,0 +1,212 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "sparrow/chunked_array.hpp"
+#include "sparrow/layout/list_layout/list_array.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        array make_chunk(std::int32_t first, std::size_t size)
+        {
+            std::vector<nullable<std::int32_t>> values;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                std::int32_t value = first + static_cast<std::int32_t>(i);
+                values.push_back(nullable<std::int32_t>(value, value % 5 != 0));
+            }
+            return array(primitive_array<std::int32_t>(values));
+        }
+
+        // Chunks of sizes 3, 0, 4, 1, holding the values 1 to 8
+        chunked_array make_chunked_array()
+        {
+            std::vector<array> chunks;
+            chunks.push_back(make_chunk(1, 3));
+            chunks.push_back(make_chunk(4, 0));
+            chunks.push_back(make_chunk(4, 4));
+            chunks.push_back(make_chunk(8, 1));
+            return chunked_array(std::move(chunks));
+        }
+
+        std::int32_t value_at(const chunked_array::const_reference& ref)
+        {
+            return std::get<nullable<const std::int32_t&>>(ref).get();
+        }
+
+        bool has_value(const chunked_array::const_reference& ref)
+        {
+            return std::visit(
+                [](const auto& v)
+                {
+                    return v.has_value();
+                },
+                ref
+            );
+        }
+    }
+
+    TEST_SUITE("chunked_array")
+    {
+        TEST_CASE("constructor")
+        {
+            const chunked_array empty;
+            CHECK_EQ(empty.size(), 0);
+            CHECK(empty.empty());
+            CHECK_EQ(empty.nb_chunks(), 0);
+            CHECK(empty.begin() == empty.end());
+
+            const chunked_array ar = make_chunked_array();
+            CHECK_EQ(ar.size(), 8);
+            CHECK_EQ(ar.nb_chunks(), 4);
+            CHECK_EQ(ar.data_type(), data_type::INT32);
+            CHECK(std::ranges::equal(ar.chunk_offsets(), std::vector<std::size_t>{0, 3, 3, 7, 8}));
+            CHECK_EQ(ar.chunk(2).size(), 4);
+
+            std::vector<array> mixed;
+            mixed.push_back(make_chunk(0, 2));
+            mixed.push_back(array(string_array(std::vector<std::string>{"a"})));
+            CHECK_THROWS_AS(chunked_array(std::move(mixed)), std::invalid_argument);
+        }
+
+        TEST_CASE("indexing")
+        {
+            const chunked_array ar = make_chunked_array();
+            CHECK_EQ(ar.locate(0), std::pair<std::size_t, std::size_t>{0, 0});
+            CHECK_EQ(ar.locate(2), std::pair<std::size_t, std::size_t>{0, 2});
+            // The empty chunk is skipped
+            CHECK_EQ(ar.locate(3), std::pair<std::size_t, std::size_t>{2, 0});
+            CHECK_EQ(ar.locate(7), std::pair<std::size_t, std::size_t>{3, 0});
+
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                const auto expected = static_cast<std::int32_t>(i + 1);
+                CHECK_EQ(has_value(ar[i]), expected % 5 != 0);
+                if (expected % 5 != 0)
+                {
+                    CHECK_EQ(value_at(ar[i]), expected);
+                }
+            }
+            CHECK_EQ(value_at(ar.at(7)), 8);
+            CHECK_THROWS_AS(std::ignore = ar.at(8), std::out_of_range);
+        }
+
+        TEST_CASE("iterator")
+        {
+            const chunked_array ar = make_chunked_array();
+            CHECK_EQ(std::distance(ar.begin(), ar.end()), 8);
+
+            std::int32_t expected = 1;
+            for (const auto& value : ar)
+            {
+                if (expected % 5 != 0)
+                {
+                    CHECK_EQ(value_at(value), expected);
+                }
+                ++expected;
+            }
+
+            auto iter = ar.end();
+            --iter;
+            CHECK_EQ(value_at(*iter), 8);
+            --iter;
+            --iter;
+            CHECK_EQ(value_at(*iter), 6);
+            iter -= 3;
+            CHECK_EQ(value_at(*iter), 3);
+            iter += 1;
+            CHECK_EQ(value_at(*iter), 4);
+            CHECK_EQ(value_at(ar.begin()[6]), 7);
+            CHECK(ar.begin() < iter);
+            CHECK_EQ(iter - ar.begin(), 3);
+        }
+
+        TEST_CASE("add_chunk")
+        {
+            chunked_array ar = make_chunked_array();
+            ar.add_chunk(make_chunk(9, 2));
+            CHECK_EQ(ar.size(), 10);
+            CHECK_EQ(ar.nb_chunks(), 5);
+            CHECK_EQ(value_at(ar[9]), 10);
+            CHECK_THROWS_AS(ar.add_chunk(array(string_array(std::vector<std::string>{"a"}))), std::invalid_argument);
+            CHECK_EQ(ar.nb_chunks(), 5);
+            CHECK_EQ(ar.size(), 10);
+        }
+
+        TEST_CASE("nested chunks")
+        {
+            // Both chunks are lists, the types of their values differ
+            const auto make_list = []<class T>(std::vector<T> values)
+            {
+                const std::size_t n = values.size();
+                return array(list_array(
+                    array(primitive_array<T>(std::move(values))),
+                    list_array::offset_from_sizes(std::vector<std::size_t>{n})
+                ));
+            };
+            chunked_array ar;
+            ar.add_chunk(make_list(std::vector<std::int32_t>{1, 2}));
+            ar.add_chunk(make_list(std::vector<std::int32_t>{3}));
+            CHECK_EQ(ar.size(), 2);
+            CHECK_THROWS_AS(ar.add_chunk(make_list(std::vector<double>{1.5})), std::invalid_argument);
+            CHECK_EQ(ar.nb_chunks(), 2);
+
+            std::vector<array> mixed;
+            mixed.push_back(make_list(std::vector<std::int32_t>{1, 2}));
+            mixed.push_back(make_list(std::vector<double>{1.5}));
+            CHECK_THROWS_AS(chunked_array(std::move(mixed)), std::invalid_argument);
+        }
+
+        TEST_CASE("equality")
+        {
+            const chunked_array ar = make_chunked_array();
+            const chunked_array single(std::vector<array>{make_chunk(1, 8)});
+            CHECK(ar == single);
+            const chunked_array other(std::vector<array>{make_chunk(2, 8)});
+            CHECK(ar != other);
+        }
+
+        TEST_CASE("concatenate")
+        {
+            const std::vector<chunked_array> arrays = {
+                make_chunked_array(),
+                chunked_array(),
+                chunked_array(std::vector<array>{make_chunk(9, 3)})
+            };
+            const chunked_array res = concatenate(arrays);
+            CHECK_EQ(res.nb_chunks(), 5);
+            CHECK_EQ(res.size(), 11);
+            CHECK(res == chunked_array(std::vector<array>{make_chunk(1, 11)}));
+
+            const std::vector<chunked_array> mixed = {
+                make_chunked_array(),
+                chunked_array(std::vector<array>{array(string_array(std::vector<std::string>{"a"}))})
+            };
+            CHECK_THROWS_AS(std::ignore = concatenate(mixed), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,224 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "sparrow/compute/aggregate.hpp"
+#include "sparrow/layout/temporal/date_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Every third value is null
+        template <class T>
+        std::vector<nullable<T>> make_values(std::size_t count)
+        {
+            std::vector<nullable<T>> values;
+            values.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                values.push_back(nullable<T>(static_cast<T>(static_cast<int>(i % 50) - 20), i % 3 != 0));
+            }
+            return values;
+        }
+
+        template <class T>
+        struct expected_aggregates
+        {
+            std::size_t valid = 0;
+            double sum = 0.;
+            std::optional<T> min;
+            std::optional<T> max;
+        };
+
+        template <class T>
+        expected_aggregates<T> compute_expected(const std::vector<nullable<T>>& values, std::size_t first, std::size_t last)
+        {
+            expected_aggregates<T> res;
+            for (std::size_t i = first; i < last; ++i)
+            {
+                if (!values[i].has_value())
+                {
+                    continue;
+                }
+                const T v = values[i].value();
+                ++res.valid;
+                res.sum += static_cast<double>(v);
+                res.min = res.min.has_value() && !(v < *res.min) ? res.min : std::optional<T>(v);
+                res.max = res.max.has_value() && !(*res.max < v) ? res.max : std::optional<T>(v);
+            }
+            return res;
+        }
+    }
+
+    using numeric_types = std::tuple<std::int8_t, std::uint16_t, std::int32_t, std::int64_t, float16_t, float, double>;
+
+    TEST_SUITE("compute_aggregate")
+    {
+        TEST_CASE_TEMPLATE_DEFINE("primitive_array", T, primitive_array_id)
+        {
+            const std::size_t size = 300;
+            const auto values = make_values<T>(size);
+            const primitive_array<T> ar(values);
+
+            // The slice starts in the middle of a byte of the bitmap and ends
+            // in the middle of a 64-bit block
+            const std::size_t first = 5;
+            const std::size_t last = 250;
+            const primitive_array<T> slice = ar.slice(first, last);
+
+            for (auto [array, f, l] : {std::tuple{&ar, std::size_t(0), size}, std::tuple{&slice, first, last}})
+            {
+                const auto expected = compute_expected(values, f, l);
+                CHECK_EQ(compute::count(*array), expected.valid);
+                CHECK_EQ(compute::count(*array, compute::count_mode::only_null), l - f - expected.valid);
+                CHECK_EQ(compute::count(*array, compute::count_mode::all), l - f);
+
+                const auto sum = compute::sum(*array);
+                REQUIRE(sum.has_value());
+                CHECK_EQ(static_cast<double>(*sum), doctest::Approx(expected.sum));
+
+                const auto mean = compute::mean(*array);
+                REQUIRE(mean.has_value());
+                CHECK_EQ(*mean, doctest::Approx(expected.sum / static_cast<double>(expected.valid)));
+
+                const auto min = compute::min(*array);
+                REQUIRE(min.has_value());
+                CHECK_EQ(*min, *expected.min);
+
+                const auto max = compute::max(*array);
+                REQUIRE(max.has_value());
+                CHECK_EQ(*max, *expected.max);
+            }
+        }
+
+        TEST_CASE_TEMPLATE_APPLY(primitive_array_id, numeric_types);
+
+        TEST_CASE("chunks")
+        {
+            const auto values = make_values<std::int32_t>(200);
+            std::vector<primitive_array<std::int32_t>> chunks;
+            chunks.emplace_back(std::vector<nullable<std::int32_t>>(values.begin(), values.begin() + 70));
+            chunks.emplace_back(std::vector<nullable<std::int32_t>>(values.begin() + 70, values.begin() + 71));
+            chunks.emplace_back(std::vector<nullable<std::int32_t>>(values.begin() + 71, values.end()));
+
+            const auto expected = compute_expected(values, 0, values.size());
+            CHECK_EQ(compute::count(chunks), expected.valid);
+            CHECK_EQ(compute::count(chunks, compute::count_mode::all), values.size());
+            CHECK_EQ(compute::sum(chunks), static_cast<std::int64_t>(expected.sum));
+            CHECK_EQ(compute::min(chunks), expected.min);
+            CHECK_EQ(compute::max(chunks), expected.max);
+            CHECK_EQ(*compute::mean(chunks), doctest::Approx(expected.sum / static_cast<double>(expected.valid)));
+        }
+
+        TEST_CASE("empty and all null")
+        {
+            const primitive_array<double> empty(std::vector<double>{});
+            CHECK_EQ(compute::count(empty), 0);
+            CHECK_FALSE(compute::sum(empty).has_value());
+            CHECK_FALSE(compute::mean(empty).has_value());
+            CHECK_FALSE(compute::min(empty).has_value());
+
+            const primitive_array<double> all_null(std::vector<nullable<double>>(100, nullable<double>(1., false)));
+            CHECK_EQ(compute::count(all_null), 0);
+            CHECK_EQ(compute::count(all_null, compute::count_mode::only_null), 100);
+            CHECK_FALSE(compute::sum(all_null).has_value());
+            CHECK_FALSE(compute::max(all_null).has_value());
+        }
+
+        TEST_CASE("NaN")
+        {
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            const primitive_array<double> ar(std::vector<double>{nan, 3., nan, -1., 2.});
+            CHECK_EQ(compute::min(ar), -1.);
+            CHECK_EQ(compute::max(ar), 3.);
+
+            const primitive_array<double> all_nan(std::vector<double>{nan, nan});
+            const auto min = compute::min(all_nan);
+            REQUIRE(min.has_value());
+            CHECK(std::isnan(*min));
+        }
+
+        TEST_CASE("duration_array")
+        {
+            using std::chrono::seconds;
+            const duration_array<seconds> ar(
+                std::vector<nullable<seconds>>{seconds(4), nullable<seconds>(seconds(100), false), seconds(-2), seconds(9)}
+            );
+            CHECK_EQ(compute::sum(ar), seconds(11));
+            CHECK_EQ(compute::min(ar), seconds(-2));
+            CHECK_EQ(compute::max(ar), seconds(9));
+        }
+
+        TEST_CASE("date_array")
+        {
+            const date_days_array ar(std::vector<date_days>{
+                date_days(chrono::days(10)),
+                date_days(chrono::days(3)),
+                date_days(chrono::days(42))
+            });
+            CHECK_EQ(compute::min(ar), date_days(chrono::days(3)));
+            CHECK_EQ(compute::max(ar), date_days(chrono::days(42)));
+        }
+
+        TEST_CASE("timestamp_array")
+        {
+            using timestamp_type = timestamp<std::chrono::seconds>;
+            const date::time_zone* new_york = date::locate_zone("America/New_York");
+            const auto make_timestamp = [new_york](std::int64_t s)
+            {
+                return timestamp_type(new_york, std::chrono::sys_seconds(std::chrono::seconds(s)));
+            };
+            const timestamp_array<timestamp_type> ar(
+                new_york,
+                std::vector<nullable<timestamp_type>>{
+                    make_timestamp(100),
+                    nullable<timestamp_type>(make_timestamp(1), false),
+                    make_timestamp(7),
+                    make_timestamp(300)
+                }
+            );
+            const auto min = compute::min(ar);
+            REQUIRE(min.has_value());
+            CHECK_EQ(min->get_sys_time(), make_timestamp(7).get_sys_time());
+            const auto max = compute::max(ar);
+            REQUIRE(max.has_value());
+            CHECK_EQ(max->get_sys_time(), make_timestamp(300).get_sys_time());
+        }
+
+        TEST_CASE("decimal_array")
+        {
+            u8_buffer<std::int64_t> buffer{std::int64_t(125), std::int64_t(-30), std::int64_t(7), std::int64_t(1000)};
+            const decimal_array<decimal<std::int64_t>> ar{std::move(buffer), std::size_t(6), 2};
+
+            const auto sum = compute::sum(ar);
+            REQUIRE(sum.has_value());
+            CHECK_EQ(sum->storage(), 1102);
+            CHECK_EQ(sum->scale(), 2);
+            CHECK_EQ(*compute::mean(ar), doctest::Approx(11.02 / 4.));
+
+            const auto min = compute::min(ar);
+            REQUIRE(min.has_value());
+            CHECK_EQ(min->storage(), -30);
+            CHECK_EQ(compute::max(ar)->storage(), 1000);
+        }
+    }
+}
@@ -0,0 +1,193 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/compute/compact.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        std::vector<buffer_view<std::uint8_t>> data_buffers(const string_view_array& ar)
+        {
+            const auto& buffers = detail::array_access::get_arrow_proxy(ar).buffers();
+            return {buffers.begin() + 2, buffers.end() - 1};
+        }
+
+        std::size_t data_size(const string_view_array& ar)
+        {
+            std::size_t res = 0;
+            for (const auto& data : data_buffers(ar))
+            {
+                res += data.size();
+            }
+            return res;
+        }
+
+        std::vector<std::optional<std::string>> values_of(const string_view_array& ar)
+        {
+            std::vector<std::optional<std::string>> res;
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                res.push_back(ar[i].has_value() ? std::optional<std::string>(std::string(ar[i].value())) : std::nullopt);
+            }
+            return res;
+        }
+
+        // Values of 20 bytes, 10 per data buffer
+        std::vector<std::string> make_words(std::size_t n)
+        {
+            std::vector<std::string> res;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                res.push_back("word number " + std::to_string(1000000 + i) + "#");
+            }
+            return res;
+        }
+    }
+
+    TEST_SUITE("compute_compact")
+    {
+        TEST_CASE("sliced array")
+        {
+            const std::vector<std::string> words = make_words(40);
+            const string_view_array full(words, std::vector<std::size_t>{3, 10, 35}, std::size_t(200));
+            REQUIRE_EQ(data_buffers(full).size(), 4);
+
+            // The first and the third data buffers are sparse, the second
+            // one is dense and the last one is not referenced anymore
+            const string_view_array sliced = full.slice(8, 22);
+            const string_view_array compacted = compute::compact(sliced);
+            CHECK_EQ(values_of(compacted), values_of(sliced));
+            CHECK_EQ(compacted.size(), 14);
+            CHECK_FALSE(compacted[2].has_value());
+
+            const auto buffers = data_buffers(compacted);
+            REQUIRE_EQ(buffers.size(), 2);
+            CHECK_EQ(buffers[0].data(), data_buffers(full)[1].data());
+            CHECK_EQ(buffers[1].size(), 4 * words[0].size());
+            CHECK_EQ(data_size(compacted), 14 * words[0].size());
+
+            // All the buffers that are not fully referenced are rewritten
+            const string_view_array rewritten = compute::compact(sliced, {.min_occupancy = 1.0});
+            CHECK_EQ(values_of(rewritten), values_of(sliced));
+            CHECK_EQ(data_size(rewritten), 13 * words[0].size());
+
+            // Only the buffers that are not referenced are released
+            const string_view_array released = compute::compact(sliced, {.min_occupancy = 0.0});
+            CHECK_EQ(values_of(released), values_of(sliced));
+            CHECK_EQ(data_buffers(released).size(), 3);
+            CHECK_EQ(data_buffers(released)[0].data(), data_buffers(full)[0].data());
+        }
+
+        TEST_CASE("capped data buffers")
+        {
+            const std::vector<std::string> words = make_words(40);
+            const string_view_array full(words, validity_bitmap{}, std::size_t(200));
+            const string_view_array sliced = full.slice(5, 35);
+            const string_view_array compacted = compute::compact(sliced, {.min_occupancy = 1.0, .max_data_buffer_size = 50});
+            CHECK_EQ(values_of(compacted), values_of(sliced));
+            const auto buffers = data_buffers(compacted);
+            CHECK_EQ(buffers.size(), 2 + 5);
+            for (const auto& data : buffers)
+            {
+                CHECK_LE(data.size(), 200);
+            }
+
+            CHECK_THROWS_AS(
+                std::ignore = compute::compact(sliced, {.max_data_buffer_size = 0}),
+                std::invalid_argument
+            );
+        }
+
+        TEST_CASE("dense array")
+        {
+            const std::vector<std::string> words = make_words(20);
+            const string_view_array ar(words, std::vector<std::size_t>{4}, std::size_t(200));
+            const string_view_array compacted = compute::compact(ar);
+            CHECK_EQ(compacted, ar);
+            CHECK_EQ(data_buffers(compacted)[0].data(), data_buffers(ar)[0].data());
+            CHECK_EQ(data_buffers(compacted)[1].data(), data_buffers(ar)[1].data());
+
+            const string_view_array short_values(std::vector<std::string>{"a", "bc", "def"});
+            CHECK_EQ(compute::compact(short_values), short_values);
+        }
+
+        TEST_CASE("deduplicate")
+        {
+            const std::string repeated = "a value repeated several times";
+            SUBCASE("rewritten buffers")
+            {
+                const string_view_array full(std::vector<std::string>(10, repeated));
+                const string_view_array sliced = full.slice(1, 9);
+                const string_view_array copied = compute::compact(sliced, {.min_occupancy = 1.0});
+                CHECK_EQ(data_size(copied), 8 * repeated.size());
+                const string_view_array deduplicated = compute::compact(sliced, {.min_occupancy = 1.0, .deduplicate = true});
+                CHECK_EQ(values_of(deduplicated), values_of(sliced));
+                CHECK_EQ(data_size(deduplicated), repeated.size());
+            }
+
+            SUBCASE("value in a shared buffer")
+            {
+                // The second data buffer is sparse, its value is already
+                // in the first one
+                const std::vector<std::string> words = make_words(5);
+                const std::vector<std::string> values{words[0], words[1], words[2], words[0], words[3], words[4]};
+                const string_view_array full(values, validity_bitmap{}, std::size_t(60));
+                REQUIRE_EQ(data_buffers(full).size(), 2);
+                const string_view_array sliced = full.slice(0, 4);
+                const string_view_array compacted = compute::compact(sliced, {.deduplicate = true});
+                CHECK_EQ(values_of(compacted), values_of(sliced));
+                REQUIRE_EQ(data_buffers(compacted).size(), 1);
+                CHECK_EQ(data_buffers(compacted)[0].data(), data_buffers(full)[0].data());
+                CHECK_EQ(compacted[3].value().data(), compacted[0].value().data());
+            }
+        }
+
+        TEST_CASE("binary_view_array")
+        {
+            std::vector<std::vector<std::byte>> values;
+            for (std::size_t i = 0; i < 10; ++i)
+            {
+                values.emplace_back(20 + i, static_cast<std::byte>(i));
+            }
+            const binary_view_array full(values, std::vector<std::size_t>{6});
+            const binary_view_array sliced = full.slice(5, 7);
+            const binary_view_array compacted = compute::compact(sliced);
+            REQUIRE_EQ(compacted.size(), 2);
+            CHECK(std::ranges::equal(compacted[0].value(), values[5]));
+            CHECK_FALSE(compacted[1].has_value());
+            CHECK_EQ(detail::array_access::get_arrow_proxy(compacted).buffers()[2].size(), values[5].size());
+        }
+
+        TEST_CASE("unsupported type")
+        {
+            const primitive_array<std::int32_t> ar(std::vector<std::int32_t>{1, 2, 3});
+            CHECK_THROWS_AS(std::ignore = compute::compact(ar), std::invalid_argument);
+        }
+    }
+}
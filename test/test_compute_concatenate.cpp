@@ -0,0 +1,352 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/compute/concatenate.hpp"
+#include "sparrow/layout/dictionary_encoded_array.hpp"
+#include "sparrow/layout/list_layout/list_array.hpp"
+#include "sparrow/layout/null_array.hpp"
+#include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
+#include "sparrow/layout/struct_layout/struct_array.hpp"
+#include "sparrow/layout/union_array.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Checks that the elements of res are the elements of the inputs, in order
+        void check_concatenate(const std::vector<array>& inputs, const array& res)
+        {
+            std::size_t size = 0;
+            for (const array& input : inputs)
+            {
+                size += input.size();
+            }
+            REQUIRE_EQ(res.size(), size);
+            CHECK_EQ(res.data_type(), inputs.front().data_type());
+            std::size_t i = 0;
+            for (const array& input : inputs)
+            {
+                for (std::size_t j = 0; j < input.size(); ++j, ++i)
+                {
+                    CHECK(res[i] == input[j]);
+                }
+            }
+        }
+
+        void check_concatenate(const std::vector<array>& inputs)
+        {
+            check_concatenate(inputs, compute::concatenate(inputs));
+        }
+
+        primitive_array<std::int32_t> make_int_array(std::size_t n, std::int32_t first = 0)
+        {
+            std::vector<nullable<std::int32_t>> values;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                std::int32_t value = first + static_cast<std::int32_t>(i);
+                values.push_back(nullable<std::int32_t>(value, value % 7 != 3));
+            }
+            return primitive_array<std::int32_t>(values);
+        }
+
+        std::vector<std::int16_t> make_flat_values(std::size_t n)
+        {
+            std::vector<std::int16_t> values;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values.push_back(static_cast<std::int16_t>(i));
+            }
+            return values;
+        }
+    }
+
+    TEST_SUITE("compute_concatenate")
+    {
+        TEST_CASE("primitive_array")
+        {
+            const primitive_array<std::int32_t> full = make_int_array(200);
+
+            SUBCASE("unaligned slices")
+            {
+                // Offsets and lengths that are not multiples of 8, so that
+                // the bitmaps are shifted
+                std::vector<array> inputs;
+                inputs.emplace_back(full.slice(3, 70));
+                inputs.emplace_back(full.slice(0, 0));
+                inputs.emplace_back(full.slice(101, 200));
+                inputs.emplace_back(primitive_array<std::int32_t>(std::vector<std::int32_t>{1, 2, 3}));
+                inputs.emplace_back(full.slice(5, 6));
+                check_concatenate(inputs);
+            }
+
+            SUBCASE("without null value")
+            {
+                std::vector<array> inputs;
+                inputs.emplace_back(primitive_array<std::int32_t>(std::vector<std::int32_t>{1, 2, 3}));
+                inputs.emplace_back(primitive_array<std::int32_t>(std::vector<std::int32_t>{4, 5}));
+                const array res = compute::concatenate(inputs);
+                check_concatenate(inputs, res);
+                CHECK_EQ(sparrow::detail::array_access::get_arrow_proxy(res).null_count(), 0);
+            }
+
+            SUBCASE("typed arrays")
+            {
+                const std::vector<primitive_array<std::int32_t>> inputs = {full.slice(10, 20), make_int_array(4, 50)};
+                const primitive_array<std::int32_t> res = compute::concatenate(std::span(inputs));
+                REQUIRE_EQ(res.size(), 14);
+                CHECK_EQ(res[0], full[10]);
+                CHECK_EQ(res[9], full[19]);
+                CHECK_EQ(res[10].get(), 50);
+                CHECK_FALSE(res[12].has_value());
+            }
+        }
+
+        TEST_CASE("string arrays")
+        {
+            const string_array full(
+                std::vector<std::string>{"zero", "one", "", "three", "four", "five"},
+                std::vector<std::size_t>{4}
+            );
+
+            SUBCASE("string_array")
+            {
+                std::vector<array> inputs;
+                inputs.emplace_back(full.slice(1, 6));
+                inputs.emplace_back(string_array(std::vector<std::string>{"six", "seven"}));
+                inputs.emplace_back(full.slice(2, 4));
+                check_concatenate(inputs);
+            }
+
+            SUBCASE("string_view_array")
+            {
+                const std::vector<string_view_array> inputs = {
+                    string_view_array(
+                        std::vector<std::string>{"short", "a string longer than twelve bytes", "abcdefghijkl"},
+                        std::vector<std::size_t>{2}
+                    ),
+                    string_view_array(
+                        std::vector<std::string>{"another long string value", "tiny", "yet another long string value"}
+                    )
+                };
+                string_view_array res = compute::concatenate(std::span(inputs));
+                REQUIRE_EQ(res.size(), 6);
+                CHECK_EQ(res[0].value(), "short");
+                CHECK_EQ(res[1].value(), "a string longer than twelve bytes");
+                CHECK_FALSE(res[2].has_value());
+                CHECK_EQ(res[3].value(), "another long string value");
+                CHECK_EQ(res[4].value(), "tiny");
+                CHECK_EQ(res[5].value(), "yet another long string value");
+                // The long values are gathered in a single data buffer
+                CHECK_EQ(sparrow::detail::array_access::get_arrow_proxy(res).buffers().size(), 4);
+            }
+        }
+
+        TEST_CASE("list arrays")
+        {
+            const std::vector<std::int16_t> flat_values = make_flat_values(12);
+
+            SUBCASE("list_array")
+            {
+                std::vector<array> inputs;
+                inputs.emplace_back(list_array(
+                    array(primitive_array<std::int16_t>(flat_values)),
+                    list_array::offset_from_sizes(std::vector<std::size_t>{2, 0, 3, 4, 3}),
+                    std::vector<std::size_t>{1}
+                ));
+                inputs.emplace_back(list_array(
+                    array(primitive_array<std::int16_t>(flat_values)),
+                    list_array::offset_from_sizes(std::vector<std::size_t>{5, 7})
+                ));
+                check_concatenate(inputs);
+            }
+
+            SUBCASE("list_view_array")
+            {
+                // Only the ranges of the children used by the lists are copied
+                std::vector<array> inputs;
+                inputs.emplace_back(list_view_array(
+                    array(primitive_array<std::int16_t>(flat_values)),
+                    std::vector<std::uint32_t>{5, 2, 0, 0, 9},
+                    std::vector<std::uint32_t>{3, 2, 0, 4, 3},
+                    std::vector<std::uint32_t>{2}
+                ));
+                inputs.emplace_back(list_view_array(
+                    array(primitive_array<std::int16_t>(flat_values)),
+                    std::vector<std::uint32_t>{8, 6},
+                    std::vector<std::uint32_t>{2, 3}
+                ));
+                const array res = compute::concatenate(inputs);
+                check_concatenate(inputs, res);
+                CHECK_EQ(sparrow::detail::array_access::get_arrow_proxy(res).children()[0].length(), 16);
+            }
+
+            SUBCASE("fixed_sized_list_array")
+            {
+                std::vector<array> inputs;
+                inputs.emplace_back(fixed_sized_list_array(
+                    std::uint64_t(3),
+                    array(primitive_array<std::int16_t>(flat_values)),
+                    std::vector<std::size_t>{2}
+                ));
+                inputs.emplace_back(fixed_sized_list_array(
+                    std::uint64_t(3),
+                    array(primitive_array<std::int16_t>(make_flat_values(6)))
+                ));
+                check_concatenate(inputs);
+            }
+        }
+
+        TEST_CASE("struct_array")
+        {
+            const auto make_struct = [](std::int32_t first)
+            {
+                std::vector<array> children;
+                children.emplace_back(make_int_array(6, first));
+                children.emplace_back(string_array(std::vector<std::string>{"a", "b", "c", "d", "e", "f"}));
+                return struct_array(std::move(children), std::vector<std::size_t>{3});
+            };
+            std::vector<array> inputs;
+            inputs.emplace_back(make_struct(0));
+            inputs.emplace_back(make_struct(10));
+            check_concatenate(inputs);
+        }
+
+        TEST_CASE("dictionary_encoded_array")
+        {
+            using layout_type = dictionary_encoded_array<std::uint32_t>;
+            const auto make_dictionary = [](std::vector<std::string> words, layout_type::keys_buffer_type keys)
+            {
+                return layout_type(std::move(keys), array(string_array(std::move(words))), std::vector<std::size_t>{1});
+            };
+
+            SUBCASE("shared dictionary")
+            {
+                layout_type ar = make_dictionary({"red", "green", "blue"}, {0, 2, 1, 1, 0});
+                std::vector<array> inputs;
+                inputs.emplace_back(ar.slice(1, 4));
+                inputs.emplace_back(std::move(ar));
+                const array res = compute::concatenate(inputs);
+                check_concatenate(inputs, res);
+                const auto& proxy = sparrow::detail::array_access::get_arrow_proxy(res);
+                CHECK_EQ(proxy.dictionary()->length(), 3);
+            }
+
+            SUBCASE("different dictionaries")
+            {
+                std::vector<array> inputs;
+                inputs.emplace_back(make_dictionary({"red", "green", "blue"}, {0, 2, 1, 1}));
+                inputs.emplace_back(make_dictionary({"blue", "yellow", "red"}, {2, 1, 0, 0}));
+                const array res = compute::concatenate(inputs);
+                check_concatenate(inputs, res);
+                // The duplicated values of the dictionaries are unified
+                const auto& proxy = sparrow::detail::array_access::get_arrow_proxy(res);
+                CHECK_EQ(proxy.dictionary()->length(), 4);
+            }
+        }
+
+        TEST_CASE("run_end_encoded_array")
+        {
+            // [1, null, null, 42, 42, 42, null, 9]
+            const auto make_ree = []
+            {
+                primitive_array<std::uint64_t> values(
+                    std::vector<std::uint64_t>{1, 0, 42, 0, 9},
+                    std::vector<std::size_t>{1, 3}
+                );
+                primitive_array<std::uint32_t> run_ends(std::vector<std::uint32_t>{1, 3, 6, 7, 8});
+                return run_end_encoded_array(array(std::move(run_ends)), array(std::move(values)));
+            };
+            std::vector<array> inputs;
+            inputs.emplace_back(make_ree());
+            inputs.emplace_back(make_ree());
+            const array res = compute::concatenate(inputs);
+            check_concatenate(inputs, res);
+            const auto& proxy = sparrow::detail::array_access::get_arrow_proxy(res);
+            CHECK_EQ(proxy.children()[0].length(), 10);
+            CHECK_EQ(proxy.null_count(), 6);
+        }
+
+        TEST_CASE("union arrays")
+        {
+            const auto make_children = []
+            {
+                std::vector<array> children;
+                children.emplace_back(primitive_array<std::int16_t>(std::vector<std::int16_t>{1, 2, 3, 4}));
+                children.emplace_back(make_int_array(4));
+                return children;
+            };
+
+            SUBCASE("sparse_union_array")
+            {
+                const auto make_union = [&]
+                {
+                    sparse_union_array::type_id_buffer_type type_ids{
+                        {std::uint8_t(0), std::uint8_t(1), std::uint8_t(1), std::uint8_t(0)}
+                    };
+                    return sparse_union_array(make_children(), std::move(type_ids));
+                };
+                std::vector<array> inputs;
+                inputs.emplace_back(make_union());
+                inputs.emplace_back(make_union());
+                check_concatenate(inputs);
+            }
+
+            SUBCASE("dense_union_array")
+            {
+                const auto make_union = [&]
+                {
+                    dense_union_array::type_id_buffer_type type_ids{
+                        {std::uint8_t(1), std::uint8_t(0), std::uint8_t(1), std::uint8_t(0)}
+                    };
+                    dense_union_array::offset_buffer_type offsets{
+                        {std::size_t(2), std::size_t(3), std::size_t(0), std::size_t(1)}
+                    };
+                    return dense_union_array(make_children(), std::move(type_ids), std::move(offsets));
+                };
+                std::vector<array> inputs;
+                inputs.emplace_back(make_union());
+                inputs.emplace_back(make_union());
+                check_concatenate(inputs);
+            }
+        }
+
+        TEST_CASE("null_array")
+        {
+            const std::vector<null_array> inputs = {null_array(5), null_array(2)};
+            const null_array res = compute::concatenate(std::span(inputs));
+            CHECK_EQ(res.size(), 7);
+        }
+
+        TEST_CASE("errors")
+        {
+            CHECK_THROWS_AS(std::ignore = compute::concatenate(std::span<const array>()), std::invalid_argument);
+
+            std::vector<array> mixed;
+            mixed.emplace_back(make_int_array(2));
+            mixed.emplace_back(string_array(std::vector<std::string>{"a"}));
+            CHECK_THROWS_AS(std::ignore = compute::concatenate(mixed), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,165 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/compute/convert.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        template <class A>
+        const buffer_view<std::uint8_t>& buffer_of(const A& ar, std::size_t i)
+        {
+            return detail::array_access::get_arrow_proxy(ar).buffers()[i];
+        }
+
+        template <class L, class R>
+        void check_same_elements(const L& lhs, const R& rhs)
+        {
+            REQUIRE_EQ(lhs.size(), rhs.size());
+            for (std::size_t i = 0; i < lhs.size(); ++i)
+            {
+                REQUIRE_EQ(lhs[i].has_value(), rhs[i].has_value());
+                if (lhs[i].has_value())
+                {
+                    CHECK(std::ranges::equal(lhs[i].value(), rhs[i].value()));
+                }
+            }
+        }
+
+        const std::vector<std::string> words = {
+            "short",
+            "",
+            "a value longer than twelve bytes",
+            "twelve bytes",
+            "thirteen byte",
+            "null",
+            "another value stored out of its view",
+            "x"
+        };
+        const std::vector<std::size_t> nulls = {5};
+    }
+
+    TEST_SUITE("compute_convert")
+    {
+        TEST_CASE("to_view_array")
+        {
+            SUBCASE("string_array")
+            {
+                const string_array ar(words, nulls);
+                const string_view_array views = compute::to_view_array(ar);
+                check_same_elements(views, ar);
+                CHECK_FALSE(views[5].has_value());
+
+                // The data buffer of the source is the data buffer of the result
+                const auto& proxy = detail::array_access::get_arrow_proxy(views);
+                REQUIRE_EQ(proxy.buffers().size(), 4);
+                CHECK_EQ(buffer_of(views, 2).data(), buffer_of(ar, 2).data());
+                CHECK_EQ(views[2].value().data(), ar[2].value().data());
+            }
+
+            SUBCASE("sliced array")
+            {
+                const string_array full(words, nulls);
+                const string_array ar = full.slice(2, 7);
+                const string_view_array views = compute::to_view_array(ar);
+                check_same_elements(views, ar);
+                CHECK_FALSE(views[3].has_value());
+                CHECK_EQ(buffer_of(views, 2).data(), buffer_of(full, 2).data());
+            }
+
+            SUBCASE("short values only")
+            {
+                const big_string_array ar(std::vector<std::string>{"a", "", "abcdefghijkl"});
+                const string_view_array views = compute::to_view_array(ar);
+                check_same_elements(views, ar);
+                CHECK_EQ(detail::array_access::get_arrow_proxy(views).buffers().size(), 3);
+
+                const string_array empty(std::vector<std::string>{"", ""});
+                check_same_elements(compute::to_view_array(empty), empty);
+            }
+
+            SUBCASE("binary_array")
+            {
+                const std::vector<std::vector<std::byte>> values{
+                    {std::byte{1}, std::byte{2}},
+                    std::vector<std::byte>(40, std::byte{7}),
+                    {}
+                };
+                const big_binary_array ar(values, std::vector<std::size_t>{2});
+                const binary_view_array views = compute::to_view_array(ar);
+                check_same_elements(views, ar);
+                CHECK_EQ(buffer_of(views, 2).data(), buffer_of(ar, 2).data());
+            }
+        }
+
+        TEST_CASE("to_offset_array")
+        {
+            // Several data buffers, read from a slice
+            const string_view_array full(words, nulls, std::size_t(40));
+            REQUIRE_GE(detail::array_access::get_arrow_proxy(full).buffers().size(), 5);
+
+            SUBCASE("string_array")
+            {
+                const string_array ar = compute::to_offset_array<string_array>(full);
+                check_same_elements(ar, full);
+                CHECK_EQ(ar[5].has_value(), false);
+
+                // The data of the null elements is not copied
+                std::size_t data_size = 0;
+                for (const auto& word : words)
+                {
+                    data_size += word.size();
+                }
+                CHECK_EQ(buffer_of(ar, 2).size(), data_size - words[5].size());
+            }
+
+            SUBCASE("sliced array")
+            {
+                const string_view_array views = full.slice(1, 6);
+                const big_string_array ar = compute::to_offset_array<big_string_array>(views);
+                check_same_elements(ar, views);
+            }
+
+            SUBCASE("binary_view_array")
+            {
+                const std::vector<std::vector<std::byte>> values{
+                    std::vector<std::byte>(20, std::byte{3}),
+                    {std::byte{1}},
+                    std::vector<std::byte>(40, std::byte{7})
+                };
+                const binary_view_array views(values, std::vector<std::size_t>{1});
+                const binary_array ar = compute::to_offset_array<binary_array>(views);
+                check_same_elements(ar, views);
+            }
+        }
+
+        TEST_CASE("round trip")
+        {
+            const string_array ar(words, nulls);
+            const string_array converted = compute::to_offset_array<string_array>(compute::to_view_array(ar));
+            CHECK_EQ(converted, ar);
+        }
+    }
+}
@@ -0,0 +1,227 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/compute/elementwise.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Every modulo-th value is null
+        template <class T>
+        std::vector<nullable<T>> make_values(std::size_t count, std::size_t modulo, int shift)
+        {
+            std::vector<nullable<T>> values;
+            values.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                values.push_back(nullable<T>(static_cast<T>(static_cast<int>(i % 40) + shift), i % modulo != 0));
+            }
+            return values;
+        }
+
+        template <class R, class T, class F>
+        void check_binary(
+            const primitive_array<R>& res,
+            const std::vector<nullable<T>>& lhs,
+            const std::vector<nullable<T>>& rhs,
+            F f
+        )
+        {
+            REQUIRE_EQ(res.size(), lhs.size());
+            for (std::size_t i = 0; i < lhs.size(); ++i)
+            {
+                const bool valid = lhs[i].has_value() && rhs[i].has_value();
+                REQUIRE_EQ(res[i].has_value(), valid);
+                if (valid)
+                {
+                    CHECK_EQ(res[i].value(), f(lhs[i].value(), rhs[i].value()));
+                }
+            }
+        }
+    }
+
+    using numeric_types = std::tuple<std::int8_t, std::uint16_t, std::int32_t, std::int64_t, float16_t, float, double>;
+
+    TEST_SUITE("compute_elementwise")
+    {
+        TEST_CASE_TEMPLATE_DEFINE("arithmetic and comparisons", T, arithmetic_id)
+        {
+            const std::size_t size = 150;
+            const auto lhs_values = make_values<T>(size + 3, 3, 1);
+            const auto rhs_values = make_values<T>(size, 5, 2);
+            const primitive_array<T> lhs_full(lhs_values);
+            const primitive_array<T> rhs(rhs_values);
+
+            // The lhs operand starts in the middle of a byte of its bitmap
+            const primitive_array<T> lhs = lhs_full.slice(3, size + 3);
+            const std::vector<nullable<T>> lhs_expected(lhs_values.begin() + 3, lhs_values.end());
+
+            check_binary(compute::add(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return static_cast<T>(a + b); });
+            check_binary(compute::subtract(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return static_cast<T>(a - b); });
+            check_binary(compute::multiply(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return static_cast<T>(a * b); });
+            check_binary(compute::divide(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return static_cast<T>(a / b); });
+
+            check_binary(compute::equal(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return a == b; });
+            check_binary(compute::not_equal(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return a != b; });
+            check_binary(compute::less(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return a < b; });
+            check_binary(compute::less_equal(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return a <= b; });
+            check_binary(compute::greater(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return a > b; });
+            check_binary(compute::greater_equal(lhs, rhs), lhs_expected, rhs_values, [](T a, T b) { return a >= b; });
+
+            const T scalar = static_cast<T>(4);
+            const std::vector<nullable<T>> scalars(size, nullable<T>(static_cast<T>(4)));
+            check_binary(compute::add(lhs, scalar), lhs_expected, scalars, [](T a, T b) { return static_cast<T>(a + b); });
+            check_binary(compute::divide(scalar, rhs), scalars, rhs_values, [](T a, T b) { return static_cast<T>(a / b); });
+            check_binary(compute::less(lhs, scalar), lhs_expected, scalars, [](T a, T b) { return a < b; });
+        }
+
+        TEST_CASE_TEMPLATE_APPLY(arithmetic_id, numeric_types);
+
+        TEST_CASE("no null values")
+        {
+            const primitive_array<std::int32_t> lhs(std::vector<std::int32_t>{1, 2, 3, 4});
+            const primitive_array<std::int32_t> rhs(std::vector<std::int32_t>{4, 3, 2, 1});
+            const auto res = compute::multiply(lhs, rhs);
+            CHECK(std::ranges::all_of(res, [](const auto& v) { return v.has_value(); }));
+            CHECK_EQ(res[0].value(), 4);
+            CHECK_EQ(res[1].value(), 6);
+            CHECK_EQ(res[2].value(), 6);
+            CHECK_EQ(res[3].value(), 4);
+        }
+
+        TEST_CASE("overflow wraps around")
+        {
+            constexpr std::int8_t max = std::numeric_limits<std::int8_t>::max();
+            constexpr std::int8_t min = std::numeric_limits<std::int8_t>::min();
+            const primitive_array<std::int8_t> ar(std::vector<std::int8_t>{max, min, 100});
+            const auto sum = compute::add(ar, std::int8_t(1));
+            CHECK_EQ(sum[0].value(), min);
+            CHECK_EQ(sum[1].value(), std::int8_t(min + 1));
+            const auto product = compute::multiply(ar, std::int8_t(2));
+            CHECK_EQ(product[2].value(), std::int8_t(-56));
+            const auto quotient = compute::divide(ar, std::int8_t(-1));
+            CHECK_EQ(quotient[0].value(), -max);
+            CHECK_EQ(quotient[1].value(), min);
+        }
+
+        TEST_CASE("division by zero")
+        {
+            const primitive_array<std::int32_t> lhs(std::vector<std::int32_t>{6, 8, 10});
+            const primitive_array<std::int32_t> rhs(
+                std::vector<nullable<std::int32_t>>{2, nullable<std::int32_t>(0, false), 5}
+            );
+            const auto res = compute::divide(lhs, rhs);
+            CHECK_EQ(res[0].value(), 3);
+            CHECK_FALSE(res[1].has_value());
+            CHECK_EQ(res[2].value(), 2);
+
+            const primitive_array<std::int32_t> zeros(std::vector<std::int32_t>{1, 0, 1});
+            CHECK_THROWS_AS(std::ignore = compute::divide(lhs, zeros), std::domain_error);
+            CHECK_THROWS_AS(std::ignore = compute::divide(lhs, 0), std::domain_error);
+
+            const primitive_array<double> dlhs(std::vector<double>{1., -1.});
+            const auto dres = compute::divide(dlhs, 0.);
+            CHECK_EQ(dres[0].value(), std::numeric_limits<double>::infinity());
+            CHECK_EQ(dres[1].value(), -std::numeric_limits<double>::infinity());
+        }
+
+        TEST_CASE("length mismatch")
+        {
+            const primitive_array<std::int32_t> lhs(std::vector<std::int32_t>{1, 2, 3});
+            const primitive_array<std::int32_t> rhs(std::vector<std::int32_t>{1, 2});
+            CHECK_THROWS_AS(std::ignore = compute::add(lhs, rhs), std::invalid_argument);
+            CHECK_THROWS_AS(std::ignore = compute::less(lhs, rhs), std::invalid_argument);
+        }
+
+        TEST_CASE("cast")
+        {
+            const auto values = make_values<std::int32_t>(100, 4, -20);
+            const primitive_array<std::int32_t> ar(values);
+
+            const auto as_double = compute::cast<double>(ar);
+            const auto as_half = compute::cast<float16_t>(ar);
+            const auto as_int8 = compute::cast<std::int8_t>(compute::cast<float>(ar));
+            REQUIRE_EQ(as_double.size(), values.size());
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                REQUIRE_EQ(as_double[i].has_value(), values[i].has_value());
+                REQUIRE_EQ(as_half[i].has_value(), values[i].has_value());
+                REQUIRE_EQ(as_int8[i].has_value(), values[i].has_value());
+                if (values[i].has_value())
+                {
+                    CHECK_EQ(as_double[i].value(), static_cast<double>(values[i].value()));
+                    CHECK_EQ(static_cast<float>(as_half[i].value()), static_cast<float>(values[i].value()));
+                    CHECK_EQ(as_int8[i].value(), static_cast<std::int8_t>(values[i].value()));
+                }
+            }
+        }
+
+        TEST_CASE("cast floating-point to integral")
+        {
+            constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+            SUBCASE("truncated")
+            {
+                const primitive_array<double> ar(std::vector<double>{-128.9, 127.9, 2.5, -0.5});
+                const auto res = compute::cast<std::int8_t>(ar);
+                CHECK_EQ(res[0].value(), -128);
+                CHECK_EQ(res[1].value(), 127);
+                CHECK_EQ(res[2].value(), 2);
+                CHECK_EQ(res[3].value(), 0);
+                const primitive_array<float> small(std::vector<float>{-0.5f, 255.5f});
+                CHECK_EQ(compute::cast<std::uint8_t>(small)[0].value(), 0);
+                CHECK_EQ(compute::cast<std::uint8_t>(small)[1].value(), 255);
+            }
+
+            SUBCASE("null elements are not converted")
+            {
+                const primitive_array<double> ar(std::vector<double>{nan, 1e30, 3.0}, std::vector<std::size_t>{0, 1});
+                const auto res = compute::cast<std::int32_t>(ar);
+                CHECK_FALSE(res[0].has_value());
+                CHECK_FALSE(res[1].has_value());
+                CHECK_EQ(res[2].value(), 3);
+            }
+
+            SUBCASE("out of range")
+            {
+                CHECK_THROWS_AS(
+                    std::ignore = compute::cast<std::int32_t>(primitive_array<double>(std::vector<double>{nan})),
+                    std::overflow_error
+                );
+                CHECK_THROWS_AS(
+                    std::ignore = compute::cast<std::int8_t>(primitive_array<double>(std::vector<double>{128.0})),
+                    std::overflow_error
+                );
+                CHECK_THROWS_AS(
+                    std::ignore = compute::cast<std::uint32_t>(primitive_array<float>(std::vector<float>{-1.0f})),
+                    std::overflow_error
+                );
+                CHECK_THROWS_AS(
+                    std::ignore = compute::cast<std::int64_t>(primitive_array<float>(std::vector<float>{9.3e18f})),
+                    std::overflow_error
+                );
+            }
+        }
+    }
+}
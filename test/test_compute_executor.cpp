@@ -0,0 +1,291 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "sparrow/compute/executor.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        constexpr std::size_t nb_rows = 1000;
+
+        // Runs the tasks on the calling thread, and counts them
+        class inline_thread_pool final : public thread_pool
+        {
+        public:
+
+            void submit(task_type task) override
+            {
+                ++m_nb_tasks;
+                task();
+            }
+
+            std::size_t concurrency() const override
+            {
+                return 4;
+            }
+
+            std::size_t nb_tasks() const
+            {
+                return m_nb_tasks;
+            }
+
+        private:
+
+            std::size_t m_nb_tasks = 0;
+        };
+
+        // Column "ints" holds i for the row i, with a null every 7 rows;
+        // it is a slice of a larger array. Column "strings" holds the
+        // decimal representation of i.
+        record_batch make_batch()
+        {
+            std::vector<nullable<std::int64_t>> values;
+            for (std::int64_t i = -5; i < static_cast<std::int64_t>(nb_rows); ++i)
+            {
+                values.push_back(nullable<std::int64_t>(i, i % 7 != 0));
+            }
+            const primitive_array<std::int64_t> full(values);
+            std::vector<std::string> words;
+            for (std::size_t i = 0; i < nb_rows; ++i)
+            {
+                words.push_back(std::to_string(i));
+            }
+            std::vector<array> columns;
+            columns.emplace_back(full.slice(5, nb_rows + 5));
+            columns.emplace_back(string_array(words));
+            return record_batch(std::vector<std::string>{"ints", "strings"}, std::move(columns));
+        }
+
+        // Sum of the non-null values of an int64 column
+        std::int64_t sum_of(const array& ar)
+        {
+            return ar.visit(
+                [](const auto& typed) -> std::int64_t
+                {
+                    std::int64_t res = 0;
+                    if constexpr (std::is_same_v<std::decay_t<decltype(typed)>, primitive_array<std::int64_t>>)
+                    {
+                        for (const auto& v : typed)
+                        {
+                            res += v.has_value() ? v.value() : 0;
+                        }
+                    }
+                    return res;
+                }
+            );
+        }
+
+        std::int64_t expected_sum(compute::row_range range)
+        {
+            std::int64_t res = 0;
+            for (std::size_t i = range.begin; i < range.end; ++i)
+            {
+                const auto value = static_cast<std::int64_t>(i);
+                res += value % 7 != 0 ? value : 0;
+            }
+            return res;
+        }
+    }
+
+    TEST_SUITE("compute_executor")
+    {
+        TEST_CASE("split")
+        {
+            inline_thread_pool pool;
+            const compute::record_batch_executor executor(pool, 300);
+            CHECK_EQ(executor.morsel_size(), 300);
+            CHECK_EQ(&executor.pool(), &pool);
+            CHECK(executor.split(0).empty());
+            CHECK_EQ(
+                executor.split(nb_rows),
+                std::vector<compute::row_range>{{0, 300}, {300, 600}, {600, 900}, {900, 1000}}
+            );
+            CHECK_EQ(executor.split(300), std::vector<compute::row_range>{{0, 300}});
+        }
+
+        TEST_CASE("map_morsels")
+        {
+            const record_batch rb = make_batch();
+            work_stealing_thread_pool pool(4);
+            const compute::record_batch_executor executor(pool, 128);
+
+            const auto sums = executor.map_morsels(
+                rb,
+                [](const record_batch& morsel, compute::row_range range)
+                {
+                    CHECK_EQ(morsel.nb_rows(), range.size());
+                    CHECK_EQ(morsel.get_column_name(1), "strings");
+                    const auto first = std::get<nullable<std::string_view>>(morsel.get_column("strings")[0]);
+                    CHECK_EQ(first.value(), std::to_string(range.begin));
+                    return sum_of(morsel.get_column("ints"));
+                }
+            );
+            const auto ranges = executor.split(nb_rows);
+            REQUIRE_EQ(sums.size(), ranges.size());
+            for (std::size_t m = 0; m < ranges.size(); ++m)
+            {
+                CHECK_EQ(sums[m], expected_sum(ranges[m]));
+            }
+            CHECK_EQ(std::accumulate(sums.begin(), sums.end(), std::int64_t(0)), expected_sum({0, nb_rows}));
+        }
+
+        TEST_CASE("map_columns")
+        {
+            const record_batch rb = make_batch();
+            const compute::record_batch_executor executor;
+            const auto sizes = executor.map_columns(
+                rb,
+                [](const array& column, std::size_t)
+                {
+                    return column.size();
+                }
+            );
+            CHECK_EQ(sizes, std::vector<std::size_t>{nb_rows, nb_rows});
+        }
+
+        TEST_CASE("map_column_morsels")
+        {
+            const record_batch rb = make_batch();
+            work_stealing_thread_pool pool(3);
+            const compute::record_batch_executor executor(pool, 100);
+            const auto res = executor.map_column_morsels(
+                rb,
+                [](const array& view, std::size_t column, compute::row_range range)
+                {
+                    CHECK_EQ(view.size(), range.size());
+                    return column == 0 ? sum_of(view) : static_cast<std::int64_t>(view.size());
+                }
+            );
+            REQUIRE_EQ(res.size(), 2);
+            REQUIRE_EQ(res[0].size(), 10);
+            REQUIRE_EQ(res[1].size(), 10);
+            for (std::size_t m = 0; m < 10; ++m)
+            {
+                CHECK_EQ(res[0][m], expected_sum({m * 100, (m + 1) * 100}));
+                CHECK_EQ(res[1][m], 100);
+            }
+        }
+
+        TEST_CASE("custom thread pool")
+        {
+            const record_batch rb = make_batch();
+            inline_thread_pool pool;
+            const compute::record_batch_executor executor(pool, 250);
+            std::size_t nb_calls = 0;
+            executor.map_column_morsels(
+                rb,
+                [&nb_calls](const array&, std::size_t, compute::row_range)
+                {
+                    ++nb_calls;
+                }
+            );
+            CHECK_EQ(nb_calls, 8);
+            // The calling thread takes part in the work, next to one task
+            // per thread of the pool
+            CHECK_EQ(pool.nb_tasks(), 4);
+        }
+
+        TEST_CASE("exceptions")
+        {
+            const record_batch rb = make_batch();
+            work_stealing_thread_pool pool(2);
+            const compute::record_batch_executor executor(pool, 10);
+            CHECK_THROWS_AS(
+                executor.map_morsels(
+                    rb,
+                    [](const record_batch&, compute::row_range range)
+                    {
+                        if (range.begin == 500)
+                        {
+                            throw std::runtime_error("kernel failure");
+                        }
+                    }
+                ),
+                std::runtime_error
+            );
+        }
+
+        TEST_CASE("nested execution")
+        {
+            const record_batch rb = make_batch();
+            work_stealing_thread_pool pool(2);
+            const compute::record_batch_executor executor(pool, 200);
+            const auto sums = executor.map_columns(
+                rb,
+                [&executor](const array& column, std::size_t)
+                {
+                    const record_batch single(std::vector<std::string>{"c"}, std::vector<array>{column});
+                    const auto partial = executor.map_morsels(
+                        single,
+                        [](const record_batch& morsel, compute::row_range)
+                        {
+                            return sum_of(morsel.get_column(0));
+                        }
+                    );
+                    return std::accumulate(partial.begin(), partial.end(), std::int64_t(0));
+                }
+            );
+            CHECK_EQ(sums[0], expected_sum({0, nb_rows}));
+            CHECK_EQ(sums[1], 0);
+        }
+    }
+
+    TEST_SUITE("thread_pool")
+    {
+        TEST_CASE("work_stealing_thread_pool")
+        {
+            std::atomic<std::size_t> count = 0;
+            {
+                work_stealing_thread_pool pool(3);
+                CHECK_EQ(pool.concurrency(), 3);
+                for (std::size_t i = 0; i < 100; ++i)
+                {
+                    pool.submit(
+                        [&pool, &count]
+                        {
+                            // Tasks submitted by a worker go to its own queue
+                            pool.submit(
+                                [&count]
+                                {
+                                    ++count;
+                                }
+                            );
+                            ++count;
+                        }
+                    );
+                }
+            }
+            // The destructor runs the pending tasks
+            CHECK_EQ(count.load(), 200);
+
+            const work_stealing_thread_pool single(0);
+            CHECK_EQ(single.concurrency(), 1);
+        }
+    }
+}
@@ -0,0 +1,345 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/compute/selection.hpp"
+#include "sparrow/layout/dictionary_encoded_array.hpp"
+#include "sparrow/layout/list_layout/list_array.hpp"
+#include "sparrow/layout/null_array.hpp"
+#include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
+#include "sparrow/layout/struct_layout/struct_array.hpp"
+#include "sparrow/layout/union_array.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        bool has_value(const array::const_reference& ref)
+        {
+            return std::visit(
+                [](const auto& v)
+                {
+                    return v.has_value();
+                },
+                ref
+            );
+        }
+
+        // Compares the result of a take with the selected elements of the source
+        void check_take(const array& source, const array& res, const compute::selection_vector& selection)
+        {
+            REQUIRE_EQ(res.size(), selection.size());
+            CHECK_EQ(res.data_type(), source.data_type());
+            for (std::size_t i = 0; i < selection.size(); ++i)
+            {
+                if (selection[i] < 0)
+                {
+                    CHECK_FALSE(has_value(res[i]));
+                }
+                else
+                {
+                    CHECK(res[i] == source[static_cast<std::size_t>(selection[i])]);
+                }
+            }
+        }
+
+        void check_take(const array& source)
+        {
+            const std::size_t n = source.size();
+            const compute::selection_vector selections[] = {
+                {},
+                {0},
+                {static_cast<std::int64_t>(n - 1), 0, -1, 1, 1},
+                {1, 2, 3, -1, -1, 0}
+            };
+            for (const auto& selection : selections)
+            {
+                check_take(source, compute::take(source, selection), selection);
+            }
+        }
+
+        array make_int_array(std::size_t n)
+        {
+            std::vector<nullable<std::int32_t>> values;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values.push_back(nullable<std::int32_t>(static_cast<std::int32_t>(i * 10), i % 4 != 2));
+            }
+            return array(primitive_array<std::int32_t>(values));
+        }
+    }
+
+    TEST_SUITE("compute_selection")
+    {
+        TEST_CASE("make_selection")
+        {
+            SUBCASE("from a mask")
+            {
+                // Sparse mask over several 64-bit blocks, with null values
+                std::vector<nullable<bool>> mask_values(200, nullable<bool>(false));
+                mask_values[3] = true;
+                mask_values[70] = true;
+                mask_values[71] = nullable<bool>(true, false);
+                mask_values[199] = true;
+                const primitive_array<bool> mask(mask_values);
+                CHECK_EQ(compute::make_selection(mask), compute::selection_vector{3, 70, 199});
+
+                const primitive_array<bool> slice = mask.slice(0, 71);
+                CHECK_EQ(compute::make_selection(slice), compute::selection_vector{3, 70});
+            }
+
+            SUBCASE("from indices")
+            {
+                const primitive_array<std::uint16_t> indices(
+                    std::vector<nullable<std::uint16_t>>{4, nullable<std::uint16_t>(std::uint16_t(1), false), 0}
+                );
+                CHECK_EQ(compute::make_selection(indices), compute::selection_vector{4, -1, 0});
+
+                const primitive_array<std::int32_t> negative(std::vector<std::int32_t>{0, -2});
+                CHECK_THROWS_AS(std::ignore = compute::make_selection(negative), std::out_of_range);
+            }
+        }
+
+        TEST_CASE("primitive_array")
+        {
+            std::vector<nullable<std::int64_t>> values;
+            for (std::int64_t i = 0; i < 150; ++i)
+            {
+                values.push_back(nullable<std::int64_t>(i, i % 3 != 0));
+            }
+            const primitive_array<std::int64_t> full(values);
+            const primitive_array<std::int64_t> ar = full.slice(0, 140);
+
+            std::vector<nullable<bool>> mask_values;
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                mask_values.push_back(nullable<bool>(i % 5 == 1, i != 6));
+            }
+            const primitive_array<bool> mask(mask_values);
+
+            const primitive_array<std::int64_t> filtered = compute::filter(ar, mask);
+            std::size_t j = 0;
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                if (mask[i].has_value() && mask[i].value())
+                {
+                    REQUIRE(j < filtered.size());
+                    CHECK_EQ(filtered[j], ar[i]);
+                    ++j;
+                }
+            }
+            CHECK_EQ(j, filtered.size());
+
+            const primitive_array<std::int32_t> indices(
+                std::vector<nullable<std::int32_t>>{139, 0, nullable<std::int32_t>(0, false), 2, 2}
+            );
+            const primitive_array<std::int64_t> taken = compute::take(ar, indices);
+            REQUIRE_EQ(taken.size(), 5);
+            CHECK_EQ(taken[0], ar[139]);
+            CHECK_FALSE(taken[1].has_value());
+            CHECK_FALSE(taken[2].has_value());
+            CHECK_EQ(taken[3], ar[2]);
+            CHECK_EQ(taken[4], ar[2]);
+
+            const primitive_array<std::int32_t> out_of_range(std::vector<std::int32_t>{140});
+            CHECK_THROWS_AS(std::ignore = compute::take(ar, out_of_range), std::out_of_range);
+            const primitive_array<bool> short_mask(std::vector<bool>{true, false});
+            CHECK_THROWS_AS(std::ignore = compute::filter(ar, short_mask), std::invalid_argument);
+        }
+
+        TEST_CASE("string_array")
+        {
+            const string_array full(
+                std::vector<std::string>{"zero", "one", "", "three", "four", "five"},
+                std::vector<std::size_t>{4}
+            );
+            string_array ar = full.slice(1, 6);
+            const primitive_array<bool> mask(std::vector<bool>{true, false, true, true, false});
+            const string_array filtered = compute::filter(ar, mask);
+            REQUIRE_EQ(filtered.size(), 3);
+            CHECK_EQ(filtered[0].value(), "one");
+            CHECK_EQ(filtered[1].value(), "three");
+            CHECK_FALSE(filtered[2].has_value());
+
+            check_take(array(std::move(ar)));
+        }
+
+        TEST_CASE("string_view_array")
+        {
+            const string_view_array ar(
+                std::vector<std::string>{"short", "a string longer than twelve bytes", "abcdefghijkl", "another long string value"},
+                std::vector<std::size_t>{2}
+            );
+            const compute::selection_vector selection{3, 0, -1, 1, 2};
+            string_view_array taken = compute::take(ar, selection);
+            REQUIRE_EQ(taken.size(), 5);
+            CHECK_EQ(taken[0].value(), "another long string value");
+            CHECK_EQ(taken[1].value(), "short");
+            CHECK_FALSE(taken[2].has_value());
+            CHECK_EQ(taken[3].value(), "a string longer than twelve bytes");
+            CHECK_FALSE(taken[4].has_value());
+        }
+
+        TEST_CASE("list arrays")
+        {
+            std::vector<std::int16_t> flat_values;
+            for (std::int16_t i = 0; i < 12; ++i)
+            {
+                flat_values.push_back(i);
+            }
+
+            SUBCASE("list_array")
+            {
+                list_array ar(
+                    array(primitive_array<std::int16_t>(flat_values)),
+                    list_array::offset_from_sizes(std::vector<std::size_t>{2, 0, 3, 4, 3}),
+                    std::vector<std::size_t>{1}
+                );
+                check_take(array(std::move(ar)));
+            }
+
+            SUBCASE("list_view_array")
+            {
+                list_view_array ar(
+                    array(primitive_array<std::int16_t>(flat_values)),
+                    std::vector<std::uint32_t>{5, 2, 0, 0, 9},
+                    std::vector<std::uint32_t>{3, 2, 0, 4, 3},
+                    std::vector<std::uint32_t>{2}
+                );
+                check_take(array(std::move(ar)));
+            }
+
+            SUBCASE("fixed_sized_list_array")
+            {
+                fixed_sized_list_array ar(
+                    std::uint64_t(3),
+                    array(primitive_array<std::int16_t>(flat_values)),
+                    std::vector<std::size_t>{2}
+                );
+                check_take(array(std::move(ar)));
+            }
+        }
+
+        TEST_CASE("struct_array")
+        {
+            std::vector<array> children;
+            children.emplace_back(make_int_array(6));
+            children.emplace_back(string_array(std::vector<std::string>{"a", "b", "c", "d", "e", "f"}));
+            struct_array ar(std::move(children), std::vector<std::size_t>{3});
+            check_take(array(std::move(ar)));
+        }
+
+        TEST_CASE("dictionary_encoded_array")
+        {
+            using layout_type = dictionary_encoded_array<std::uint32_t>;
+            layout_type::keys_buffer_type keys{0, 2, 1, 1, 3, 0};
+            layout_type ar(
+                std::move(keys),
+                array(string_array(std::vector<std::string>{"red", "green", "blue", "a much longer color name"})),
+                std::vector<std::size_t>{4}
+            );
+            const primitive_array<std::uint8_t> indices(std::vector<std::uint8_t>{5, 4, 3, 1});
+            const layout_type taken = compute::take(ar, indices);
+            REQUIRE_EQ(taken.size(), 4);
+            CHECK_EQ(std::get<nullable<std::string_view>>(taken[0]).value(), "red");
+            CHECK_FALSE(std::get<nullable<std::string_view>>(taken[1]).has_value());
+            CHECK_EQ(std::get<nullable<std::string_view>>(taken[2]).value(), "green");
+            CHECK_EQ(std::get<nullable<std::string_view>>(taken[3]).value(), "blue");
+
+            check_take(array(std::move(ar)));
+        }
+
+        TEST_CASE("run_end_encoded_array")
+        {
+            // [1, null, null, 42, 42, 42, null, 9]
+            primitive_array<std::uint64_t> values(
+                std::vector<std::uint64_t>{1, 0, 42, 0, 9},
+                std::vector<std::size_t>{1, 3}
+            );
+            primitive_array<std::uint32_t> run_ends(std::vector<std::uint32_t>{1, 3, 6, 7, 8});
+            const array source(run_end_encoded_array(array(std::move(run_ends)), array(std::move(values))));
+            check_take(source);
+
+            const compute::selection_vector selection{3, 4, 5, 0, 7, 7, -1};
+            const array taken = compute::take(source, selection);
+            check_take(source, taken, selection);
+            const auto& proxy = sparrow::detail::array_access::get_arrow_proxy(taken);
+            // The three 42 are one run, the two 9 another one
+            CHECK_EQ(proxy.children()[0].length(), 4);
+            CHECK_EQ(proxy.null_count(), 1);
+        }
+
+        TEST_CASE("result too large for its offsets")
+        {
+            // The run ends of the result would not fit in 16 bits
+            primitive_array<std::uint16_t> run_ends(std::vector<std::uint16_t>{2});
+            const array source(run_end_encoded_array(
+                array(std::move(run_ends)),
+                array(primitive_array<std::int32_t>(std::vector<std::int32_t>{5}))
+            ));
+            const compute::selection_vector selection(70000, 0);
+            CHECK_THROWS_AS(std::ignore = compute::take(source, selection), std::overflow_error);
+        }
+
+        TEST_CASE("union arrays")
+        {
+            const auto make_children = []
+            {
+                std::vector<array> children;
+                children.emplace_back(primitive_array<std::int16_t>(std::vector<std::int16_t>{1, 2, 3, 4}));
+                children.emplace_back(make_int_array(4));
+                return children;
+            };
+
+            SUBCASE("sparse_union_array")
+            {
+                sparse_union_array::type_id_buffer_type type_ids{
+                    {std::uint8_t(0), std::uint8_t(1), std::uint8_t(1), std::uint8_t(0)}
+                };
+                sparse_union_array ar(make_children(), std::move(type_ids));
+                check_take(array(std::move(ar)));
+            }
+
+            SUBCASE("dense_union_array")
+            {
+                dense_union_array::type_id_buffer_type type_ids{
+                    {std::uint8_t(1), std::uint8_t(0), std::uint8_t(1), std::uint8_t(0)}
+                };
+                dense_union_array::offset_buffer_type offsets{
+                    {std::size_t(2), std::size_t(3), std::size_t(0), std::size_t(1)}
+                };
+                dense_union_array ar(make_children(), std::move(type_ids), std::move(offsets));
+                check_take(array(std::move(ar)));
+            }
+        }
+
+        TEST_CASE("null_array")
+        {
+            const null_array ar(5);
+            const null_array taken = compute::take(ar, compute::selection_vector{4, 1, -1});
+            CHECK_EQ(taken.size(), 3);
+        }
+    }
+}
@@ -0,0 +1,271 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sparrow/compute/sort.hpp"
+#include "sparrow/layout/null_array.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        const compute::sort_options all_options[] = {
+            {compute::sort_order::ascending, compute::null_placement::at_end},
+            {compute::sort_order::ascending, compute::null_placement::at_start},
+            {compute::sort_order::descending, compute::null_placement::at_end},
+            {compute::sort_order::descending, compute::null_placement::at_start}
+        };
+
+        // Stable sort of the positions of values, nulls being std::nullopt
+        template <class T, class Less>
+        compute::selection_vector
+        expected_indices(const std::vector<std::optional<T>>& values, const compute::sort_options& options, Less less)
+        {
+            compute::selection_vector res(values.size());
+            std::iota(res.begin(), res.end(), std::int64_t(0));
+            const bool nulls_first = options.nulls == compute::null_placement::at_start;
+            const bool descending = options.order == compute::sort_order::descending;
+            std::ranges::stable_sort(
+                res,
+                [&](std::int64_t lhs, std::int64_t rhs)
+                {
+                    const auto& l = values[static_cast<std::size_t>(lhs)];
+                    const auto& r = values[static_cast<std::size_t>(rhs)];
+                    if (!l.has_value() || !r.has_value())
+                    {
+                        return nulls_first ? !l.has_value() && r.has_value() : l.has_value() && !r.has_value();
+                    }
+                    return descending ? less(*r, *l) : less(*l, *r);
+                }
+            );
+            return res;
+        }
+
+        template <class T>
+        compute::selection_vector
+        expected_indices(const std::vector<std::optional<T>>& values, const compute::sort_options& options)
+        {
+            return expected_indices(values, options, std::less<T>{});
+        }
+
+        template <class T>
+        primitive_array<T> make_primitive(const std::vector<std::optional<T>>& values)
+        {
+            std::vector<nullable<T>> nullables;
+            for (const auto& value : values)
+            {
+                T v = value.value_or(T{});
+                nullables.push_back(nullable<T>(v, value.has_value()));
+            }
+            return primitive_array<T>(nullables);
+        }
+
+        template <class T>
+        std::vector<std::optional<T>> make_random_values(std::size_t n, T min, T max, std::uint32_t seed)
+        {
+            std::mt19937 gen(seed);
+            std::uniform_int_distribution<std::int64_t> dist(static_cast<std::int64_t>(min), static_cast<std::int64_t>(max));
+            std::vector<std::optional<T>> res;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (gen() % 9 == 0)
+                {
+                    res.push_back(std::nullopt);
+                }
+                else
+                {
+                    res.push_back(static_cast<T>(dist(gen)));
+                }
+            }
+            return res;
+        }
+
+        template <class T>
+        void check_primitive(const std::vector<std::optional<T>>& values)
+        {
+            const primitive_array<T> ar = make_primitive(values);
+            for (const auto& options : all_options)
+            {
+                CHECK_EQ(compute::sort_indices(ar, options), expected_indices(values, options));
+            }
+        }
+    }
+
+    TEST_SUITE("compute_sort")
+    {
+        TEST_CASE("integers")
+        {
+            // Few distinct values, to check the stability
+            check_primitive(make_random_values<std::int32_t>(1000, -20, 20, 1));
+            check_primitive(make_random_values<std::int64_t>(
+                1000,
+                std::numeric_limits<std::int64_t>::min() / 2,
+                std::numeric_limits<std::int64_t>::max() / 2,
+                2
+            ));
+            check_primitive(make_random_values<std::uint8_t>(300, 0, 255, 3));
+            check_primitive(make_random_values<std::int16_t>(300, -1000, 1000, 4));
+            check_primitive(make_random_values<std::uint64_t>(300, 0, std::numeric_limits<std::int64_t>::max(), 5));
+            check_primitive(std::vector<std::optional<std::int32_t>>{});
+            check_primitive(std::vector<std::optional<std::int32_t>>{std::nullopt, std::nullopt});
+        }
+
+        TEST_CASE("floating points")
+        {
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            const double inf = std::numeric_limits<double>::infinity();
+            const std::vector<std::optional<double>> values = {1.5, -0.0, std::nullopt, nan, -inf, 0.0, -2.25, inf, 1e-300, -nan};
+            const primitive_array<double> ar = make_primitive(values);
+
+            // NaN after all the other values in both orders, -0 equal to +0
+            for (const auto& options : all_options)
+            {
+                // expected_indices swaps the operands in descending order
+                const bool descending = options.order == compute::sort_order::descending;
+                const auto less = [descending](double lhs, double rhs)
+                {
+                    if (std::isnan(lhs) || std::isnan(rhs))
+                    {
+                        return descending ? std::isnan(lhs) && !std::isnan(rhs)
+                                          : !std::isnan(lhs) && std::isnan(rhs);
+                    }
+                    return lhs < rhs;
+                };
+                CHECK_EQ(compute::sort_indices(ar, options), expected_indices(values, options, less));
+            }
+
+            const primitive_array<float> floats(std::vector<float>{3.f, -1.f, 2.5f, -7.f});
+            CHECK_EQ(compute::sort_indices(floats), compute::selection_vector{3, 1, 2, 0});
+
+            const float float_nan = std::numeric_limits<float>::quiet_NaN();
+            const primitive_array<float> with_nan(std::vector<float>{3.f, float_nan, -1.f});
+            const compute::sort_options descending{compute::sort_order::descending};
+            CHECK_EQ(compute::sort_indices(with_nan, descending), compute::selection_vector{0, 2, 1});
+        }
+
+        TEST_CASE("sliced array")
+        {
+            const std::vector<std::optional<std::int32_t>> values = make_random_values<std::int32_t>(100, -50, 50, 6);
+            const primitive_array<std::int32_t> full = make_primitive(values);
+            const primitive_array<std::int32_t> ar = full.slice(13, 77);
+            const std::vector<std::optional<std::int32_t>> sliced(values.begin() + 13, values.begin() + 77);
+            CHECK_EQ(compute::sort_indices(ar), expected_indices(sliced, {}));
+
+            const primitive_array<std::int32_t> sorted = compute::sort(ar);
+            REQUIRE_EQ(sorted.size(), ar.size());
+            for (std::size_t i = 1; i < sorted.size(); ++i)
+            {
+                if (sorted[i].has_value())
+                {
+                    CHECK(sorted[i - 1].has_value());
+                    CHECK_LE(sorted[i - 1].get(), sorted[i].get());
+                }
+            }
+        }
+
+        TEST_CASE("strings")
+        {
+            // Values with the same prefix, shorter than the prefix and
+            // longer than the inlined views
+            const std::vector<std::optional<std::string>> values = {
+                "banana",
+                "",
+                std::nullopt,
+                "ban",
+                "a string longer than twelve bytes",
+                "a string longer than eleven bytes",
+                "b",
+                "banana",
+                std::nullopt,
+                "ab\xff",
+                "ab",
+                "a"
+            };
+            std::vector<std::string> strings;
+            std::vector<std::size_t> nulls;
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                strings.push_back(values[i].value_or(""));
+                if (!values[i].has_value())
+                {
+                    nulls.push_back(i);
+                }
+            }
+            const auto less = [](const std::string& lhs, const std::string& rhs)
+            {
+                return std::string_view(lhs) < std::string_view(rhs);
+            };
+
+            SUBCASE("string_array")
+            {
+                const string_array ar(strings, nulls);
+                for (const auto& options : all_options)
+                {
+                    CHECK_EQ(compute::sort_indices(ar, options), expected_indices(values, options, less));
+                }
+
+                const string_array sliced = ar.slice(3, 8);
+                const std::vector<std::optional<std::string>> sliced_values(values.begin() + 3, values.begin() + 8);
+                CHECK_EQ(compute::sort_indices(sliced), expected_indices(sliced_values, {}, less));
+            }
+
+            SUBCASE("string_view_array")
+            {
+                string_view_array ar(strings, nulls);
+                for (const auto& options : all_options)
+                {
+                    CHECK_EQ(compute::sort_indices(ar, options), expected_indices(values, options, less));
+                }
+            }
+        }
+
+        TEST_CASE("record_batch")
+        {
+            // Sorted on "group" ascending, then on "value" descending
+            record_batch rb(
+                {{"group",
+                  array(string_array(std::vector<std::string>{"b", "a", "b", "a", "c", "a"}, std::vector<std::size_t>{4}))},
+                 {"value", array(primitive_array<std::int32_t>(std::vector<std::int32_t>{1, 5, 3, 5, 2, 7}))}}
+            );
+            const std::vector<compute::sort_key> keys = {
+                {"group", {}},
+                {"value", {compute::sort_order::descending, compute::null_placement::at_end}}
+            };
+            CHECK_EQ(compute::sort_indices(rb, keys), compute::selection_vector{5, 1, 3, 2, 0, 4});
+
+            const std::vector<compute::sort_key> unknown = {{"unknown", {}}};
+            CHECK_THROWS_AS(std::ignore = compute::sort_indices(rb, unknown), std::out_of_range);
+        }
+
+        TEST_CASE("unsupported type")
+        {
+            const null_array ar(3);
+            CHECK_THROWS_AS(std::ignore = compute::sort_indices(ar), std::invalid_argument);
+        }
+    }
+}
@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <ranges>
+#include <span>
 #include <vector>
 
 #include "sparrow/layout/decimal_array.hpp"
@@ -61,5 +62,32 @@ namespace sparrow
             CHECK_EQ(static_cast<double>(val), doctest::Approx(0.0033));
         }
         TEST_CASE_TEMPLATE_APPLY(decimal_array_test_generic_id, integer_types);
+
+        TEST_CASE_TEMPLATE_DEFINE("sliced", INTEGER_TYPE, decimal_array_test_sliced_id)
+        {
+            using integer_type = INTEGER_TYPE;
+            u8_buffer<integer_type> buffer{integer_type(10), integer_type(20), integer_type(33), integer_type(111)};
+            const decimal_array<decimal<integer_type>> array{std::move(buffer), std::size_t(2), 4};
+
+            const std::span<const integer_type> values = array.value_span();
+            REQUIRE_EQ(values.size(), 4);
+            CHECK_EQ(static_cast<std::int64_t>(values[3]), 111);
+
+            const auto check_slice = [](const decimal_array<decimal<integer_type>>& sliced)
+            {
+                REQUIRE_EQ(sliced.size(), 2);
+                CHECK_EQ(static_cast<std::int64_t>(sliced[0].value().storage()), 20);
+                CHECK_EQ(static_cast<std::int64_t>(sliced[1].value().storage()), 33);
+                CHECK_EQ(sliced[1].value().scale(), 4);
+
+                const std::span<const integer_type> sliced_values = sliced.value_span();
+                REQUIRE_EQ(sliced_values.size(), 2);
+                CHECK_EQ(static_cast<std::int64_t>(sliced_values[0]), 20);
+                CHECK_EQ(static_cast<std::int64_t>(sliced_values[1]), 33);
+            };
+            check_slice(array.slice(1, 3));
+            check_slice(array.slice_view(1, 3));
+        }
+        TEST_CASE_TEMPLATE_APPLY(decimal_array_test_sliced_id, integer_types);
     }
 }  // namespace sparrow
\ No newline at end of file
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <exception>
+#include <tuple>
+#include <type_traits>
 
 #include "sparrow/layout/array_helper.hpp"
 #include "sparrow/layout/dispatch.hpp"
@@ -69,5 +72,84 @@ namespace sparrow
         }
 
         TEST_CASE_TEMPLATE_APPLY(array_element_id, testing_types);
+
+        TEST_CASE_TEMPLATE_DEFINE("kernels", AR, kernels_id)
+        {
+            using array_type = AR;
+            using wrapper_type = array_wrapper_impl<AR>;
+            array_type ar(make_arrow_proxy<typename AR::inner_value_type>());
+            wrapper_type w(&ar);
+
+            const auto* kernels = w.kernels();
+            REQUIRE_NE(kernels, nullptr);
+            CHECK_EQ(kernels, detail::get_array_kernels(w.data_type(), w.is_dictionary()));
+            CHECK_EQ(kernels->size(w), ar.size());
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK_EQ(kernels->has_value(w, i), ar[i].has_value());
+            }
+        }
+
+        TEST_CASE_TEMPLATE_APPLY(kernels_id, testing_types);
+
+        TEST_CASE("is_visitable_layout_type")
+        {
+            const auto last = static_cast<int>(data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS);
+            for (int i = 0; i <= last; ++i)
+            {
+                // 17 and 18 are not data types
+                if (i == 17 || i == 18)
+                {
+                    continue;
+                }
+                const auto dt = static_cast<data_type>(i);
+                for (const bool dictionary : {false, true})
+                {
+                    bool visited = true;
+                    try
+                    {
+                        std::ignore = visit_layout_type(
+                            []<class T>(std::type_identity<T>)
+                            {
+                                return 0;
+                            },
+                            dt,
+                            dictionary
+                        );
+                    }
+                    catch (const std::exception&)
+                    {
+                        visited = false;
+                    }
+                    CHECK_EQ(is_visitable_layout_type(dt, dictionary), visited);
+                    CHECK_EQ(detail::get_array_kernels(dt, dictionary) != nullptr, visited);
+                }
+            }
+        }
+
+        TEST_CASE_TEMPLATE_DEFINE("visit_elements", AR, visit_elements_id)
+        {
+            using array_type = AR;
+            using wrapper_type = array_wrapper_impl<AR>;
+            array_type ar(make_arrow_proxy<typename AR::inner_value_type>());
+            wrapper_type w(&ar);
+
+            const std::size_t first = 1;
+            const std::size_t last = ar.size() - 1;
+            std::size_t index = first;
+            visit_elements(
+                [&](const auto& elem)
+                {
+                    CHECK_EQ(elem.has_value(), ar[index].has_value());
+                    ++index;
+                },
+                w,
+                first,
+                last
+            );
+            CHECK_EQ(index, last);
+        }
+
+        TEST_CASE_TEMPLATE_APPLY(visit_elements_id, testing_types);
     }
 }
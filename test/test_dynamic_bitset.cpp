@@ -15,6 +15,8 @@
 #include <array>
 #include <cstdint>
 #include <ranges>
+#include <tuple>
+#include <vector>
 
 #include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
 #include "sparrow/buffer/dynamic_bitset/non_owning_dynamic_bitset.hpp"
@@ -326,6 +328,16 @@ namespace sparrow
                 b.resize(40, true);
                 CHECK_EQ(b.size(), 40);
                 CHECK_EQ(b.null_count(), s_bitmap_null_count + 6);
+
+                // Test shrinkage across several blocks
+                b.resize(10);
+                CHECK_EQ(b.size(), 10);
+                std::size_t expected_null_count = 0;
+                for (std::size_t i = 0; i < b.size(); ++i)
+                {
+                    expected_null_count += b.test(i) ? 0u : 1u;
+                }
+                CHECK_EQ(b.null_count(), expected_null_count);
             }
 
             SUBCASE("iterator")
@@ -647,6 +659,49 @@ namespace sparrow
                 CHECK_EQ(b.null_count(), s_bitmap_null_count - 1);
             }
 
+            SUBCASE("visit_runs")
+            {
+                const bitmap b(f.get_buffer(), s_bitmap_size);
+                std::size_t next = 0;
+                bool previous_value = !b.test(0);
+                b.visit_runs(
+                    [&](std::size_t first, std::size_t length, bool value)
+                    {
+                        CHECK_EQ(first, next);
+                        CHECK_GT(length, 0u);
+                        CHECK_NE(value, previous_value);
+                        for (std::size_t i = first; i < first + length; ++i)
+                        {
+                            CHECK_EQ(b.test(i), value);
+                        }
+                        next = first + length;
+                        previous_value = value;
+                    }
+                );
+                CHECK_EQ(next, s_bitmap_size);
+            }
+
+            SUBCASE("visit_set_indices")
+            {
+                const bitmap b(f.get_buffer(), s_bitmap_size);
+                std::vector<std::size_t> indices;
+                b.visit_set_indices(
+                    [&](std::size_t i)
+                    {
+                        indices.push_back(i);
+                    }
+                );
+                std::vector<std::size_t> expected;
+                for (std::size_t i = 0; i < s_bitmap_size; ++i)
+                {
+                    if (b.test(i))
+                    {
+                        expected.push_back(i);
+                    }
+                }
+                CHECK_EQ(indices, expected);
+            }
+
             SUBCASE("bitset_reference")
             {
                 // as a reminder: p_buffer[0] = 38; // 00100110
@@ -679,5 +734,123 @@ namespace sparrow
         }
 
         TEST_CASE_TEMPLATE_APPLY(dynamic_bitset_id, testing_types);
+
+        TEST_CASE("visit_runs and visit_set_indices over full words")
+        {
+            // 64 valid bits, 64 null bits, then a mixed word and a partial tail.
+            dynamic_bitset<std::uint8_t> b(250, true);
+            for (std::size_t i = 64; i < 128; ++i)
+            {
+                b.set(i, false);
+            }
+            for (std::size_t i = 128; i < 192; i += 3)
+            {
+                b.set(i, false);
+            }
+            b.set(249, false);
+
+            std::vector<std::tuple<std::size_t, std::size_t, bool>> runs;
+            b.visit_runs(
+                [&](std::size_t first, std::size_t length, bool value)
+                {
+                    runs.emplace_back(first, length, value);
+                }
+            );
+            REQUIRE_GE(runs.size(), 3u);
+            CHECK_EQ(runs[0], std::make_tuple(std::size_t(0), std::size_t(64), true));
+            CHECK_EQ(runs[1], std::make_tuple(std::size_t(64), std::size_t(65), false));
+            CHECK_EQ(runs.back(), std::make_tuple(std::size_t(249), std::size_t(1), false));
+            std::size_t total = 0;
+            for (const auto& [first, length, value] : runs)
+            {
+                CHECK_EQ(first, total);
+                total += length;
+            }
+            CHECK_EQ(total, b.size());
+
+            std::size_t set_count = 0;
+            std::size_t last_index = 0;
+            b.visit_set_indices(
+                [&](std::size_t i)
+                {
+                    CHECK(b.test(i));
+                    CHECK((set_count == 0 || i > last_index));
+                    last_index = i;
+                    ++set_count;
+                }
+            );
+            CHECK_EQ(set_count, b.size() - b.null_count());
+
+            SUBCASE("without null")
+            {
+                const dynamic_bitset<std::uint8_t> full(100, true);
+                std::size_t run_count = 0;
+                full.visit_runs(
+                    [&](std::size_t first, std::size_t length, bool value)
+                    {
+                        CHECK_EQ(first, 0u);
+                        CHECK_EQ(length, 100u);
+                        CHECK(value);
+                        ++run_count;
+                    }
+                );
+                CHECK_EQ(run_count, 1u);
+            }
+        }
+
+        TEST_CASE("without storage")
+        {
+            using bitset_type = dynamic_bitset<std::uint8_t>;
+            bitset_type b(bitset_type::storage_type(), 20);
+            CHECK_EQ(b.data(), nullptr);
+            CHECK_EQ(b.size(), 20u);
+            CHECK_EQ(b.null_count(), 0u);
+            CHECK(b.test(13));
+
+            SUBCASE("setting bits does not allocate")
+            {
+                b.set(3, true);
+                b.push_back(true);
+                b.resize(30, true);
+                b.insert(b.cbegin(), 2, true);
+                b.erase(b.cbegin(), std::next(b.cbegin(), 4));
+                b.resize(10);
+                CHECK_EQ(b.data(), nullptr);
+                CHECK_EQ(b.size(), 10u);
+                CHECK_EQ(b.null_count(), 0u);
+            }
+
+            SUBCASE("resetting a bit allocates")
+            {
+                b.set(13, false);
+                REQUIRE_NE(b.data(), nullptr);
+                CHECK_EQ(b.null_count(), 1u);
+                for (std::size_t i = 0; i < b.size(); ++i)
+                {
+                    CHECK_EQ(b.test(i), i != 13);
+                }
+            }
+
+            SUBCASE("appending unset bits allocates")
+            {
+                b.resize(25, false);
+                REQUIRE_NE(b.data(), nullptr);
+                CHECK_EQ(b.null_count(), 5u);
+                CHECK(b.test(19));
+                CHECK_FALSE(b.test(20));
+            }
+
+            SUBCASE("inserting unset bits allocates")
+            {
+                b.insert(std::next(b.cbegin(), 5), 2, false);
+                REQUIRE_NE(b.data(), nullptr);
+                CHECK_EQ(b.size(), 22u);
+                CHECK_EQ(b.null_count(), 2u);
+                CHECK(b.test(4));
+                CHECK_FALSE(b.test(5));
+                CHECK_FALSE(b.test(6));
+                CHECK(b.test(7));
+            }
+        }
     }
 }
@@ -0,0 +1,322 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/ipc/stream_reader.hpp"
+#include "sparrow/ipc/stream_writer.hpp"
+#include "sparrow/layout/dictionary_encoded_array.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+#include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        record_batch make_batch(std::int32_t first, bool with_dictionary = true)
+        {
+            std::vector<std::string> names = {"a", "s", "b"};
+            std::vector<array> columns;
+            columns.emplace_back(primitive_array<std::int32_t>(
+                std::vector<std::int32_t>{first, first + 1, first + 2, first + 3},
+                std::vector<bool>{true, false, true, true}
+            ));
+            columns.emplace_back(string_array(std::vector<std::string>{"foo", "", "bar", "quux"}));
+            columns.emplace_back(primitive_array<bool>(std::vector<bool>{true, false, false, true}));
+            if (with_dictionary)
+            {
+                names.emplace_back("d");
+                columns.emplace_back(dictionary_encoded_array<std::int32_t>(
+                    u8_buffer<std::int32_t>{1, 0, 1, 1},
+                    array(string_array(std::vector<std::string>{"red", "green"}))
+                ));
+            }
+            return record_batch(std::move(names), std::move(columns));
+        }
+
+        // Serializes the batches in memory with a stream_writer
+        std::vector<std::uint8_t> write_stream(const std::vector<record_batch>& batches)
+        {
+            std::vector<std::uint8_t> res;
+            ipc::stream_writer writer(
+                [&res](std::span<const std::span<const std::uint8_t>> segments)
+                {
+                    for (const auto& s : segments)
+                    {
+                        res.insert(res.end(), s.begin(), s.end());
+                    }
+                }
+            );
+            for (const record_batch& batch : batches)
+            {
+                writer.write(batch);
+            }
+            writer.close();
+            return res;
+        }
+
+        // Source returning at most chunk_size bytes per call
+        ipc::stream_reader::source_type memory_source(const std::vector<std::uint8_t>& data, std::size_t chunk_size)
+        {
+            return [&data, chunk_size, pos = std::size_t(0)](std::span<std::uint8_t> dest) mutable
+            {
+                const std::size_t n = std::min({dest.size(), chunk_size, data.size() - pos});
+                std::memcpy(dest.data(), data.data() + pos, n);
+                pos += n;
+                return n;
+            };
+        }
+
+        // Overwrites the first occurrence of a sequence of integers in the stream
+        template <class T>
+        void overwrite(std::vector<std::uint8_t>& stream, const std::vector<T>& from, const std::vector<T>& to)
+        {
+            const auto bytes = [](const std::vector<T>& values)
+            {
+                std::vector<std::uint8_t> res(values.size() * sizeof(T));
+                std::memcpy(res.data(), values.data(), res.size());
+                return res;
+            };
+            const std::vector<std::uint8_t> pattern = bytes(from);
+            const auto it = std::search(stream.begin(), stream.end(), pattern.begin(), pattern.end());
+            REQUIRE(it != stream.end());
+            const std::vector<std::uint8_t> replacement = bytes(to);
+            std::ranges::copy(replacement, it);
+        }
+
+        const void* values_buffer(const record_batch& batch, const std::string& name)
+        {
+            return detail::array_access::get_arrow_proxy(batch.get_column(name)).array().buffers[1];
+        }
+    }
+
+    TEST_SUITE("ipc_stream_reader")
+    {
+        TEST_CASE("next")
+        {
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch(1));
+            batches.push_back(make_batch(5));
+            const std::vector<std::uint8_t> stream = write_stream(batches);
+
+            for (const std::size_t chunk_size : {std::size_t(3), stream.size()})
+            {
+                ipc::stream_reader reader(memory_source(stream, chunk_size));
+                for (const record_batch& expected : batches)
+                {
+                    const std::optional<record_batch> batch = reader.next();
+                    REQUIRE(batch.has_value());
+                    CHECK_EQ(*batch, expected);
+                }
+                CHECK_FALSE(reader.next().has_value());
+                CHECK_FALSE(reader.next().has_value());
+            }
+        }
+
+        TEST_CASE("read_all")
+        {
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch(1));
+            batches.push_back(make_batch(5));
+            batches.push_back(make_batch(9));
+            const std::vector<std::uint8_t> stream = write_stream(batches);
+
+            ipc::stream_reader reader(memory_source(stream, stream.size()));
+            CHECK_EQ(reader.read_all(), batches);
+        }
+
+        TEST_CASE("buffer reuse")
+        {
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch(1, false));
+            batches.push_back(make_batch(5, false));
+            batches.push_back(make_batch(9, false));
+            const std::vector<std::uint8_t> stream = write_stream(batches);
+
+            ipc::stream_reader reader(memory_source(stream, stream.size()));
+            std::optional<record_batch> first = reader.next();
+            REQUIRE(first.has_value());
+            const void* first_values = values_buffer(*first, "a");
+
+            // The block of a batch still alive is not reused
+            std::optional<record_batch> second = reader.next();
+            REQUIRE(second.has_value());
+            CHECK_NE(values_buffer(*second, "a"), first_values);
+            CHECK_EQ(*second, batches[1]);
+
+            // Once released, the block of the first batch is reused
+            first.reset();
+            const std::optional<record_batch> third = reader.next();
+            REQUIRE(third.has_value());
+            CHECK_EQ(values_buffer(*third, "a"), first_values);
+            CHECK_EQ(*third, batches[2]);
+            CHECK_EQ(*second, batches[1]);
+        }
+
+        TEST_CASE("binary views")
+        {
+            const std::vector<std::string> values = {"short", "longer than twelve bytes", "", "another long value"};
+            std::vector<std::string> names = {"v"};
+            std::vector<array> columns;
+            columns.emplace_back(string_view_array(values));
+            std::vector<record_batch> batches;
+            batches.emplace_back(std::move(names), std::move(columns));
+            const std::vector<std::uint8_t> stream = write_stream(batches);
+
+            ipc::stream_reader reader(memory_source(stream, stream.size()));
+            const std::optional<record_batch> batch = reader.next();
+            REQUIRE(batch.has_value());
+            const string_view_array views(detail::array_access::get_arrow_proxy(batch->get_column("v")));
+            REQUIRE_EQ(views.size(), values.size());
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                CHECK_EQ(views[i].value(), values[i]);
+            }
+        }
+
+        TEST_CASE("empty stream")
+        {
+            const std::vector<std::uint8_t> stream = write_stream({});
+            ipc::stream_reader reader(memory_source(stream, stream.size()));
+            CHECK_FALSE(reader.next().has_value());
+
+            const std::vector<std::uint8_t> no_bytes;
+            ipc::stream_reader empty_reader(memory_source(no_bytes, 1));
+            CHECK_FALSE(empty_reader.next().has_value());
+        }
+
+        TEST_CASE("truncated stream")
+        {
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch(1));
+            std::vector<std::uint8_t> stream = write_stream(batches);
+            // Drop the end-of-stream marker and the end of the record batch
+            stream.resize(stream.size() - 12);
+
+            ipc::stream_reader reader(memory_source(stream, stream.size()));
+            CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+
+            // The stream ends between a continuation marker and the size of a message
+            std::vector<std::uint8_t> no_size = write_stream(batches);
+            no_size.resize(no_size.size() - 4);
+            ipc::stream_reader no_size_reader(memory_source(no_size, no_size.size()));
+            REQUIRE(no_size_reader.next().has_value());
+            CHECK_THROWS_AS(std::ignore = no_size_reader.next(), ipc::ipc_error);
+        }
+
+        TEST_CASE("invalid buffers")
+        {
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch(1, false));
+            const std::vector<std::uint8_t> stream = write_stream(batches);
+
+            SUBCASE("offsets out of the values")
+            {
+                std::vector<std::uint8_t> corrupted = stream;
+                overwrite<std::int32_t>(corrupted, {0, 3, 3, 6, 10}, {0, 3, 3, 6, 200});
+                ipc::stream_reader reader(memory_source(corrupted, corrupted.size()));
+                CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+            }
+
+            SUBCASE("decreasing offsets")
+            {
+                std::vector<std::uint8_t> corrupted = stream;
+                overwrite<std::int32_t>(corrupted, {0, 3, 3, 6, 10}, {0, 3, 1, 6, 10});
+                ipc::stream_reader reader(memory_source(corrupted, corrupted.size()));
+                CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+            }
+
+            SUBCASE("node longer than its buffers")
+            {
+                // The field node of the first column: its length and null count
+                std::vector<std::uint8_t> corrupted = stream;
+                overwrite<std::int64_t>(corrupted, {4, 1}, {1000, 1});
+                ipc::stream_reader reader(memory_source(corrupted, corrupted.size()));
+                CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+            }
+        }
+
+        TEST_CASE("invalid run ends")
+        {
+            // [1, null, null, 42, 42, 42, null, 9]
+            primitive_array<std::uint64_t> values(
+                std::vector<std::uint64_t>{1, 0, 42, 0, 9},
+                std::vector<std::size_t>{1, 3}
+            );
+            primitive_array<std::uint32_t> run_ends(std::vector<std::uint32_t>{1, 3, 6, 7, 8});
+            std::vector<std::string> names = {"r"};
+            std::vector<array> columns;
+            columns.emplace_back(run_end_encoded_array(array(std::move(run_ends)), array(std::move(values))));
+            std::vector<record_batch> batches;
+            batches.emplace_back(std::move(names), std::move(columns));
+            const std::vector<std::uint8_t> stream = write_stream(batches);
+
+            ipc::stream_reader valid_reader(memory_source(stream, stream.size()));
+            CHECK(valid_reader.next().has_value());
+
+            SUBCASE("decreasing run ends")
+            {
+                std::vector<std::uint8_t> corrupted = stream;
+                overwrite<std::uint32_t>(corrupted, {1, 3, 6, 7, 8}, {1, 3, 2, 7, 8});
+                ipc::stream_reader reader(memory_source(corrupted, corrupted.size()));
+                CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+            }
+
+            SUBCASE("run ends shorter than the array")
+            {
+                std::vector<std::uint8_t> corrupted = stream;
+                overwrite<std::uint32_t>(corrupted, {1, 3, 6, 7, 8}, {1, 3, 4, 5, 6});
+                ipc::stream_reader reader(memory_source(corrupted, corrupted.size()));
+                CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+            }
+        }
+
+        TEST_CASE("invalid dictionary keys")
+        {
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch(1));
+            std::vector<std::uint8_t> stream = write_stream(batches);
+            overwrite<std::int32_t>(stream, {1, 0, 1, 1}, {1, 0, 2, 1});
+            ipc::stream_reader reader(memory_source(stream, stream.size()));
+            CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+        }
+
+        TEST_CASE("file")
+        {
+            const auto path = std::filesystem::temp_directory_path() / "sparrow_test_stream_reader.arrows";
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch(1));
+            {
+                ipc::stream_writer writer(path);
+                writer.write(batches[0]);
+            }
+            {
+                ipc::stream_reader reader(path);
+                CHECK_EQ(reader.read_all(), batches);
+            }
+            std::filesystem::remove(path);
+        }
+    }
+}
@@ -0,0 +1,184 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "sparrow/ipc/stream_writer.hpp"
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        record_batch make_batch()
+        {
+            std::vector<std::string> names = {"a", "s"};
+            std::vector<array> columns;
+            columns.emplace_back(primitive_array<std::int32_t>(std::vector<std::int32_t>{1, 2, 3, 4}));
+            columns.emplace_back(string_array(std::vector<std::string>{"foo", "", "bar", "quux"}));
+            return record_batch(std::move(names), std::move(columns));
+        }
+
+        // Records the messages written by a stream_writer, one per call
+        struct recording_sink
+        {
+            std::vector<std::vector<std::uint8_t>> messages;
+            std::vector<std::span<const std::uint8_t>> segments;
+
+            ipc::stream_writer::sink_type sink()
+            {
+                return [this](std::span<const std::span<const std::uint8_t>> message)
+                {
+                    std::vector<std::uint8_t>& bytes = messages.emplace_back();
+                    for (const auto& s : message)
+                    {
+                        segments.push_back(s);
+                        bytes.insert(bytes.end(), s.begin(), s.end());
+                    }
+                };
+            }
+        };
+
+        void check_message(const std::vector<std::uint8_t>& message)
+        {
+            REQUIRE_GE(message.size(), 8u);
+            std::uint32_t marker = 0;
+            std::int32_t metadata_size = 0;
+            std::memcpy(&marker, message.data(), sizeof(marker));
+            std::memcpy(&metadata_size, message.data() + 4, sizeof(metadata_size));
+            CHECK_EQ(marker, 0xFFFFFFFFu);
+            CHECK_EQ(metadata_size % 8, 0);
+            CHECK_LE(static_cast<std::size_t>(metadata_size) + 8, message.size());
+            CHECK_EQ(message.size() % 8, 0u);
+        }
+    }
+
+    TEST_SUITE("ipc_stream_writer")
+    {
+        TEST_CASE("messages")
+        {
+            recording_sink rec;
+            const record_batch batch = make_batch();
+            {
+                ipc::stream_writer writer(rec.sink());
+                writer.write(batch);
+                writer.write(batch);
+                writer.close();
+            }
+            // Schema, two record batches, end of stream
+            REQUIRE_EQ(rec.messages.size(), 4u);
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                check_message(rec.messages[i]);
+            }
+            // The record batches are identical
+            CHECK_EQ(rec.messages[1], rec.messages[2]);
+            const std::vector<std::uint8_t> eos = {0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0};
+            CHECK_EQ(rec.messages[3], eos);
+        }
+
+        TEST_CASE("buffers are not copied")
+        {
+            recording_sink rec;
+            const record_batch batch = make_batch();
+            ipc::stream_writer writer(rec.sink());
+            writer.write(batch);
+
+            const auto& proxy = detail::array_access::get_arrow_proxy(batch.get_column("a"));
+            const auto* values = static_cast<const std::uint8_t*>(proxy.array().buffers[1]);
+            const bool found = std::ranges::any_of(
+                rec.segments,
+                [values](std::span<const std::uint8_t> s)
+                {
+                    return s.data() == values && s.size() == 4 * sizeof(std::int32_t);
+                }
+            );
+            CHECK(found);
+        }
+
+        TEST_CASE("binary views")
+        {
+            const std::string long_value = "longer than twelve bytes";
+            std::vector<std::string> names = {"v"};
+            std::vector<array> columns;
+            columns.emplace_back(string_view_array(std::vector<std::string>{"short", long_value}));
+            recording_sink rec;
+            ipc::stream_writer writer(rec.sink());
+            writer.write(record_batch(std::move(names), std::move(columns)));
+
+            // Arrow IPC counts the buffer index of a view from the first
+            // variadic buffer, sparrow from the validity bitmap
+            std::vector<std::uint8_t> view(16, 0);
+            const auto size = static_cast<std::int32_t>(long_value.size());
+            std::memcpy(view.data(), &size, sizeof(size));
+            std::memcpy(view.data() + 4, long_value.data(), 4);
+            REQUIRE_EQ(rec.messages.size(), 2u);
+            const auto& batch = rec.messages[1];
+            CHECK(std::search(batch.begin(), batch.end(), view.begin(), view.end()) != batch.end());
+        }
+
+        TEST_CASE("close")
+        {
+            SUBCASE("empty stream")
+            {
+                recording_sink rec;
+                ipc::stream_writer writer(rec.sink());
+                writer.close();
+                REQUIRE_EQ(rec.messages.size(), 1u);
+                CHECK_EQ(rec.messages[0].size(), 8u);
+            }
+
+            SUBCASE("write after close")
+            {
+                recording_sink rec;
+                ipc::stream_writer writer(rec.sink());
+                writer.close();
+                CHECK_THROWS_AS(writer.write(make_batch()), ipc::ipc_error);
+            }
+        }
+
+        TEST_CASE("schema mismatch")
+        {
+            recording_sink rec;
+            ipc::stream_writer writer(rec.sink());
+            writer.write(make_batch());
+
+            std::vector<std::string> names = {"b"};
+            std::vector<array> columns;
+            columns.emplace_back(primitive_array<double>(std::vector<double>{1., 2.}));
+            CHECK_THROWS_AS(writer.write(record_batch(std::move(names), std::move(columns))), ipc::ipc_error);
+        }
+
+        TEST_CASE("file")
+        {
+            const auto path = std::filesystem::temp_directory_path() / "sparrow_test_stream_writer.arrows";
+            {
+                ipc::stream_writer writer(path);
+                writer.write(make_batch());
+            }
+            CHECK_GT(std::filesystem::file_size(path), 8u);
+            CHECK_EQ(std::filesystem::file_size(path) % 8, 0u);
+            std::filesystem::remove(path);
+        }
+    }
+}
@@ -13,12 +13,14 @@
 // limitations under the License.
 
 #include <array>
+#include <string>
 #include <tuple>
 #include <variant>
 #include <vector>
 
 #include "sparrow/builder/builder_utils.hpp"
 #include "sparrow/builder/nested_eq.hpp"
+#include "sparrow/builder/nested_hash.hpp"
 #include "sparrow/builder/nested_less.hpp"
 
 #include "test_utils.hpp"
@@ -135,4 +137,49 @@ namespace sparrow
             CHECK(eq_type{}(c, c));
         }
     }
+
+    TEST_SUITE("nested-hash")
+    {
+        TEST_CASE("nullable-hash")
+        {
+            using type = nullable<int>;
+            using hash_type = detail::nested_hash<type>;
+
+            // nulls are equal whatever the underlying value
+            CHECK_EQ(hash_type{}(type{1, false}), hash_type{}(type{2, false}));
+            CHECK_EQ(hash_type{}(type{1}), hash_type{}(type{1}));
+            CHECK_NE(hash_type{}(type{1}), hash_type{}(type{2}));
+        }
+
+        TEST_CASE("floating-point")
+        {
+            using hash_type = detail::nested_hash<double>;
+            CHECK_EQ(hash_type{}(0.0), hash_type{}(-0.0));
+        }
+
+        TEST_CASE("string")
+        {
+            using hash_type = detail::nested_hash<std::string>;
+            CHECK_EQ(hash_type{}(std::string("hello")), hash_type{}(std::string("hello")));
+            CHECK_NE(hash_type{}(std::string("hello")), hash_type{}(std::string("world")));
+        }
+
+        TEST_CASE("very-nested-hash")
+        {
+            using tuple_type = std::tuple<nullable<int>, std::vector<std::string>>;
+            using variant_type = std::variant<int, nullable<tuple_type>>;
+            using hash_type = detail::nested_hash<variant_type>;
+            using eq_type = detail::nested_eq<variant_type>;
+
+            const variant_type a{1};
+            const variant_type b{nullable<tuple_type>{tuple_type{nullable<int>{}, {"x", "y"}}}};
+            const variant_type c{nullable<tuple_type>{tuple_type{nullable<int>{3, false}, {"x", "y"}}}};
+            const variant_type d{nullable<tuple_type>{tuple_type{nullable<int>{}, {"xy"}}}};
+
+            REQUIRE(eq_type{}(b, c));
+            CHECK_EQ(hash_type{}(b), hash_type{}(c));
+            CHECK_NE(hash_type{}(a), hash_type{}(b));
+            CHECK_NE(hash_type{}(b), hash_type{}(d));
+        }
+    }
 }
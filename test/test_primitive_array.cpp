@@ -22,9 +22,12 @@
 #if defined(__GNUC__)
 #    pragma GCC diagnostic pop
 #endif
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "sparrow/array.hpp"
+#include "sparrow/buffer/aligned_allocator.hpp"
 #include "sparrow/layout/primitive_layout/primitive_array.hpp"
 
 #include "doctest/doctest.h"
@@ -155,6 +158,67 @@ namespace sparrow
                 CHECK_EQ(ar, ar3);
             }
 
+            SUBCASE("copy on write")
+            {
+                const auto values_data = [](const array_test_type& a)
+                {
+                    return detail::array_access::get_arrow_proxy(a).buffers()[1].data();
+                };
+
+                // The copy shares the memory of the array until one of them is modified
+                array_test_type ar2(ar);
+                CHECK_EQ(values_data(ar2), values_data(ar));
+
+                // Reading through the mutable interface does not copy it
+                CHECK_EQ(ar2[1], nullable_values[1 + offset]);
+                CHECK_EQ(*ar2.begin(), nullable_values[offset]);
+                CHECK_EQ(ar2[0].has_value(), nullable_values[offset].has_value());
+                CHECK_EQ(values_data(ar2), values_data(ar));
+
+                ar2[1] = make_nullable<T>(99);
+                CHECK_NE(values_data(ar2), values_data(ar));
+                CHECK_EQ(ar2[1].get(), static_cast<T>(99));
+                CHECK_EQ(std::as_const(ar)[1], nullable_values[1 + offset]);
+
+                array_test_type ar3(ar);
+                ar.push_back(make_nullable<T>(7));
+                REQUIRE_EQ(ar3.size(), nullable_values.size() - offset);
+                for (std::size_t i = 0; i < ar3.size(); ++i)
+                {
+                    CHECK_EQ(ar3[i], nullable_values[i + offset]);
+                }
+                CHECK_EQ(ar.back().get(), static_cast<T>(7));
+            }
+
+            SUBCASE("value_span")
+            {
+                const std::span<const T> values = std::as_const(ar).value_span();
+                REQUIRE_EQ(values.size(), ar.size());
+                for (std::size_t i = 0; i < values.size(); ++i)
+                {
+                    CHECK_EQ(values[i], nullable_values[i + offset].get());
+                }
+
+                // Writing through the span does not modify the copies of the array
+                const array_test_type ar2(ar);
+                const std::span<T> mutable_values = ar.value_span();
+                CHECK_NE(mutable_values.data(), std::as_const(ar2).value_span().data());
+                mutable_values[1] = static_cast<T>(99);
+                CHECK_EQ(ar[1].get(), static_cast<T>(99));
+                CHECK_EQ(ar2[1], nullable_values[1 + offset]);
+            }
+
+            SUBCASE("bitmap_view")
+            {
+                const validity_bitmap_view bitmap = ar.bitmap_view();
+                CHECK_EQ(bitmap.offset, offset);
+                REQUIRE_EQ(bitmap.size, ar.size());
+                for (std::size_t i = 0; i < bitmap.size; ++i)
+                {
+                    CHECK_EQ(bitmap.test(i), nullable_values[i + offset].has_value());
+                }
+            }
+
             SUBCASE("move")
             {
                 array_test_type ar2(ar);
@@ -617,6 +681,36 @@ namespace sparrow
                 }
             }
 
+            SUBCASE("appender")
+            {
+                // The slice stops before the end of the buffers it shares with full
+                const array_test_type full = make_array(nullable_values);
+                array_test_type slice = full.slice(0, 10);
+                {
+                    auto appender = slice.appender(10 + values_count);
+                    appender.append(nullable_values);
+                    CHECK_EQ(appender.size(), 10 + values_count);
+                }
+                REQUIRE_EQ(slice.size(), 10 + values_count);
+                for (std::size_t i = 0; i < 10; ++i)
+                {
+                    CHECK_EQ(slice[i], nullable_values[i]);
+                }
+                for (std::size_t i = 0; i < values_count; ++i)
+                {
+                    CHECK_EQ(slice[i + 10], nullable_values[i]);
+                }
+                const auto& proxy = detail::array_access::get_arrow_proxy(slice);
+                CHECK_EQ(proxy.null_count(), 5 + values_count / 2);
+
+                // The array the slice shares its buffers with is unchanged
+                REQUIRE_EQ(full.size(), nullable_values.size());
+                for (std::size_t i = 0; i < full.size(); ++i)
+                {
+                    CHECK_EQ(full[i], nullable_values[i]);
+                }
+            }
+
             SUBCASE("nanoarrow compatibility")
             {
                 using inner_value_type = T;
@@ -714,6 +808,119 @@ namespace sparrow
         }
         TEST_CASE_TEMPLATE_APPLY(convenience_constructors_id, testing_types);
 
+        TEST_CASE("validity bitmap allocated lazily")
+        {
+            const auto bitmap_data = [](const primitive_array<std::int32_t>& ar)
+            {
+                return detail::array_access::get_arrow_proxy(ar).buffers()[0].data();
+            };
+            const auto null_count = [](const primitive_array<std::int32_t>& ar)
+            {
+                return detail::array_access::get_arrow_proxy(ar).null_count();
+            };
+
+            primitive_array<std::int32_t> ar(std::vector<std::int32_t>{1, 2, 3, 4});
+            CHECK_EQ(bitmap_data(ar), nullptr);
+            CHECK_EQ(detail::array_access::get_arrow_proxy(ar).array().buffers[0], nullptr);
+            CHECK_EQ(null_count(ar), 0);
+
+            SUBCASE("null-free mutations")
+            {
+                ar.push_back(make_nullable<std::int32_t>(5));
+                ar.push_back(make_nullable<std::int32_t>(6));
+                ar.pop_back();
+                ar.resize(8, make_nullable<std::int32_t>(7));
+                {
+                    auto appender = ar.appender();
+                    appender.push_back(make_nullable<std::int32_t>(9));
+                }
+                const primitive_array<std::int32_t> sliced = ar.slice(1, 6);
+                CHECK_EQ(bitmap_data(ar), nullptr);
+                CHECK_EQ(bitmap_data(sliced), nullptr);
+                REQUIRE_EQ(ar.size(), 9u);
+                const std::vector<std::int32_t> expected = {1, 2, 3, 4, 5, 7, 7, 7, 9};
+                const auto& const_ar = ar;
+                for (std::size_t i = 0; i < expected.size(); ++i)
+                {
+                    REQUIRE(const_ar[i].has_value());
+                    CHECK_EQ(const_ar[i].value(), expected[i]);
+                }
+
+                // Raw accesses to the values do not allocate the bitmap either
+                CHECK(std::ranges::equal(ar.value_span(), expected));
+                CHECK_EQ(sliced.bitmap_view().data, nullptr);
+                CHECK(sliced.bitmap_view().test(0));
+                CHECK_EQ(bitmap_data(ar), nullptr);
+            }
+
+            SUBCASE("first null allocates")
+            {
+                ar.push_back(nullable<std::int32_t>(5, false));
+                REQUIRE_NE(bitmap_data(ar), nullptr);
+                CHECK_EQ(null_count(ar), 1);
+                REQUIRE_EQ(ar.size(), 5u);
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    CHECK(ar[i].has_value());
+                }
+                CHECK_FALSE(ar[4].has_value());
+            }
+
+            SUBCASE("appender")
+            {
+                {
+                    auto appender = ar.appender();
+                    appender.push_back(make_nullable<std::int32_t>(5));
+                    appender.push_back(nullable<std::int32_t>(6, false));
+                    appender.push_back(make_nullable<std::int32_t>(7));
+                }
+                REQUIRE_NE(bitmap_data(ar), nullptr);
+                CHECK_EQ(null_count(ar), 1);
+                REQUIRE_EQ(ar.size(), 7u);
+                const auto& const_ar = ar;
+                for (std::size_t i = 0; i < ar.size(); ++i)
+                {
+                    CHECK_EQ(const_ar[i].has_value(), i != 5);
+                }
+            }
+
+            SUBCASE("writing a null allocates")
+            {
+                // Reading or writing valid elements through the mutable
+                // interface does not allocate the bitmap
+                for (auto&& value : ar)
+                {
+                    CHECK(value.has_value());
+                }
+                CHECK(ar[0].has_value());
+                ar[1] = make_nullable<std::int32_t>(10);
+                CHECK_EQ(bitmap_data(ar), nullptr);
+
+                ar[2] = nullval;
+                REQUIRE_NE(bitmap_data(ar), nullptr);
+                CHECK(ar[1].has_value());
+                CHECK_FALSE(ar[2].has_value());
+                CHECK(ar[3].has_value());
+            }
+        }
+
+        TEST_CASE("copy on write keeps the alignment")
+        {
+            const auto values_data = [](const primitive_array<std::int32_t>& a)
+            {
+                return detail::array_access::get_arrow_proxy(a).buffers()[1].data();
+            };
+
+            primitive_array<std::int32_t> ar(
+                u8_buffer<std::int32_t>(std::size_t(100), 1, aligned_allocator<std::uint8_t>())
+            );
+            primitive_array<std::int32_t> copy(ar);
+            copy[0] = make_nullable<std::int32_t>(2);
+            CHECK_NE(values_data(copy), values_data(ar));
+            CHECK(is_aligned(values_data(copy)));
+            CHECK_EQ(std::as_const(ar)[0].get(), 1);
+        }
+
         static constexpr std::string_view name = "name";
         static constexpr std::string_view metadata = "metadata";
 
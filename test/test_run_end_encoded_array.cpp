@@ -185,6 +185,47 @@ namespace sparrow
                 }
             }
 
+            SUBCASE("cursor")
+            {
+                run_end_encoded_cursor cursor = rle_array.cursor();
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    CHECK_EQ(cursor[i], rle_array[i]);
+                }
+                // Backward and repeated accesses
+                for (std::size_t i = n; i-- > 0;)
+                {
+                    CHECK_EQ(cursor[i], rle_array[i]);
+                    CHECK_EQ(cursor[i], rle_array[i]);
+                }
+                CHECK_EQ(cursor.seek(4), 2);
+                CHECK_EQ(cursor.run_begin(), 3);
+                CHECK_EQ(cursor.run_end(), 6);
+                CHECK_EQ(cursor.seek(7), 4);
+                CHECK_EQ(cursor.seek(0), 0);
+            }
+
+            SUBCASE("for_each_run")
+            {
+                CHECK_EQ(rle_array.run_count(), 5);
+                std::vector<array_traits::const_reference> values;
+                std::vector<std::uint64_t> lengths;
+                rle_array.for_each_run(
+                    [&](array_traits::const_reference value, std::uint64_t length)
+                    {
+                        values.push_back(value);
+                        lengths.push_back(length);
+                    }
+                );
+                CHECK_EQ(lengths, (std::vector<std::uint64_t>{1, 2, 3, 1, 1}));
+                REQUIRE_EQ(values.size(), 5);
+                CHECK_EQ(values[0], rle_array[0]);
+                CHECK_EQ(values[1], rle_array[1]);
+                CHECK_EQ(values[2], rle_array[3]);
+                CHECK_EQ(values[3], rle_array[6]);
+                CHECK_EQ(values[4], rle_array[7]);
+            }
+
             SUBCASE("consitency")
             {
                 test::generic_consistency_test(rle_array);
@@ -199,5 +240,49 @@ namespace sparrow
             }
 #endif
         }
+
+        TEST_CASE("cursor galloping")
+        {
+            // Runs of lengths 1, 2, 3, ... with values 0, 1, 2, ...
+            constexpr std::uint32_t n_runs = 100;
+            std::vector<std::uint32_t> run_ends;
+            std::vector<std::int32_t> values;
+            std::uint32_t end = 0;
+            for (std::uint32_t r = 0; r < n_runs; ++r)
+            {
+                end += r + 1;
+                run_ends.push_back(end);
+                values.push_back(static_cast<std::int32_t>(r));
+            }
+            const run_end_encoded_array rle_array(
+                array(primitive_array<std::uint32_t>(std::move(run_ends))),
+                array(primitive_array<std::int32_t>(std::move(values)))
+            );
+
+            for (const std::size_t stride : {1u, 7u, 250u})
+            {
+                run_end_encoded_cursor cursor = rle_array.cursor();
+                for (std::size_t i = 0; i < rle_array.size(); i += stride)
+                {
+                    CHECK_EQ(cursor[i], rle_array[i]);
+                }
+            }
+
+            run_end_encoded_cursor cursor = rle_array.cursor();
+            const std::uint64_t run = cursor.seek(rle_array.size() - 1);
+            CHECK_EQ(run, n_runs - 1);
+            CHECK_EQ(cursor.run_end(), rle_array.size());
+            CHECK_EQ(cursor.run_end() - cursor.run_begin(), n_runs);
+            CHECK_EQ(cursor.seek(10), 4);
+
+            std::uint64_t total = 0;
+            rle_array.for_each_run(
+                [&total](array_traits::const_reference, std::uint64_t length)
+                {
+                    total += length;
+                }
+            );
+            CHECK_EQ(total, rle_array.size());
+        }
     }
 }
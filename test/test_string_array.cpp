@@ -887,6 +887,29 @@ namespace sparrow
             CHECK_EQ(array.value(9), "!");
         }
 
+        TEST_CASE_FIXTURE(string_array_fixture, "appender")
+        {
+            layout_type array(std::move(m_arrow_proxy));
+            const std::vector<nullable<std::string>> values{
+                make_nullable<std::string>("and"),
+                make_nullable<std::string>("then", false),
+                make_nullable<std::string>("")
+            };
+            {
+                auto appender = array.appender(12);
+                appender.append(values);
+                appender.push_back(make_nullable<std::string>("!"));
+                CHECK_EQ(appender.size(), 13);
+            }
+            REQUIRE_EQ(array.size(), 13);
+            CHECK_EQ(array.value(8), "now");
+            CHECK_EQ(array.value(9), "and");
+            CHECK_FALSE(array[10].has_value());
+            CHECK_EQ(array.value(11), "");
+            CHECK_EQ(array.value(12), "!");
+            CHECK_EQ(detail::array_access::get_arrow_proxy(array).null_count(), 3);
+        }
+
         TEST_CASE_FIXTURE(string_array_fixture, "pop_back")
         {
             layout_type array(std::move(m_arrow_proxy));
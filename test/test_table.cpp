@@ -0,0 +1,121 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sparrow/layout/primitive_layout/primitive_array.hpp"
+#include "sparrow/layout/variable_size_binary_layout/variable_size_binary_array.hpp"
+#include "sparrow/table.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Batch with the columns "id" and "label", holding the rows first
+        // to first + size
+        record_batch make_batch(std::uint32_t first, std::size_t size)
+        {
+            std::vector<std::uint32_t> ids;
+            std::vector<std::string> labels;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ids.push_back(first + static_cast<std::uint32_t>(i));
+                labels.push_back("row " + std::to_string(ids.back()));
+            }
+            return record_batch(
+                {{"id", array(primitive_array<std::uint32_t>(ids))}, {"label", array(string_array(labels))}}
+            );
+        }
+    }
+
+    TEST_SUITE("table")
+    {
+        TEST_CASE("from record batches")
+        {
+            const std::vector<record_batch> batches = {make_batch(0, 4), make_batch(4, 0), make_batch(4, 6)};
+            const table t(batches);
+            CHECK_EQ(t.nb_columns(), 2);
+            CHECK_EQ(t.nb_rows(), 10);
+            CHECK(std::ranges::equal(t.names(), std::vector<std::string>{"id", "label"}));
+            CHECK_EQ(t.get_column_name(1), "label");
+            CHECK(t.contains_column("id"));
+            CHECK_FALSE(t.contains_column("value"));
+            CHECK_THROWS_AS(std::ignore = t.get_column("value"), std::out_of_range);
+
+            const chunked_array& ids = t.get_column("id");
+            CHECK_EQ(ids.nb_chunks(), 3);
+            CHECK(ids == chunked_array(std::vector<array>{make_batch(0, 10).get_column(0)}));
+            CHECK(t.get_column(1) == chunked_array(std::vector<array>{make_batch(0, 10).get_column(1)}));
+        }
+
+        TEST_CASE("add_batch")
+        {
+            table t;
+            t.add_batch(make_batch(0, 3));
+            t.add_batch(make_batch(3, 2));
+            CHECK_EQ(t.nb_rows(), 5);
+            CHECK_EQ(t.get_column(0).nb_chunks(), 2);
+
+            const record_batch other_names({{"id", array(primitive_array<std::uint32_t>(std::vector<std::uint32_t>{1}))}});
+            CHECK_THROWS_AS(t.add_batch(other_names), std::invalid_argument);
+            const record_batch other_types(
+                {{"id", array(primitive_array<std::int64_t>(std::vector<std::int64_t>{1}))},
+                 {"label", array(string_array(std::vector<std::string>{"a"}))}}
+            );
+            CHECK_THROWS_AS(t.add_batch(other_types), std::invalid_argument);
+            CHECK_EQ(t.nb_rows(), 5);
+        }
+
+        TEST_CASE("add_column")
+        {
+            table t(std::vector<record_batch>{make_batch(0, 3)});
+            t.add_column("copy", t.get_column(0));
+            CHECK_EQ(t.nb_columns(), 3);
+            CHECK(t.get_column("copy") == t.get_column("id"));
+
+            CHECK_THROWS_AS(t.add_column("id", t.get_column(0)), std::invalid_argument);
+            const chunked_array longer(std::vector<array>{make_batch(0, 4).get_column(0)});
+            CHECK_THROWS_AS(t.add_column("longer", longer), std::invalid_argument);
+            CHECK_EQ(t.nb_columns(), 3);
+            CHECK_FALSE(t.contains_column("longer"));
+        }
+
+        TEST_CASE("concatenate")
+        {
+            const std::vector<table> tables = {
+                table(std::vector<record_batch>{make_batch(0, 2), make_batch(2, 3)}),
+                table(),
+                table(std::vector<record_batch>{make_batch(5, 5)})
+            };
+            const table res = concatenate(tables);
+            CHECK_EQ(res.nb_rows(), 10);
+            CHECK_EQ(res.get_column(0).nb_chunks(), 3);
+            CHECK(res == table(std::vector<record_batch>{make_batch(0, 10)}));
+
+            const std::vector<table> mismatch = {
+                table(std::vector<record_batch>{make_batch(0, 2)}),
+                table(
+                    std::vector<std::string>{"id"},
+                    std::vector<chunked_array>{chunked_array(std::vector<array>{make_batch(0, 2).get_column(0)})}
+                )
+            };
+            CHECK_THROWS_AS(std::ignore = concatenate(mismatch), std::invalid_argument);
+        }
+    }
+}
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <span>
+
 #include "sparrow/layout/temporal/timestamp_array.hpp"
 #include "sparrow/utils/mp_utils.hpp"
 
@@ -535,6 +537,24 @@ namespace sparrow
                     CHECK_EQ(ar[i], input_values[i]);
                 }
             }
+
+            SUBCASE("value_span")
+            {
+                using duration = typename T::duration;
+                timestamp_array<T> ar(new_york, input_values);
+                const timestamp_array<T> sliced = ar.slice(2, 7);
+                const std::span<const duration> durations = sliced.value_span();
+                REQUIRE_EQ(durations.size(), sliced.size());
+                for (size_t i = 0; i < durations.size(); ++i)
+                {
+                    CHECK_EQ(durations[i], input_values[i + 2].get().get_sys_time().time_since_epoch());
+                }
+
+                const std::span<duration> mutable_durations = ar.value_span();
+                mutable_durations[3] = duration{99};
+                CHECK_EQ(ar[3].get(), make_value<T>(99));
+                CHECK_EQ(sliced[1], input_values[3]);
+            }
         }
         TEST_CASE_TEMPLATE_APPLY(timestamp_array_id, testing_types);
 
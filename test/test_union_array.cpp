@@ -279,6 +279,37 @@ namespace sparrow
                     uarr[3]
                 );
             }
+
+            SUBCASE("partition")
+            {
+                const union_partition partition = uarr.partition();
+                REQUIRE_EQ(partition.children_count(), 2);
+                CHECK(std::ranges::equal(partition.positions(0), std::vector<std::size_t>{0, 2}));
+                CHECK(std::ranges::equal(partition.positions(1), std::vector<std::size_t>{1, 3}));
+                CHECK(std::ranges::equal(partition.child_indices(0), std::vector<std::size_t>{0, 2}));
+                CHECK(std::ranges::equal(partition.child_indices(1), std::vector<std::size_t>{1, 3}));
+
+                const union_partition sub_partition = uarr.partition(1, 3);
+                CHECK(std::ranges::equal(sub_partition.positions(0), std::vector<std::size_t>{2}));
+                CHECK(std::ranges::equal(sub_partition.positions(1), std::vector<std::size_t>{1}));
+
+                std::size_t visited = 0;
+                visit_partitions(
+                    [&](const auto& child,
+                        std::span<const std::size_t> child_indices,
+                        std::span<const std::size_t> positions)
+                    {
+                        REQUIRE_EQ(child_indices.size(), positions.size());
+                        for (std::size_t k = 0; k < positions.size(); ++k)
+                        {
+                            CHECK_EQ(array_traits::const_reference(child[child_indices[k]]), uarr[positions[k]]);
+                        }
+                        visited += positions.size();
+                    },
+                    partition
+                );
+                CHECK_EQ(visited, n);
+            }
         }
 
 #if defined(__cpp_lib_format)
@@ -482,6 +513,37 @@ namespace sparrow
                 },
                 uarr[3]
             );
+
+            SUBCASE("partition")
+            {
+                const union_partition partition = uarr.partition();
+                REQUIRE_EQ(partition.children_count(), 2);
+                CHECK(std::ranges::equal(partition.positions(0), std::vector<std::size_t>{0, 2}));
+                CHECK(std::ranges::equal(partition.positions(1), std::vector<std::size_t>{1, 3}));
+                CHECK(std::ranges::equal(partition.child_indices(0), std::vector<std::size_t>{0, 1}));
+                CHECK(std::ranges::equal(partition.child_indices(1), std::vector<std::size_t>{0, 1}));
+
+                const union_partition sub_partition = uarr.partition(1, 3);
+                CHECK(std::ranges::equal(sub_partition.positions(0), std::vector<std::size_t>{2}));
+                CHECK(std::ranges::equal(sub_partition.positions(1), std::vector<std::size_t>{1}));
+
+                std::size_t visited = 0;
+                visit_partitions(
+                    [&](const auto& child,
+                        std::span<const std::size_t> child_indices,
+                        std::span<const std::size_t> positions)
+                    {
+                        REQUIRE_EQ(child_indices.size(), positions.size());
+                        for (std::size_t k = 0; k < positions.size(); ++k)
+                        {
+                            CHECK_EQ(array_traits::const_reference(child[child_indices[k]]), uarr[positions[k]]);
+                        }
+                        visited += positions.size();
+                    },
+                    partition
+                );
+                CHECK_EQ(visited, n);
+            }
         }
 
 #if defined(__cpp_lib_format)
@@ -11,6 +11,12 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -54,5 +60,117 @@ namespace sparrow
                 }
             }
         }
+
+        TEST_CASE("single pass construction")
+        {
+            // std::views::istream can be iterated only once and has no size
+            std::istringstream input("a bb abcdefghijkl abcdefghijklm 123456789101112 hello_world_this_is_long");
+            const std::vector<std::string> words{
+                "a",
+                "bb",
+                "abcdefghijkl",
+                "abcdefghijklm",
+                "123456789101112",
+                "hello_world_this_is_long"
+            };
+            string_view_array array(std::views::istream<std::string>(input), std::vector<std::size_t>{1});
+
+            REQUIRE_EQ(array.size(), words.size());
+            CHECK_FALSE(array[1].has_value());
+            for (std::size_t i = 0; i < words.size(); ++i)
+            {
+                if (i != 1)
+                {
+                    REQUIRE(array[i].has_value());
+                    CHECK_EQ(array[i].value(), words[i]);
+                }
+            }
+        }
+
+        TEST_CASE("values converted before copy")
+        {
+            // Pointers are not ranges, they are converted to std::string_view first
+            const std::vector<const char*> words{"a", "abcdefghijklm", ""};
+            const string_view_array array(words);
+            REQUIRE_EQ(array.size(), words.size());
+            for (std::size_t i = 0; i < words.size(); ++i)
+            {
+                CHECK_EQ(array[i].value(), std::string_view(words[i]));
+            }
+        }
+
+        TEST_CASE("capped data buffers")
+        {
+            const auto n_data_buffers = [](const string_view_array& ar)
+            {
+                return detail::array_access::get_arrow_proxy(ar).buffers().size() - 3;
+            };
+            const auto data_buffer_size = [](const string_view_array& ar, std::size_t i)
+            {
+                const auto& buffers = detail::array_access::get_arrow_proxy(ar).buffers();
+                std::int64_t size = 0;
+                std::memcpy(&size, buffers.back().data() + i * sizeof(std::int64_t), sizeof(size));
+                CHECK_EQ(static_cast<std::size_t>(size), buffers[2 + i].size());
+                return static_cast<std::size_t>(size);
+            };
+
+            SUBCASE("short values only")
+            {
+                const string_view_array array(std::vector<std::string>{"a", "", "abcdefghijkl"});
+                CHECK_EQ(n_data_buffers(array), 0);
+                CHECK_EQ(array[1].value(), "");
+                CHECK_EQ(array[2].value(), "abcdefghijkl");
+            }
+
+            SUBCASE("values split among buffers")
+            {
+                std::vector<std::string> words;
+                for (std::size_t i = 0; i < 20; ++i)
+                {
+                    words.push_back(std::string(13 + i, static_cast<char>('a' + i)));
+                }
+                words.push_back("short");
+                words.push_back(std::string(100, 'z'));  // longer than the cap
+
+                const string_view_array array(words, validity_bitmap{}, std::size_t(64));
+                REQUIRE_EQ(array.size(), words.size());
+                for (std::size_t i = 0; i < words.size(); ++i)
+                {
+                    CHECK_EQ(array[i].value(), words[i]);
+                }
+                const std::size_t n = n_data_buffers(array);
+                CHECK_GT(n, 1);
+                for (std::size_t i = 0; i + 1 < n; ++i)
+                {
+                    CHECK_LE(data_buffer_size(array, i), 64);
+                }
+                CHECK_EQ(data_buffer_size(array, n - 1), 100);
+
+                // The sizes of the data buffers are used to copy them
+                const string_view_array copy(array);
+                CHECK_EQ(n_data_buffers(copy), n);
+                CHECK_EQ(copy, array);
+            }
+
+            SUBCASE("invalid cap")
+            {
+                const std::vector<std::string> words{"a"};
+                CHECK_THROWS_AS(string_view_array(words, validity_bitmap{}, std::size_t(0)), std::invalid_argument);
+            }
+        }
+
+        TEST_CASE("binary_view_array")
+        {
+            const std::vector<std::vector<std::byte>> values{
+                {std::byte{1}, std::byte{2}},
+                std::vector<std::byte>(40, std::byte{7}),
+                {}
+            };
+            const binary_view_array array(values, std::vector<std::size_t>{2});
+            REQUIRE_EQ(array.size(), 3);
+            CHECK(std::ranges::equal(array[0].value(), values[0]));
+            CHECK(std::ranges::equal(array[1].value(), values[1]));
+            CHECK_FALSE(array[2].has_value());
+        }
     }
 }